@@ -0,0 +1,80 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+
+using namespace scener::content::gltf;
+
+namespace fixtures = benchmarks::fixtures;
+
+namespace
+{
+    // The attributes of a skinned vertex (position, normal, texcoord, joints, weights)
+    std::vector<std::shared_ptr<accessor>> make_skinned_vertex_accessors(std::uint32_t count)
+    {
+        return { fixtures::make_accessor(attribute_type::vector3, 12, count)
+               , fixtures::make_accessor(attribute_type::vector3, 12, count)
+               , fixtures::make_accessor(attribute_type::vector2,  8, count)
+               , fixtures::make_accessor(attribute_type::vector4, 16, count)
+               , fixtures::make_accessor(attribute_type::vector4, 16, count) };
+    }
+}
+
+// Same interleaving the model mesh reader does while building the vertex buffer data
+static void accessor_interleave_per_vertex(benchmark::State& state)
+{
+    const auto vertex_count = static_cast<std::uint32_t>(state.range(0));
+    const auto accessors    = make_skinned_vertex_accessors(vertex_count);
+    const auto stride       = std::uint32_t { 64 };
+
+    auto data = std::vector<std::uint8_t>(stride * vertex_count);
+
+    for (auto _ : state)
+    {
+        auto position = data.begin();
+
+        for (std::uint32_t i = 0; i < vertex_count; ++i)
+        {
+            for (const auto& accessor : accessors)
+            {
+                const auto view = accessor->get_data(i, 1);
+
+                std::copy_n(view.begin(), accessor->byte_stride(), position);
+
+                position += static_cast<std::ptrdiff_t>(accessor->byte_stride());
+            }
+        }
+
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+}
+
+static void accessor_get_element(benchmark::State& state)
+{
+    const auto count    = static_cast<std::uint32_t>(state.range(0));
+    const auto accessor = fixtures::make_accessor(attribute_type::vector4, 16, count);
+
+    struct element { float x, y, z, w; };
+
+    for (auto _ : state)
+    {
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            benchmark::DoNotOptimize(accessor->get_element<element>(i));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(accessor_interleave_per_vertex)->Range(1 << 10, 1 << 16);
+BENCHMARK(accessor_get_element)->Range(1 << 10, 1 << 16);
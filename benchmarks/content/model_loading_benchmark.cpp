@@ -0,0 +1,79 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "nlohmann/json.hpp"
+
+#include "scener/content/content_reader.hpp"
+#include "scener/content/model_description.hpp"
+#include "scener/io/file.hpp"
+#include "scener/io/file_stream.hpp"
+
+using nlohmann::json;
+using scener::content::content_reader;
+using scener::io::file;
+using scener::io::file_stream;
+
+namespace
+{
+    const std::string model_name  = "./content/earthshaker/earthshaker";
+    const std::string model_file  = "./content/earthshaker/earthshaker.gltf";
+    const std::string buffer_file = "./content/earthshaker/earthshaker.bin";
+}
+
+static void model_loading_parse_json(benchmark::State& state)
+{
+    const auto buffer = file::read_all_bytes(model_file);
+
+    for (auto _ : state)
+    {
+        auto root = json::parse(buffer.begin(), buffer.end());
+
+        benchmark::DoNotOptimize(root.size());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+static void model_loading_read_asset_files(benchmark::State& state)
+{
+    auto readed = std::size_t { 0 };
+
+    for (auto _ : state)
+    {
+        auto model  = file::read_all_bytes_async(model_file);
+        auto buffer = file::read_all_bytes_async(buffer_file);
+
+        readed = model.get().size() + buffer.get().size();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(readed));
+}
+
+static void model_loading_decode_asset(benchmark::State& state)
+{
+    // Headless decode with mesh optimization, no graphics device or content manager is involved
+    auto meshes = std::size_t { 0 };
+
+    for (auto _ : state)
+    {
+        auto stream      = file_stream { model_file };
+        auto reader      = content_reader { model_name, nullptr, stream, true };
+        auto description = reader.decode_asset();
+
+        meshes = description->meshes.size();
+
+        benchmark::DoNotOptimize(description.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(meshes));
+}
+
+BENCHMARK(model_loading_parse_json)->Unit(benchmark::kMillisecond);
+BENCHMARK(model_loading_read_asset_files)->Unit(benchmark::kMillisecond);
+BENCHMARK(model_loading_decode_asset)->Unit(benchmark::kMillisecond);
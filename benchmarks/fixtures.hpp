@@ -0,0 +1,88 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef BENCHMARKS_FIXTURES_HPP
+#define BENCHMARKS_FIXTURES_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "scener/content/gltf/accessor.hpp"
+#include "scener/content/gltf/buffer.hpp"
+#include "scener/content/gltf/buffer_view.hpp"
+#include "scener/graphics/animation.hpp"
+#include "scener/graphics/bone.hpp"
+#include "scener/graphics/skeleton.hpp"
+#include "scener/math/matrix.hpp"
+#include "scener/timespan.hpp"
+
+namespace benchmarks::fixtures
+{
+    /// Creates an accessor over a new buffer filled with a repeating byte pattern.
+    /// \param type the accessor attribute type.
+    /// \param stride the size, in bytes, of a single attribute.
+    /// \param count the number of attributes.
+    inline std::shared_ptr<scener::content::gltf::accessor> make_accessor(scener::content::gltf::attribute_type type
+                                                                        , std::uint32_t                         stride
+                                                                        , std::uint32_t                         count)
+    {
+        using namespace scener::content::gltf;
+
+        auto data = std::vector<std::uint8_t>(stride * count);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<std::uint8_t>(i * 31);
+        }
+
+        auto source = std::make_shared<buffer>("buffer", data);
+        auto view   = std::make_shared<buffer_view>(source, 0, source->byte_length());
+
+        return std::make_shared<accessor>(type, component_type::single, view, 0, count, stride);
+    }
+
+    /// Creates a skeleton with a chain of bones, each one animated with the given number of keyframes.
+    /// \param bone_count the number of bones.
+    /// \param keyframe_count the number of keyframes of each bone animation.
+    inline std::shared_ptr<scener::graphics::skeleton> make_skeleton(std::size_t bone_count, std::size_t keyframe_count)
+    {
+        using namespace scener;
+        using namespace scener::graphics;
+
+        auto bones = std::vector<std::shared_ptr<bone>>();
+
+        bones.reserve(bone_count);
+
+        for (std::size_t i = 0; i < bone_count; ++i)
+        {
+            auto keyframes = std::vector<keyframe>();
+
+            keyframes.reserve(keyframe_count);
+
+            for (std::size_t k = 0; k < keyframe_count; ++k)
+            {
+                const auto time      = timespan::from_seconds(static_cast<double>(k) / 30.0);
+                const auto transform = math::matrix::create_translation({ 0.0f, 0.1f * static_cast<float>(k), 0.0f });
+
+                keyframes.push_back({ time, transform });
+            }
+
+            auto name      = "bone_" + std::to_string(i);
+            auto animation = std::make_shared<graphics::animation>(name, keyframes);
+            auto instance  = std::make_shared<bone>(i, name, animation);
+
+            if (i > 0)
+            {
+                bones[i - 1]->add_child(instance);
+            }
+
+            bones.push_back(instance);
+        }
+
+        return std::make_shared<skeleton>("skeleton", bones, std::vector<math::matrix4>(bone_count, math::matrix4::identity()));
+    }
+}
+
+#endif // BENCHMARKS_FIXTURES_HPP
@@ -0,0 +1,27 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+
+using scener::timespan;
+
+static void skeleton_update(benchmark::State& state)
+{
+    const auto bone_count = static_cast<std::size_t>(state.range(0));
+    const auto skeleton   = benchmarks::fixtures::make_skeleton(bone_count, 64);
+    const auto step       = timespan::from_seconds(1.0 / 60.0);
+
+    for (auto _ : state)
+    {
+        skeleton->update(step);
+
+        benchmark::DoNotOptimize(skeleton->skin_transforms().data());
+    }
+
+    // Reported per bone so skeletons of different sizes can be compared
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bone_count));
+}
+
+BENCHMARK(skeleton_update)->RangeMultiplier(2)->Range(8, 256);
@@ -0,0 +1,114 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "scener/io/binary_reader.hpp"
+#include "scener/io/memory_stream.hpp"
+
+using namespace scener::io;
+
+namespace
+{
+    std::vector<std::uint8_t> make_buffer(std::size_t size)
+    {
+        auto buffer = std::vector<std::uint8_t>(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            buffer[i] = static_cast<std::uint8_t>(i * 31);
+        }
+
+        return buffer;
+    }
+}
+
+static void binary_reader_scalar_reads(benchmark::State& state)
+{
+    auto buffer = make_buffer(static_cast<std::size_t>(state.range(0)));
+    auto count  = buffer.size() / sizeof(float);
+
+    for (auto _ : state)
+    {
+        memory_stream stream(buffer);
+        binary_reader reader(stream);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::DoNotOptimize(reader.read<float>());
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+static void binary_reader_bulk_reads(benchmark::State& state)
+{
+    auto buffer = make_buffer(static_cast<std::size_t>(state.range(0)));
+    auto values = std::vector<float>(buffer.size() / sizeof(float));
+
+    for (auto _ : state)
+    {
+        memory_stream stream(buffer);
+        binary_reader reader(stream);
+
+        benchmark::DoNotOptimize(reader.read_into<float>(gsl::span<float>(values)));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+static void binary_reader_bulk_reads_swapped(benchmark::State& state)
+{
+    auto buffer = make_buffer(static_cast<std::size_t>(state.range(0)));
+    auto values = std::vector<float>(buffer.size() / sizeof(float));
+
+    for (auto _ : state)
+    {
+        memory_stream stream(buffer);
+        binary_reader reader(stream, byte_order::big_endian);
+
+        benchmark::DoNotOptimize(reader.read_into<float>(gsl::span<float>(values)));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+static void binary_reader_7_bit_encoded_ints(benchmark::State& state)
+{
+    auto buffer = std::vector<std::uint8_t>();
+
+    for (std::uint32_t i = 0; i < 4096; ++i)
+    {
+        auto value = i * 977;
+
+        while (value >= 0x80)
+        {
+            buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+
+        buffer.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    for (auto _ : state)
+    {
+        memory_stream stream(buffer);
+        binary_reader reader(stream);
+
+        for (std::uint32_t i = 0; i < 4096; ++i)
+        {
+            benchmark::DoNotOptimize(reader.read_7_bit_encoded_int());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 4096);
+}
+
+BENCHMARK(binary_reader_scalar_reads)->Range(4 << 10, 4 << 20);
+BENCHMARK(binary_reader_bulk_reads)->Range(4 << 10, 4 << 20);
+BENCHMARK(binary_reader_bulk_reads_swapped)->Range(4 << 10, 4 << 20);
+BENCHMARK(binary_reader_7_bit_encoded_ints);
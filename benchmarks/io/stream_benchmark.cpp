@@ -0,0 +1,116 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "scener/io/file.hpp"
+#include "scener/io/file_stream.hpp"
+#include "scener/io/memory_stream.hpp"
+
+using namespace scener::io;
+
+namespace
+{
+    const std::string test_file = "./content/earthshaker/earthshaker.bin";
+
+    constexpr std::size_t chunk_size = 64 * 1024;
+}
+
+static void file_stream_sequential_read(benchmark::State& state)
+{
+    auto chunk  = std::vector<char>(chunk_size);
+    auto readed = std::size_t { 0 };
+
+    for (auto _ : state)
+    {
+        file_stream stream(test_file);
+
+        readed = 0;
+
+        for (auto count = stream.read(chunk.data(), 0, chunk.size()); count > 0; count = stream.read(chunk.data(), 0, chunk.size()))
+        {
+            readed += count;
+        }
+
+        benchmark::DoNotOptimize(chunk.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(readed));
+}
+
+static void file_stream_read_async(benchmark::State& state)
+{
+    file_stream stream(test_file);
+
+    auto length = stream.length();
+    auto buffer = std::vector<std::uint8_t>(length);
+
+    for (auto _ : state)
+    {
+        auto pending = std::vector<std::future<std::size_t>>();
+
+        for (std::size_t offset = 0; offset < length; offset += chunk_size)
+        {
+            const auto count = std::min(chunk_size, length - offset);
+
+            pending.push_back(stream.read_async(offset, gsl::span<std::uint8_t>(buffer.data() + offset, count)));
+        }
+
+        for (auto& result : pending)
+        {
+            benchmark::DoNotOptimize(result.get());
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(length));
+}
+
+static void memory_stream_sequential_read(benchmark::State& state)
+{
+    auto buffer = file::read_all_bytes(test_file);
+    auto chunk  = std::vector<char>(chunk_size);
+
+    for (auto _ : state)
+    {
+        memory_stream stream(buffer);
+
+        for (std::size_t offset = 0; offset < buffer.size(); offset += chunk_size)
+        {
+            stream.read(chunk.data(), 0, std::min(chunk_size, buffer.size() - offset));
+
+            benchmark::DoNotOptimize(chunk.data());
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+static void memory_stream_write(benchmark::State& state)
+{
+    auto chunk = std::vector<char>(static_cast<std::size_t>(state.range(0)), 'x');
+
+    for (auto _ : state)
+    {
+        memory_stream stream;
+
+        for (std::size_t written = 0; written < (4 << 20); written += chunk.size())
+        {
+            stream.write(chunk.data(), 0, chunk.size());
+        }
+
+        benchmark::DoNotOptimize(stream.data().data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * (4 << 20));
+}
+
+BENCHMARK(file_stream_sequential_read);
+BENCHMARK(file_stream_read_async);
+BENCHMARK(memory_stream_sequential_read);
+BENCHMARK(memory_stream_write)->Range(16, 64 << 10);
@@ -0,0 +1,126 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "scener/text/utf8_encoding.hpp"
+
+using namespace scener::text;
+
+namespace
+{
+    // ASCII only text, like most asset names and JSON keys
+    std::u16string make_ascii_text(std::size_t length)
+    {
+        auto text = std::u16string(length, u'\0');
+
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            text[i] = static_cast<char16_t>(u'a' + (i % 26));
+        }
+
+        return text;
+    }
+
+    // Mixed text, one non ASCII character (2, 3 or 4 bytes) every eight characters
+    std::u16string make_mixed_text(std::size_t length)
+    {
+        auto text = make_ascii_text(length);
+
+        for (std::size_t i = 7; i + 1 < length; i += 8)
+        {
+            switch ((i / 8) % 3)
+            {
+            case 0:
+                text[i] = u'ñ';
+                break;
+            case 1:
+                text[i] = u'€';
+                break;
+            default:
+                text[i]     = 0xD83D;
+                text[i + 1] = 0xDE00;
+                break;
+            }
+        }
+
+        return text;
+    }
+
+    std::u16string make_text(const benchmark::State& state)
+    {
+        const auto length = static_cast<std::size_t>(state.range(0));
+
+        return (state.range(1) == 0) ? make_ascii_text(length) : make_mixed_text(length);
+    }
+}
+
+static void utf8_encoding_get_bytes(benchmark::State& state)
+{
+    utf8_encoding encoding;
+
+    auto text  = make_text(state);
+    auto bytes = std::vector<std::uint8_t>(encoding.get_byte_count(text));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(encoding.get_bytes(text, bytes));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes.size()));
+}
+
+static void utf8_encoding_get_chars(benchmark::State& state)
+{
+    utf8_encoding encoding;
+
+    auto text  = make_text(state);
+    auto bytes = encoding.get_bytes(text);
+    auto chars = std::vector<char16_t>(text.size());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(encoding.get_chars(gsl::span<const std::uint8_t>(bytes), chars));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes.size()));
+}
+
+static void utf8_encoding_is_valid(benchmark::State& state)
+{
+    utf8_encoding encoding;
+
+    auto text  = make_text(state);
+    auto bytes = encoding.get_bytes(text);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(encoding.is_valid(bytes));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes.size()));
+}
+
+static void utf8_encoding_get_string(benchmark::State& state)
+{
+    utf8_encoding encoding;
+
+    auto text  = make_text(state);
+    auto bytes = encoding.get_bytes(text);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(encoding.get_string(bytes));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes.size()));
+}
+
+BENCHMARK(utf8_encoding_get_bytes)->Ranges({ { 16, 64 << 10 }, { 0, 1 } });
+BENCHMARK(utf8_encoding_get_chars)->Ranges({ { 16, 64 << 10 }, { 0, 1 } });
+BENCHMARK(utf8_encoding_is_valid)->Ranges({ { 16, 64 << 10 }, { 0, 1 } });
+BENCHMARK(utf8_encoding_get_string)->Ranges({ { 16, 64 << 10 }, { 0, 1 } });
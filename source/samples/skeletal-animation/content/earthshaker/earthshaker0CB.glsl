@@ -1,7 +1,6 @@
 layout (binding = 0, std140) uniform ConstantBuffer
 {
     // Vertex Shader
-    uniform mat4 u_jointMat[57];
     uniform mat4 u_normalMatrix;
     uniform mat4 u_modelViewMatrix;
     uniform mat4 u_projectionMatrix;
@@ -16,4 +15,7 @@ layout (binding = 0, std140) uniform ConstantBuffer
     uniform float u_light0LinearAttenuation;
     uniform float u_light0QuadraticAttenuation;
     uniform vec3  u_light0Color;
+
+    // Skinning
+    uniform uint  u_jointOffset;
 };
@@ -3,12 +3,27 @@
 #extension GL_GOOGLE_include_directive : require
 #extension GL_ARB_separate_shader_objects : enable
 
+#ifdef SCENER_BINDLESS_TEXTURES
+#extension GL_EXT_nonuniform_qualifier : require
+#endif
+
 in vec3 v_normal;
 in vec2 v_texcoord0;
 in vec3 v_light0Direction;
 in vec3 v_position;
 
+#ifdef SCENER_BINDLESS_TEXTURES
+layout (set = 1, binding = 0) uniform sampler2D u_textures[];
+
+layout (push_constant) uniform TextureIndices
+{
+    uint u_textureIndices[8];
+};
+
+#define u_diffuse u_textures[nonuniformEXT(u_textureIndices[0])]
+#else
 layout (binding = 1) uniform sampler2D u_diffuse;
+#endif
 
 #include "earthshaker0CB.glsl"
 #include "texture_sampling.glsl"
@@ -9,6 +9,9 @@ layout(location = 3) in vec3 a_normal;
 layout(location = 6) in vec4 a_joint;
 layout(location = 7) in vec4 a_weight;
 
+// Per-instance world transform, identity for non instanced draws
+layout(location = 12) in mat4 a_instance;
+
 #include "earthshaker0CB.glsl"
 #include "structures.glsl"
 #include "common.glsl"
@@ -24,7 +27,7 @@ void main(void)
     VSInputNmTxWeights vin;
     SetVSInputNmTxWeightsParams;
 
-    skin(vin, 4);
+    skin(vin, 4, a_instance);
 
     v_normal          = vin.Normal;
     v_texcoord0       = a_texcoord0;
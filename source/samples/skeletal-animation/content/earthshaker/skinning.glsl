@@ -2,15 +2,43 @@
 // Skinning functions.
 //
 
-void skin(inout VSInputNmTxWeights vin, int boneCount)
+// Bone palette layout, true for affine 3x4 matrices (three rows), false for full 4x4 matrices (four columns).
+layout (constant_id = 0) const bool k_affinePalette = true;
+
+// Joint matrices of every skinned mesh, indexed from u_jointOffset.
+layout (binding = 2, std430) readonly buffer BonePalette
+{
+    vec4 u_jointPalette[];
+};
+
+mat4 joint_matrix(int joint)
+{
+    const uint stride = k_affinePalette ? 3u : 4u;
+    const uint base   = (u_jointOffset + uint(joint)) * stride;
+
+    if (k_affinePalette)
+    {
+        return transpose(mat4(u_jointPalette[base]
+                            , u_jointPalette[base + 1u]
+                            , u_jointPalette[base + 2u]
+                            , vec4(0.0f, 0.0f, 0.0f, 1.0f)));
+    }
+
+    return mat4(u_jointPalette[base]
+              , u_jointPalette[base + 1u]
+              , u_jointPalette[base + 2u]
+              , u_jointPalette[base + 3u]);
+}
+
+void skin(inout VSInputNmTxWeights vin, int boneCount, mat4 instance)
 {
     mat4 skinning = mat4(0.0f);
 
     for (int i = 0; i < boneCount; i++)
     {
-        skinning += vin.Weights[i] * u_jointMat[int(vin.Indices[i])];
+        skinning += vin.Weights[i] * joint_matrix(int(vin.Indices[i]));
     }
 
-    vin.Position = u_modelViewMatrix * skinning * vin.Position;
-    vin.Normal   = mat3(u_normalMatrix) * mat3(skinning) * vin.Normal;
+    vin.Position = u_modelViewMatrix * instance * skinning * vin.Position;
+    vin.Normal   = mat3(u_normalMatrix) * mat3(instance) * mat3(skinning) * vin.Normal;
 }
\ No newline at end of file
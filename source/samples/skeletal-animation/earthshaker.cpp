@@ -49,6 +49,9 @@ namespace skeletal::animation
 
     void earthshaker::load_content() noexcept
     {
+        _renderer->content_manager()->optimize_meshes(true);
+        _renderer->content_manager()->pack_vertices(true);
+
         _model = _renderer->content_manager()->load("earthshaker/earthshaker");
 
         std::for_each(_model->meshes().begin(), _model->meshes().end(), [] (auto mesh) -> void
@@ -4,6 +4,7 @@
 #include "scener/content/content_manager.hpp"
 
 #include "scener/content/content_reader.hpp"
+#include "scener/diagnostics/profiler.hpp"
 #include "scener/graphics/model.hpp"
 #include "scener/graphics/service_container.hpp"
 #include "scener/io/file_stream.hpp"
@@ -12,6 +13,7 @@
 
 namespace scener::content
 {
+    using scener::diagnostics::profile_zone;
     using scener::graphics::model;
     using scener::graphics::service_container;
     using scener::io::file_stream;
@@ -19,6 +21,9 @@ namespace scener::content
     content_manager::content_manager(gsl::not_null<service_container*> serviceprovider, const std::string& rootdirectory) noexcept
         : _service_provider { serviceprovider }
         , _root_directory   { rootdirectory }
+        , _resource_manager { }
+        , _optimize_meshes  { false }
+        , _pack_vertices    { false }
     {
     }
 
@@ -37,6 +42,26 @@ namespace scener::content
         return _root_directory;
     }
 
+    bool content_manager::optimize_meshes() const noexcept
+    {
+        return _optimize_meshes;
+    }
+
+    void content_manager::optimize_meshes(bool optimize_meshes) noexcept
+    {
+        _optimize_meshes = optimize_meshes;
+    }
+
+    bool content_manager::pack_vertices() const noexcept
+    {
+        return _pack_vertices;
+    }
+
+    void content_manager::pack_vertices(bool pack_vertices) noexcept
+    {
+        _pack_vertices = pack_vertices;
+    }
+
     std::shared_ptr<model> content_manager::load(const std::string& assetname) noexcept
     {
         if (_resource_manager.has_resource(assetname))
@@ -44,9 +69,11 @@ namespace scener::content
             return _resource_manager.get_resource<model>(assetname);
         }
 
+        profile_zone zone { "load", "content" };
+
         auto stream = open_stream(assetname);
 
-        content_reader reader(assetname, this, stream);
+        content_reader reader(assetname, this, stream, _optimize_meshes);
 
         auto asset = reader.read_asset();
 
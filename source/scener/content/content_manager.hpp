@@ -39,6 +39,22 @@ namespace scener::content
         /// Gets the root directory associated with this content_manager.
         const std::string& root_directory() const noexcept;
 
+        /// Gets a value indicating whether the mesh parts are reordered for the vertex cache, overdraw and vertex
+        /// fetch when they are loaded.
+        bool optimize_meshes() const noexcept;
+
+        /// Sets a value indicating whether the mesh parts are reordered for the vertex cache, overdraw and vertex
+        /// fetch when they are loaded.
+        void optimize_meshes(bool optimize_meshes) noexcept;
+
+        /// Gets a value indicating whether the vertex attributes of the mesh parts are quantized to compact formats
+        /// when they are realized on the graphics device.
+        bool pack_vertices() const noexcept;
+
+        /// Sets a value indicating whether the vertex attributes of the mesh parts are quantized to compact formats
+        /// when they are realized on the graphics device.
+        void pack_vertices(bool pack_vertices) noexcept;
+
     public:
         /// Loads the given asset.
         std::shared_ptr<graphics::model> load(const std::string& assetname) noexcept;
@@ -53,6 +69,8 @@ namespace scener::content
         graphics::service_container* _service_provider;
         std::string                  _root_directory;
         content_resource_manager     _resource_manager;
+        bool                         _optimize_meshes;
+        bool                         _pack_vertices;
     };
 }
 
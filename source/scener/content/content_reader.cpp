@@ -3,31 +3,61 @@
 
 #include "scener/content/content_reader.hpp"
 
+#include <algorithm>
 #include <experimental/algorithm>
+#include <unordered_set>
+#include <utility>
 
 #include "scener/content/content_manager.hpp"
+#include "scener/content/model_description.hpp"
+#include "scener/diagnostics/profiler.hpp"
 #include "scener/graphics/animation.hpp"
+#include "scener/graphics/graphics_device.hpp"
+#include "scener/graphics/igraphics_device_service.hpp"
 #include "scener/graphics/model.hpp"
 #include "scener/graphics/model_mesh.hpp"
+#include "scener/graphics/scene_graph.hpp"
+#include "scener/graphics/service_container.hpp"
 #include "scener/io/file.hpp"
 #include "scener/io/path.hpp"
 
 namespace scener::content
 {
+    using scener::diagnostics::profile_zone;
     using scener::graphics::animation;
+    using scener::graphics::igraphics_device_service;
     using scener::graphics::model;
     using scener::graphics::model_mesh;
+    using scener::graphics::scene_graph;
+    using scener::math::matrix4;
+    using scener::math::matrix::create_scale;
+    using scener::math::matrix::create_from_quaternion;
+    using scener::math::matrix::create_translation;
     using nlohmann::json;
 
-    content_reader::content_reader(const std::string& assetname, content::content_manager* manager, io::stream& stream) noexcept
-        : _asset_name      { assetname }
-        , _asset_reader    { stream    }
-        , _content_manager { manager   }
+    content_reader::content_reader(const std::string&        assetname
+                                 , content::content_manager* manager
+                                 , io::stream&               stream
+                                 , bool                      optimize_meshes) noexcept
+        : _asset_name      { assetname       }
+        , _asset_reader    { stream          }
+        , _content_manager { manager         }
+        , _optimize_meshes { optimize_meshes }
         , _root            { }
         , _cache           { }
+        , _prefetched      { }
     {
     }
 
+    content_reader::~content_reader()
+    {
+        // Reads prefetched for references that were never consumed still target buffers owned by their futures
+        for (auto& prefetched : _prefetched)
+        {
+            prefetched.second.wait();
+        }
+    }
+
     const std::string& content_reader::asset_name() const noexcept
     {
         return _asset_name;
@@ -38,14 +68,19 @@ namespace scener::content
         return _content_manager;
     }
 
+    bool content_reader::optimize_meshes() const noexcept
+    {
+        return _optimize_meshes;
+    }
+
     std::shared_ptr<model> content_reader::read_asset() noexcept
     {
-        auto buffer   = _asset_reader.read_bytes(_asset_reader.base_stream().length());
-        auto instance = std::make_shared<model>();
+        // CPU decode first, the meshes and textures are then realized on the device from the cached descriptions
+        decode_asset();
 
-        _root = json::parse(buffer.begin(), buffer.end());
+        profile_zone zone { "realize_asset", "content" };
 
-        _cache.reserve(_root.size());
+        auto instance = std::make_shared<model>();
 
         // Meshes
         const auto& meshes = _root["meshes"];
@@ -68,6 +103,8 @@ namespace scener::content
             read_object<gltf::node>(key, val);
         }
 
+        read_scene_graph(instance.get());
+
         // Animations
         const auto& animations = _root["animations"];
 
@@ -79,24 +116,295 @@ namespace scener::content
         return instance;
     }
 
+    std::shared_ptr<model_description> content_reader::decode_asset() noexcept
+    {
+        profile_zone zone { "decode_asset", "content" };
+
+        read_root();
+
+        auto instance = std::make_shared<model_description>();
+
+        instance->name = _asset_name;
+
+        // Meshes
+        const auto& meshes = _root["meshes"];
+
+        instance->meshes.reserve(meshes.size());
+
+        for (auto it = meshes.begin(); it != meshes.end(); ++it)
+        {
+            instance->meshes.emplace(it.key(), read_object<mesh_description>(it.key(), it.value()));
+        }
+
+        // Materials
+        const auto& materials = _root["materials"];
+
+        instance->materials.reserve(materials.size());
+
+        for (auto it = materials.begin(); it != materials.end(); ++it)
+        {
+            instance->materials.emplace(it.key(), read_object<material_description>(it.key(), it.value()));
+        }
+
+        // Textures
+        const auto& textures = _root["textures"];
+
+        instance->textures.reserve(textures.size());
+
+        for (auto it = textures.begin(); it != textures.end(); ++it)
+        {
+            instance->textures.emplace(it.key(), read_object<texture_description>(it.key(), it.value()));
+        }
+
+        return instance;
+    }
+
     bool content_reader::read_header() noexcept
     {
         return true;
     }
 
+    void content_reader::read_root() noexcept
+    {
+        if (!_root.is_null())
+        {
+            return;
+        }
+
+        auto buffer = _asset_reader.read_bytes(_asset_reader.base_stream().length());
+
+        _root = json::parse(buffer.begin(), buffer.end());
+
+        prefetch_external_references();
+    }
+
+    void content_reader::read_scene_graph(model* instance) noexcept
+    {
+        const auto& nodes = _root["nodes"];
+
+        // Root nodes are the ones not referenced as a child by any other node
+        std::unordered_set<std::string> children;
+
+        for (auto it = nodes.begin(); it != nodes.end(); ++it)
+        {
+            if (it.value().count(gltf::k_children) != 0)
+            {
+                for (const auto& child : it.value()[gltf::k_children])
+                {
+                    children.insert(child.get<std::string>());
+                }
+            }
+        }
+
+        // Depth-first traversal, so every subtree ends up stored contiguously
+        std::vector<std::pair<std::shared_ptr<gltf::node>, std::int32_t>> pending;
+
+        for (auto it = nodes.begin(); it != nodes.end(); ++it)
+        {
+            if (children.count(it.key()) == 0)
+            {
+                pending.emplace_back(read_object<gltf::node>(it.key()), scene_graph::no_parent);
+            }
+        }
+
+        std::reverse(pending.begin(), pending.end());
+
+        instance->_scene.reserve(nodes.size());
+        instance->_mesh_nodes.assign(instance->_meshes.size(), scene_graph::no_parent);
+
+        while (!pending.empty())
+        {
+            const auto [node, parent] = pending.back();
+
+            pending.pop_back();
+
+            // Either the matrix or the TRS properties are defined, the other one is left as identity
+            const auto local = create_scale(node->scale)
+                             * create_from_quaternion(node->rotation)
+                             * create_translation(node->translation)
+                             * node->matrix;
+
+            const auto index = instance->_scene.add_node(node->name, parent, local);
+
+            for (const auto& mesh : node->meshes)
+            {
+                const auto it = std::find(instance->_meshes.begin(), instance->_meshes.end(), mesh);
+
+                if (it != instance->_meshes.end())
+                {
+                    auto& mesh_node = instance->_mesh_nodes[std::distance(instance->_meshes.begin(), it)];
+
+                    if (mesh_node == scene_graph::no_parent)
+                    {
+                        mesh_node = index;
+                    }
+                }
+            }
+
+            std::for_each(node->children.rbegin(), node->children.rend(), [&] (const auto& child) -> void
+            {
+                pending.emplace_back(child, index);
+            });
+        }
+
+        instance->_scene.update();
+    }
+
     std::string content_reader::get_asset_path(const std::string& assetname) const noexcept
     {
         auto root = io::path::combine(io::path::get_directory_name(_asset_name), assetname);
 
+        if (_content_manager == nullptr)
+        {
+            return root;
+        }
+
         return io::path::combine(_content_manager->root_directory(), root);
     }
 
-    std::vector<std::uint8_t> content_reader::read_external_reference(const std::string& assetname) const noexcept
+    std::string content_reader::get_shader_name(const std::string& uri) const noexcept
+    {
+        // Devices using the bindless texture table load the variant compiled for it, when the asset provides one
+        if (_content_manager != nullptr)
+        {
+            const auto gdservice = _content_manager->service_provider()->get_service<igraphics_device_service>();
+            const auto bindless  = uri + ".bindless.spv";
+
+            if (gdservice->device()->texture_table() != nullptr && io::file::exists(get_asset_path(bindless)))
+            {
+                return bindless;
+            }
+        }
+
+        return uri + ".spv";
+    }
+
+    std::vector<std::uint8_t> content_reader::read_external_reference(const std::string& assetname) noexcept
     {
+        auto prefetched = _prefetched.find(assetname);
+
+        if (prefetched != _prefetched.end())
+        {
+            auto buffer = prefetched->second.get();
+
+            _prefetched.erase(prefetched);
+
+            return buffer;
+        }
+
         auto path = get_asset_path(assetname);
 
         Ensures(io::file::exists(path));
 
         return io::file::read_all_bytes(path);
     }
+
+    void content_reader::prefetch_external_references() noexcept
+    {
+        // Issue the reads of the buffers and shaders the asset will consume up front, so I/O overlaps with the JSON
+        // and mesh decoding
+        const auto prefetch = [&] (const std::string& assetname) -> void
+        {
+            const auto path = get_asset_path(assetname);
+
+            if (_prefetched.count(assetname) == 0 && io::file::exists(path))
+            {
+                _prefetched.emplace(assetname, io::file::read_all_bytes_async(path));
+            }
+        };
+
+        // Buffers are read through the buffer views that reference them
+        const auto& buffers = _root["buffers"];
+        const auto& views   = _root["bufferViews"];
+
+        std::unordered_set<std::string> referenced;
+
+        for (auto it = views.begin(); it != views.end(); ++it)
+        {
+            if (it.value().count(gltf::k_buffer) != 0)
+            {
+                referenced.insert(it.value()[gltf::k_buffer].get<std::string>());
+            }
+        }
+
+        for (const auto& key : referenced)
+        {
+            if (buffers.count(key) != 0 && buffers[key].count(gltf::k_uri) != 0)
+            {
+                prefetch(buffers[key][gltf::k_uri].get<std::string>());
+            }
+        }
+
+        // Shaders are only read when the materials are realized on a device, and only for the techniques in use
+        if (_content_manager == nullptr)
+        {
+            return;
+        }
+
+        const auto& meshes     = _root["meshes"];
+        const auto& materials  = _root["materials"];
+        const auto& techniques = _root["techniques"];
+        const auto& programs   = _root["programs"];
+        const auto& shaders    = _root["shaders"];
+
+        std::unordered_set<std::string> used;
+
+        for (auto it = meshes.begin(); it != meshes.end(); ++it)
+        {
+            if (it.value().count(gltf::k_primitives) == 0)
+            {
+                continue;
+            }
+
+            for (const auto& primitive : it.value()[gltf::k_primitives])
+            {
+                if (primitive.count(gltf::k_material) != 0)
+                {
+                    used.insert(primitive[gltf::k_material].get<std::string>());
+                }
+            }
+        }
+
+        referenced.clear();
+
+        for (const auto& material : used)
+        {
+            if (materials.count(material) == 0 || materials[material].count(gltf::k_technique) == 0)
+            {
+                continue;
+            }
+
+            const auto technique = materials[material][gltf::k_technique].get<std::string>();
+
+            if (techniques.count(technique) == 0 || techniques[technique].count(gltf::k_program) == 0)
+            {
+                continue;
+            }
+
+            const auto key = techniques[technique][gltf::k_program].get<std::string>();
+
+            if (programs.count(key) == 0)
+            {
+                continue;
+            }
+
+            const auto& program = programs[key];
+
+            for (const auto& stage : { gltf::k_vertex_shader, gltf::k_fragment_shader })
+            {
+                if (program.count(stage) != 0)
+                {
+                    referenced.insert(program[stage].get<std::string>());
+                }
+            }
+        }
+
+        for (const auto& key : referenced)
+        {
+            if (shaders.count(key) != 0 && shaders[key].count(gltf::k_uri) != 0)
+            {
+                prefetch(get_shader_name(shaders[key][gltf::k_uri].get<std::string>()));
+            }
+        }
+    }
 }
@@ -6,8 +6,10 @@
 
 #include <any>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <typeindex>
 #include <unordered_map>
 #include <vector>
 
@@ -49,6 +51,10 @@ namespace scener::graphics
 namespace scener::content
 {
     class content_manager;
+    class material_description;
+    class mesh_description;
+    class model_description;
+    class texture_description;
 
     /// Reads application content_manager from disk.
     class content_reader final
@@ -56,12 +62,19 @@ namespace scener::content
     public:
         /// Initializes a new instance of the content_reader.
         /// \param assetname the name of the asset to be readed.
-        /// \param manager the content_manager that owns this content_reader.
+        /// \param manager the content_manager that owns this content_reader; nullptr for headless decoding, in which
+        ///        case external references are resolved relative to the asset name.
         /// \param stream the base stream.
-        content_reader(const std::string& assetname, content::content_manager* manager, io::stream& stream) noexcept;
+        /// \param optimize_meshes a value indicating whether the decoded mesh parts are reordered for the vertex
+        ///        cache, overdraw and vertex fetch.
+        content_reader(const std::string&        assetname
+                     , content::content_manager* manager
+                     , io::stream&               stream
+                     , bool                      optimize_meshes) noexcept;
 
-        /// Releases all resources used by the current instance of the content_reader class.
-        ~content_reader() = default;
+        /// Releases all resources used by the current instance of the content_reader class, waiting for any
+        /// outstanding prefetched read.
+        ~content_reader();
 
     public:
         /// Gets the name of the asset currently being read by this content_reader.
@@ -70,17 +83,33 @@ namespace scener::content
         /// Gets the content manager that owns this content_reader.
         content::content_manager* content_manager() const noexcept;
 
+        /// Gets a value indicating whether the decoded mesh parts are reordered for the vertex cache, overdraw and
+        /// vertex fetch.
+        bool optimize_meshes() const noexcept;
+
     public:
         /// Reads the contents of the current asset.
         /// \returns the contents of the current asset.
         std::shared_ptr<graphics::model> read_asset() noexcept;
 
+        /// Decodes the meshes, materials and textures of the current asset without creating any device resources.
+        /// \returns the GPU agnostic description of the current asset.
+        std::shared_ptr<model_description> decode_asset() noexcept;
+
     private:
         bool read_header() noexcept;
 
+        void read_root() noexcept;
+
+        void read_scene_graph(graphics::model* instance) noexcept;
+
         std::string get_asset_path(const std::string& assetname) const noexcept;
 
-        std::vector<std::uint8_t> read_external_reference(const std::string& assetname) const noexcept;
+        std::string get_shader_name(const std::string& uri) const noexcept;
+
+        std::vector<std::uint8_t> read_external_reference(const std::string& assetname) noexcept;
+
+        void prefetch_external_references() noexcept;
 
     private:
         template<typename T>
@@ -116,9 +145,13 @@ namespace scener::content
         template <typename T>
         inline std::shared_ptr<T> get_object(const std::string& key) noexcept
         {
-            if (_cache.find(key) != _cache.end())
+            // Objects are cached per type, as a description and its realized object share the same key
+            const auto& objects = _cache[std::type_index(typeid(T))];
+            const auto  object  = objects.find(key);
+
+            if (object != objects.end())
             {
-                return std::any_cast<std::shared_ptr<T>>(_cache[key]);
+                return std::any_cast<std::shared_ptr<T>>(object->second);
             }
 
             return nullptr;
@@ -127,7 +160,7 @@ namespace scener::content
         template <typename T>
         inline void cache_object(const std::string& key, std::shared_ptr<T> object) noexcept
         {
-            _cache[key] = object;
+            _cache[std::type_index(typeid(T))][key] = object;
         }
 
         template <typename T>
@@ -137,8 +170,10 @@ namespace scener::content
         std::string                               _asset_name;
         io::binary_reader                         _asset_reader;
         content::content_manager*                 _content_manager;
+        bool                                      _optimize_meshes;
         nlohmann::json                            _root;
-        std::unordered_map<std::string, std::any> _cache;
+        std::unordered_map<std::type_index, std::unordered_map<std::string, std::any>> _cache;
+        std::unordered_map<std::string, std::future<std::vector<std::uint8_t>>> _prefetched;
 
         template <typename T> friend class scener::content::readers::content_type_reader;
     };
@@ -181,6 +216,13 @@ namespace scener::content
         return read_object<dds::surface>(key, _root["images"][key]);
     }
 
+    // Materials
+    template<>
+    inline std::shared_ptr<material_description> content_reader::read_object(const std::string& key) noexcept
+    {
+        return read_object<material_description>(key, _root["materials"][key]);
+    }
+
     // Meshes
     template<>
     inline std::shared_ptr<graphics::model_mesh> content_reader::read_object(const std::string& key) noexcept
@@ -188,6 +230,12 @@ namespace scener::content
         return read_object<graphics::model_mesh>(key, _root["meshes"][key]);
     }
 
+    template<>
+    inline std::shared_ptr<mesh_description> content_reader::read_object(const std::string& key) noexcept
+    {
+        return read_object<mesh_description>(key, _root["meshes"][key]);
+    }
+
     // Nodes
     template<>
     inline std::shared_ptr<gltf::node> content_reader::read_object(const std::string& key) noexcept
@@ -223,6 +271,12 @@ namespace scener::content
         return read_object<graphics::texture2d>(key, _root["textures"][key]);
     }
 
+    template<>
+    inline std::shared_ptr<texture_description> content_reader::read_object(const std::string& key) noexcept
+    {
+        return read_object<texture_description>(key, _root["textures"][key]);
+    }
+
     // Type conversion operations
     template<>
     inline math::matrix4 content_reader::convert(const std::vector<nlohmann::json>& values) const noexcept
@@ -0,0 +1,853 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/content/dds/block_compression.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include <gsl/gsl>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SCENER_DDS_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace scener::content::dds
+{
+    using scener::graphics::surface_format;
+
+    namespace
+    {
+        // sRGB formats share the block layout of their linear counterparts, only the sampling differs.
+        constexpr surface_format block_format(surface_format format) noexcept
+        {
+            switch (format)
+            {
+            case surface_format::dxt1_srgb:
+                return surface_format::dxt1;
+            case surface_format::dxt3_srgb:
+                return surface_format::dxt3;
+            case surface_format::dxt5_srgb:
+                return surface_format::dxt5;
+            case surface_format::bc7_srgb:
+                return surface_format::bc7;
+            default:
+                return format;
+            }
+        }
+
+        // BC7 mode layouts, as described in the BPTC specification.
+        struct bc7_mode
+        {
+            std::uint8_t subsets;
+            std::uint8_t partition_bits;
+            std::uint8_t rotation_bits;
+            std::uint8_t index_selection_bits;
+            std::uint8_t color_bits;
+            std::uint8_t alpha_bits;
+            std::uint8_t endpoint_pbits;
+            std::uint8_t shared_pbits;
+            std::uint8_t index_bits;
+            std::uint8_t secondary_index_bits;
+        };
+
+        constexpr bc7_mode bc7_modes[8] =
+        {
+            { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 }
+          , { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 }
+          , { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 }
+          , { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 }
+          , { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 }
+          , { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 }
+          , { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 }
+          , { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 }
+        };
+
+        // Two subset partitions, bit i holds the subset of texel i.
+        constexpr std::uint16_t bc7_partitions2[64] =
+        {
+            0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80
+          , 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000
+          , 0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE
+          , 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C
+          , 0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A
+          , 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660
+          , 0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C
+          , 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+        };
+
+        // Three subset partitions, one subset per texel.
+        constexpr std::uint8_t bc7_partitions3[64][16] =
+        {
+            { 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2 }, { 0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1 }
+          , { 0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1 }, { 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1 }
+          , { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2 }, { 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2 }
+          , { 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1 }, { 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1 }
+          , { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2 }, { 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2 }
+          , { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2 }, { 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2 }
+          , { 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2 }, { 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2 }
+          , { 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2 }, { 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0 }
+          , { 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2 }, { 0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0 }
+          , { 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2 }, { 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1 }
+          , { 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2 }, { 0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1 }
+          , { 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2 }, { 0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0 }
+          , { 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0 }, { 0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2 }
+          , { 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0 }, { 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1 }
+          , { 0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2 }, { 0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2 }
+          , { 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1 }, { 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1 }
+          , { 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2 }, { 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1 }
+          , { 0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2 }, { 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0 }
+          , { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0 }, { 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0 }
+          , { 0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0 }, { 0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1 }
+          , { 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1 }, { 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2 }
+          , { 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1 }, { 0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2 }
+          , { 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1 }, { 0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1 }
+          , { 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1 }, { 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1 }
+          , { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2 }, { 0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1 }
+          , { 0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2 }, { 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2 }
+          , { 0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2 }, { 0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2 }
+          , { 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2 }, { 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2 }
+          , { 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2 }, { 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2 }
+          , { 0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2 }, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2 }
+          , { 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1 }, { 0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2 }
+          , { 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 }, { 0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0 }
+        };
+
+        // Texel holding the implicit high bit of the second subset indices, two subset partitions.
+        constexpr std::uint8_t bc7_anchors2[64] =
+        {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15
+          , 15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2
+          , 15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6
+          ,  6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+        };
+
+        // Texel holding the implicit high bit of the second subset indices, three subset partitions.
+        constexpr std::uint8_t bc7_anchors3_second[64] =
+        {
+             3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3
+          ,  3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15
+          ,  8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15
+          ,  3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3
+        };
+
+        // Texel holding the implicit high bit of the third subset indices, three subset partitions.
+        constexpr std::uint8_t bc7_anchors3_third[64] =
+        {
+            15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8
+          , 15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8
+          , 15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8
+          , 15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8
+        };
+
+        constexpr std::uint8_t bc7_weights2[4]  = { 0, 21, 43, 64 };
+        constexpr std::uint8_t bc7_weights3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+        constexpr std::uint8_t bc7_weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        // Reads the fields of a 128-bit block, least significant bit first.
+        class bit_reader final
+        {
+        public:
+            explicit bit_reader(const std::uint8_t* block) noexcept
+                : _low      { 0 }
+                , _high     { 0 }
+                , _position { 0 }
+            {
+                std::memcpy(&_low , block    , sizeof _low);
+                std::memcpy(&_high, block + 8, sizeof _high);
+            }
+
+            std::uint32_t read(std::uint32_t count) noexcept
+            {
+                if (count == 0)
+                {
+                    return 0;
+                }
+
+                std::uint64_t value;
+
+                if (_position >= 64)
+                {
+                    value = _high >> (_position - 64);
+                }
+                else if (_position == 0)
+                {
+                    value = _low;
+                }
+                else
+                {
+                    value = (_low >> _position) | (_high << (64 - _position));
+                }
+
+                _position += count;
+
+                return static_cast<std::uint32_t>(value & ((1ull << count) - 1));
+            }
+
+            void skip(std::uint32_t count) noexcept
+            {
+                _position += count;
+            }
+
+        private:
+            std::uint64_t _low;
+            std::uint64_t _high;
+            std::uint32_t _position;
+        };
+
+        inline std::uint16_t read_u16(const std::uint8_t* data) noexcept
+        {
+            return static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+        }
+
+        inline void unpack_565(std::uint16_t color, std::uint8_t* rgba) noexcept
+        {
+            const std::uint32_t r = (color >> 11) & 0x1F;
+            const std::uint32_t g = (color >> 5)  & 0x3F;
+            const std::uint32_t b = color         & 0x1F;
+
+            rgba[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+            rgba[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+            rgba[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+            rgba[3] = 255;
+        }
+
+        inline std::uint16_t pack_565(const std::uint8_t* rgba) noexcept
+        {
+            return static_cast<std::uint16_t>(((rgba[0] >> 3) << 11) | ((rgba[1] >> 2) << 5) | (rgba[2] >> 3));
+        }
+
+        // Builds the four RGBA8 entries of a BC1 color palette; BC2 and BC3 always use the four color mode.
+        void color_palette(std::uint16_t c0, std::uint16_t c1, bool four_colors, std::uint8_t* palette) noexcept
+        {
+            unpack_565(c0, palette);
+            unpack_565(c1, palette + 4);
+
+            if (four_colors || c0 > c1)
+            {
+                for (std::size_t channel = 0; channel < 3; ++channel)
+                {
+                    palette[8  + channel] = static_cast<std::uint8_t>((2 * palette[channel] + palette[4 + channel]) / 3);
+                    palette[12 + channel] = static_cast<std::uint8_t>((palette[channel] + 2 * palette[4 + channel]) / 3);
+                }
+
+                palette[11] = 255;
+                palette[15] = 255;
+            }
+            else
+            {
+                for (std::size_t channel = 0; channel < 3; ++channel)
+                {
+                    palette[8 + channel] = static_cast<std::uint8_t>((palette[channel] + palette[4 + channel]) / 2);
+                }
+
+                palette[11] = 255;
+
+                std::memset(palette + 12, 0, 4);
+            }
+        }
+
+        // Builds the eight entries of a BC3 alpha / BC4 channel palette.
+        void channel_palette(std::uint8_t a0, std::uint8_t a1, std::uint8_t* palette) noexcept
+        {
+            palette[0] = a0;
+            palette[1] = a1;
+
+            if (a0 > a1)
+            {
+                for (std::uint32_t i = 1; i < 7; ++i)
+                {
+                    palette[i + 1] = static_cast<std::uint8_t>(((7 - i) * a0 + i * a1) / 7);
+                }
+            }
+            else
+            {
+                for (std::uint32_t i = 1; i < 5; ++i)
+                {
+                    palette[i + 1] = static_cast<std::uint8_t>(((5 - i) * a0 + i * a1) / 5);
+                }
+
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+        }
+
+        void lookup_colors_scalar(const std::uint8_t* palette, std::uint32_t indices, std::uint8_t* texels) noexcept
+        {
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                std::memcpy(texels + i * 4, palette + ((indices >> (i * 2)) & 0x3) * 4, 4);
+            }
+        }
+
+#if defined(SCENER_DDS_X86_SIMD)
+        // pshufb masks gathering the palette entries selected by a row of four 2-bit indices
+        struct shuffle_table
+        {
+            alignas(16) std::uint8_t masks[256][16];
+        };
+
+        const shuffle_table& palette_shuffles() noexcept
+        {
+            static const shuffle_table table = [] () -> shuffle_table
+            {
+                shuffle_table instance = { };
+
+                for (std::uint32_t row = 0; row < 256; ++row)
+                {
+                    for (std::uint32_t texel = 0; texel < 4; ++texel)
+                    {
+                        const auto entry = (row >> (texel * 2)) & 0x3;
+
+                        for (std::uint32_t channel = 0; channel < 4; ++channel)
+                        {
+                            instance.masks[row][texel * 4 + channel] = static_cast<std::uint8_t>(entry * 4 + channel);
+                        }
+                    }
+                }
+
+                return instance;
+            }();
+
+            return table;
+        }
+
+        __attribute__((target("ssse3")))
+        void lookup_colors_ssse3(const std::uint8_t* palette, std::uint32_t indices, std::uint8_t* texels) noexcept
+        {
+            const auto& table  = palette_shuffles();
+            const auto  colors = _mm_loadu_si128(reinterpret_cast<const __m128i*>(palette));
+
+            for (std::uint32_t row = 0; row < 4; ++row)
+            {
+                const auto mask = _mm_load_si128(reinterpret_cast<const __m128i*>(table.masks[(indices >> (row * 8)) & 0xFF]));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(texels + row * 16), _mm_shuffle_epi8(colors, mask));
+            }
+        }
+#endif
+
+        using lookup_colors_kernel = void (*)(const std::uint8_t*, std::uint32_t, std::uint8_t*) noexcept;
+
+        lookup_colors_kernel lookup_colors() noexcept
+        {
+            static const lookup_colors_kernel kernel = [] () -> lookup_colors_kernel
+            {
+#if defined(SCENER_DDS_X86_SIMD)
+                if (__builtin_cpu_supports("ssse3"))
+                {
+                    palette_shuffles();
+
+                    return lookup_colors_ssse3;
+                }
+#endif
+                return lookup_colors_scalar;
+            }();
+
+            return kernel;
+        }
+
+        void decode_color(const std::uint8_t* block, bool four_colors, std::uint8_t* texels) noexcept
+        {
+            alignas(16) std::uint8_t palette[16];
+            std::uint32_t            indices;
+
+            color_palette(read_u16(block), read_u16(block + 2), four_colors, palette);
+
+            std::memcpy(&indices, block + 4, sizeof indices);
+
+            lookup_colors()(palette, indices, texels);
+        }
+
+        void decode_channel(const std::uint8_t* block, std::size_t channel, std::uint8_t* texels) noexcept
+        {
+            std::uint8_t  palette[8];
+            std::uint64_t indices = 0;
+
+            channel_palette(block[0], block[1], palette);
+
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                indices |= static_cast<std::uint64_t>(block[2 + i]) << (i * 8);
+            }
+
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                texels[i * 4 + channel] = palette[(indices >> (i * 3)) & 0x7];
+            }
+        }
+
+        void decode_bc2_alpha(const std::uint8_t* block, std::uint8_t* texels) noexcept
+        {
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                const auto alpha = (block[i / 2] >> ((i & 1) * 4)) & 0xF;
+
+                texels[i * 4 + 3] = static_cast<std::uint8_t>(alpha * 17);
+            }
+        }
+
+        void decode_bc7(const std::uint8_t* block, std::uint8_t* texels) noexcept
+        {
+            if (block[0] == 0)
+            {
+                // reserved mode, decodes to transparent black
+                std::memset(texels, 0, 64);
+                return;
+            }
+
+            std::uint32_t mode = 0;
+
+            while ((block[0] & (1u << mode)) == 0)
+            {
+                ++mode;
+            }
+
+            const auto& layout = bc7_modes[mode];
+            bit_reader  reader(block);
+
+            reader.skip(mode + 1);
+
+            const auto partition       = reader.read(layout.partition_bits);
+            const auto rotation        = reader.read(layout.rotation_bits);
+            const auto index_selection = reader.read(layout.index_selection_bits);
+            const auto endpoint_count  = layout.subsets * 2u;
+
+            std::uint32_t endpoints[6][4] = { };
+            std::uint32_t pbits[6]        = { };
+
+            for (std::uint32_t channel = 0; channel < 3; ++channel)
+            {
+                for (std::uint32_t endpoint = 0; endpoint < endpoint_count; ++endpoint)
+                {
+                    endpoints[endpoint][channel] = reader.read(layout.color_bits);
+                }
+            }
+
+            for (std::uint32_t endpoint = 0; endpoint < endpoint_count && layout.alpha_bits > 0; ++endpoint)
+            {
+                endpoints[endpoint][3] = reader.read(layout.alpha_bits);
+            }
+
+            for (std::uint32_t endpoint = 0; endpoint < endpoint_count && layout.endpoint_pbits > 0; ++endpoint)
+            {
+                pbits[endpoint] = reader.read(1);
+            }
+
+            for (std::uint32_t subset = 0; subset < layout.subsets && layout.shared_pbits > 0; ++subset)
+            {
+                pbits[subset * 2] = pbits[subset * 2 + 1] = reader.read(1);
+            }
+
+            // Unquantize the endpoints to 8 bits, replicating the high bits
+            const auto has_pbits = (layout.endpoint_pbits + layout.shared_pbits) > 0;
+
+            for (std::uint32_t endpoint = 0; endpoint < endpoint_count; ++endpoint)
+            {
+                for (std::uint32_t channel = 0; channel < 4; ++channel)
+                {
+                    std::uint32_t bits  = (channel < 3) ? layout.color_bits : layout.alpha_bits;
+                    auto&         value = endpoints[endpoint][channel];
+
+                    if (bits == 0)
+                    {
+                        value = 255;
+                        continue;
+                    }
+                    if (has_pbits)
+                    {
+                        value = (value << 1) | pbits[endpoint];
+                        bits++;
+                    }
+
+                    value = (value << (8 - bits)) | (value >> (2 * bits - 8));
+                }
+            }
+
+            // Partition and anchor texels
+            std::uint8_t subsets[16] = { };
+            std::uint8_t anchors[3]  = { 0, 0, 0 };
+
+            if (layout.subsets == 2)
+            {
+                for (std::uint32_t i = 0; i < 16; ++i)
+                {
+                    subsets[i] = static_cast<std::uint8_t>((bc7_partitions2[partition] >> i) & 1);
+                }
+
+                anchors[1] = bc7_anchors2[partition];
+            }
+            else if (layout.subsets == 3)
+            {
+                std::memcpy(subsets, bc7_partitions3[partition], sizeof subsets);
+
+                anchors[1] = bc7_anchors3_second[partition];
+                anchors[2] = bc7_anchors3_third[partition];
+            }
+
+            // The anchor texels store their index without its (implicitly zero) high bit
+            std::uint32_t indices[16]   = { };
+            std::uint32_t secondary[16] = { };
+
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                const auto anchor = (i == anchors[subsets[i]]);
+
+                indices[i] = reader.read(layout.index_bits - (anchor ? 1 : 0));
+            }
+
+            for (std::uint32_t i = 0; i < 16 && layout.secondary_index_bits > 0; ++i)
+            {
+                secondary[i] = reader.read(layout.secondary_index_bits - ((i == 0) ? 1 : 0));
+            }
+
+            const auto weights = [] (std::uint32_t bits) -> const std::uint8_t*
+            {
+                return (bits == 2) ? bc7_weights2 : ((bits == 3) ? bc7_weights3 : bc7_weights4);
+            };
+
+            const auto interpolate = [] (std::uint32_t e0, std::uint32_t e1, std::uint32_t weight) -> std::uint8_t
+            {
+                return static_cast<std::uint8_t>(((64 - weight) * e0 + weight * e1 + 32) >> 6);
+            };
+
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                const auto& e0 = endpoints[subsets[i] * 2];
+                const auto& e1 = endpoints[subsets[i] * 2 + 1];
+
+                auto color_weight = weights(layout.index_bits)[indices[i]];
+                auto alpha_weight = color_weight;
+
+                if (layout.secondary_index_bits > 0)
+                {
+                    const auto secondary_weight = weights(layout.secondary_index_bits)[secondary[i]];
+
+                    alpha_weight = (index_selection == 0) ? secondary_weight : color_weight;
+                    color_weight = (index_selection == 0) ? color_weight     : secondary_weight;
+                }
+
+                auto texel = texels + i * 4;
+
+                texel[0] = interpolate(e0[0], e1[0], color_weight);
+                texel[1] = interpolate(e0[1], e1[1], color_weight);
+                texel[2] = interpolate(e0[2], e1[2], color_weight);
+                texel[3] = interpolate(e0[3], e1[3], alpha_weight);
+
+                if (rotation != 0)
+                {
+                    std::swap(texel[3], texel[rotation - 1]);
+                }
+            }
+        }
+
+        void encode_color(const std::uint8_t* texels, std::uint8_t* block) noexcept
+        {
+            std::uint8_t minimum[4] = { 255, 255, 255, 255 };
+            std::uint8_t maximum[4] = { 0, 0, 0, 0 };
+
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                for (std::uint32_t channel = 0; channel < 3; ++channel)
+                {
+                    minimum[channel] = std::min(minimum[channel], texels[i * 4 + channel]);
+                    maximum[channel] = std::max(maximum[channel], texels[i * 4 + channel]);
+                }
+            }
+
+            // Pick the box diagonal; channels that decrease along the widest one swap their extremes
+            std::uint32_t axis = 0;
+
+            for (std::uint32_t channel = 1; channel < 3; ++channel)
+            {
+                if ((maximum[channel] - minimum[channel]) > (maximum[axis] - minimum[axis]))
+                {
+                    axis = channel;
+                }
+            }
+
+            for (std::uint32_t channel = 0; channel < 3; ++channel)
+            {
+                int covariance = 0;
+
+                for (std::uint32_t i = 0; i < 16; ++i)
+                {
+                    covariance += (texels[i * 4 + axis]    * 2 - maximum[axis]    - minimum[axis])
+                                * (texels[i * 4 + channel] * 2 - maximum[channel] - minimum[channel]);
+                }
+
+                if (covariance < 0)
+                {
+                    std::swap(minimum[channel], maximum[channel]);
+                }
+            }
+
+            // Inset the bounding box to reduce the error of the colors close to its corners
+            for (std::uint32_t channel = 0; channel < 3; ++channel)
+            {
+                const auto inset = (maximum[channel] - minimum[channel]) / 16;
+
+                minimum[channel] = static_cast<std::uint8_t>(minimum[channel] + inset);
+                maximum[channel] = static_cast<std::uint8_t>(maximum[channel] - inset);
+            }
+
+            auto c0 = pack_565(maximum);
+            auto c1 = pack_565(minimum);
+
+            // c0 > c1 selects the four color mode
+            if (c0 < c1)
+            {
+                std::swap(c0, c1);
+            }
+
+            std::uint32_t indices = 0;
+
+            if (c0 != c1)
+            {
+                std::uint8_t palette[16];
+
+                color_palette(c0, c1, true, palette);
+
+                for (std::uint32_t i = 0; i < 16; ++i)
+                {
+                    std::uint32_t best_index    = 0;
+                    std::uint32_t best_distance = ~0u;
+
+                    for (std::uint32_t entry = 0; entry < 4; ++entry)
+                    {
+                        std::uint32_t distance = 0;
+
+                        for (std::uint32_t channel = 0; channel < 3; ++channel)
+                        {
+                            const auto delta = static_cast<int>(texels[i * 4 + channel]) - palette[entry * 4 + channel];
+
+                            distance += static_cast<std::uint32_t>(delta * delta);
+                        }
+
+                        if (distance < best_distance)
+                        {
+                            best_distance = distance;
+                            best_index    = entry;
+                        }
+                    }
+
+                    indices |= best_index << (i * 2);
+                }
+            }
+
+            block[0] = static_cast<std::uint8_t>(c0);
+            block[1] = static_cast<std::uint8_t>(c0 >> 8);
+            block[2] = static_cast<std::uint8_t>(c1);
+            block[3] = static_cast<std::uint8_t>(c1 >> 8);
+
+            std::memcpy(block + 4, &indices, sizeof indices);
+        }
+
+        void encode_alpha(const std::uint8_t* texels, std::uint8_t* block) noexcept
+        {
+            std::uint8_t minimum = 255;
+            std::uint8_t maximum = 0;
+
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                minimum = std::min(minimum, texels[i * 4 + 3]);
+                maximum = std::max(maximum, texels[i * 4 + 3]);
+            }
+
+            std::uint8_t  palette[8];
+            std::uint64_t indices = 0;
+
+            // a0 > a1 selects the eight value mode; a single value block keeps every index at zero
+            channel_palette(maximum, minimum, palette);
+
+            for (std::uint32_t i = 0; i < 16 && maximum != minimum; ++i)
+            {
+                std::uint64_t best_index    = 0;
+                int           best_distance = 256;
+
+                for (std::uint32_t entry = 0; entry < 8; ++entry)
+                {
+                    const auto distance = std::abs(static_cast<int>(texels[i * 4 + 3]) - palette[entry]);
+
+                    if (distance < best_distance)
+                    {
+                        best_distance = distance;
+                        best_index    = entry;
+                    }
+                }
+
+                indices |= best_index << (i * 3);
+            }
+
+            block[0] = maximum;
+            block[1] = minimum;
+
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                block[2 + i] = static_cast<std::uint8_t>(indices >> (i * 8));
+            }
+        }
+    }
+
+    bool block_compression::can_decode(surface_format format) noexcept
+    {
+        switch (block_format(format))
+        {
+        case surface_format::dxt1:
+        case surface_format::dxt3:
+        case surface_format::dxt5:
+        case surface_format::bc4:
+        case surface_format::bc5:
+        case surface_format::bc7:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool block_compression::can_encode(surface_format format) noexcept
+    {
+        const auto block = block_format(format);
+
+        return (block == surface_format::dxt1 || block == surface_format::dxt5);
+    }
+
+    std::size_t block_compression::block_size(surface_format format) noexcept
+    {
+        const auto block = block_format(format);
+
+        return (block == surface_format::dxt1 || block == surface_format::bc4) ? 8 : 16;
+    }
+
+    void block_compression::decode_block(surface_format format, const std::uint8_t* block, std::uint8_t* texels) noexcept
+    {
+        Expects(can_decode(format));
+
+        switch (block_format(format))
+        {
+        case surface_format::dxt1:
+            decode_color(block, false, texels);
+            break;
+
+        case surface_format::dxt3:
+            decode_color(block + 8, true, texels);
+            decode_bc2_alpha(block, texels);
+            break;
+
+        case surface_format::dxt5:
+            decode_color(block + 8, true, texels);
+            decode_channel(block, 3, texels);
+            break;
+
+        case surface_format::bc4:
+        case surface_format::bc5:
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                texels[i * 4 + 1] = 0;
+                texels[i * 4 + 2] = 0;
+                texels[i * 4 + 3] = 255;
+            }
+
+            decode_channel(block, 0, texels);
+
+            if (format == surface_format::bc5)
+            {
+                decode_channel(block + 8, 1, texels);
+            }
+            break;
+
+        default:
+            decode_bc7(block, texels);
+            break;
+        }
+    }
+
+    void block_compression::encode_block(surface_format format, const std::uint8_t* texels, std::uint8_t* block) noexcept
+    {
+        Expects(can_encode(format));
+
+        if (block_format(format) == surface_format::dxt5)
+        {
+            encode_alpha(texels, block);
+            encode_color(texels, block + 8);
+        }
+        else
+        {
+            encode_color(texels, block);
+        }
+    }
+
+    void block_compression::decode(surface_format                       format
+                                 , std::uint32_t                        width
+                                 , std::uint32_t                        height
+                                 , const gsl::span<const std::uint8_t>& blocks
+                                 , const gsl::span<std::uint8_t>&       texels) noexcept
+    {
+        const auto blocks_wide = std::max<std::uint32_t>(1, (width  + 3) / 4);
+        const auto blocks_high = std::max<std::uint32_t>(1, (height + 3) / 4);
+        const auto size        = block_size(format);
+
+        Expects(static_cast<std::size_t>(blocks.size()) >= std::size_t { blocks_wide } * blocks_high * size);
+        Expects(static_cast<std::size_t>(texels.size()) >= std::size_t { width } * height * 4);
+
+        alignas(16) std::uint8_t decoded[64];
+
+        for (std::uint32_t by = 0; by < blocks_high; ++by)
+        {
+            for (std::uint32_t bx = 0; bx < blocks_wide; ++bx)
+            {
+                decode_block(format, blocks.data() + (std::size_t { by } * blocks_wide + bx) * size, decoded);
+
+                // Blocks at the right and bottom edges may be partially outside the image
+                const auto columns = std::min<std::uint32_t>(4, width  - bx * 4);
+                const auto rows    = std::min<std::uint32_t>(4, height - by * 4);
+
+                for (std::uint32_t row = 0; row < rows; ++row)
+                {
+                    const auto offset = (std::size_t { by * 4 + row } * width + bx * 4) * 4;
+
+                    std::memcpy(texels.data() + offset, decoded + row * 16, columns * 4);
+                }
+            }
+        }
+    }
+
+    void block_compression::encode(surface_format                       format
+                                 , std::uint32_t                        width
+                                 , std::uint32_t                        height
+                                 , const gsl::span<const std::uint8_t>& texels
+                                 , const gsl::span<std::uint8_t>&       blocks) noexcept
+    {
+        const auto blocks_wide = std::max<std::uint32_t>(1, (width  + 3) / 4);
+        const auto blocks_high = std::max<std::uint32_t>(1, (height + 3) / 4);
+        const auto size        = block_size(format);
+
+        Expects(width > 0 && height > 0);
+        Expects(static_cast<std::size_t>(texels.size()) >= std::size_t { width } * height * 4);
+        Expects(static_cast<std::size_t>(blocks.size()) >= std::size_t { blocks_wide } * blocks_high * size);
+
+        std::uint8_t source[64];
+
+        for (std::uint32_t by = 0; by < blocks_high; ++by)
+        {
+            for (std::uint32_t bx = 0; bx < blocks_wide; ++bx)
+            {
+                for (std::uint32_t row = 0; row < 4; ++row)
+                {
+                    const auto y = std::min(by * 4 + row, height - 1);
+
+                    for (std::uint32_t column = 0; column < 4; ++column)
+                    {
+                        const auto x = std::min(bx * 4 + column, width - 1);
+
+                        std::memcpy(source + (row * 4 + column) * 4, texels.data() + (std::size_t { y } * width + x) * 4, 4);
+                    }
+                }
+
+                encode_block(format, source, blocks.data() + (std::size_t { by } * blocks_wide + bx) * size);
+            }
+        }
+    }
+}
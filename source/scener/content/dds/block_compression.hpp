@@ -0,0 +1,83 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_DDS_BLOCK_COMPRESSION_HPP
+#define SCENER_CONTENT_DDS_BLOCK_COMPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gsl/span>
+
+#include "scener/graphics/surface_format.hpp"
+
+namespace scener::content::dds
+{
+    /// CPU block compression codec.
+    /// Decodes BC1 (DXT1), BC2 (DXT3), BC3 (DXT5), BC4, BC5 and BC7 blocks into RGBA8 texels, and encodes RGBA8
+    /// texels into BC1 and BC3 blocks with a fast bounding box endpoint fit. The BC1-BC3 color palette lookup runs
+    /// 4 texels at a time when the CPU supports SSSE3. sRGB formats are handled as their linear counterparts, the
+    /// texels keep their encoding.
+    class block_compression final
+    {
+    public:
+        /// Gets a value indicating whether blocks of the given format can be decoded.
+        /// \param format the block compressed format.
+        /// \returns true if blocks of the given format can be decoded; false otherwise.
+        static bool can_decode(scener::graphics::surface_format format) noexcept;
+
+        /// Gets a value indicating whether blocks of the given format can be encoded.
+        /// \param format the block compressed format.
+        /// \returns true if blocks of the given format can be encoded; false otherwise.
+        static bool can_encode(scener::graphics::surface_format format) noexcept;
+
+        /// Gets the size, in bytes, of a single 4x4 block of the given format.
+        /// \param format the block compressed format.
+        /// \returns the size, in bytes, of a single block.
+        static std::size_t block_size(scener::graphics::surface_format format) noexcept;
+
+        /// Decodes a single 4x4 block into 16 RGBA8 texels, in row major order.
+        /// \param format the block compressed format.
+        /// \param block the block data.
+        /// \param texels the destination of the 64 bytes of decoded texels.
+        static void decode_block(scener::graphics::surface_format format, const std::uint8_t* block, std::uint8_t* texels) noexcept;
+
+        /// Encodes 16 RGBA8 texels, in row major order, into a single 4x4 block.
+        /// \param format the block compressed format, BC1 (DXT1, alpha is ignored) or BC3 (DXT5).
+        /// \param texels the 64 bytes of texels to encode.
+        /// \param block the destination of the block data.
+        static void encode_block(scener::graphics::surface_format format, const std::uint8_t* texels, std::uint8_t* block) noexcept;
+
+        /// Decodes a block compressed image into tightly packed RGBA8 texels.
+        /// \param format the block compressed format.
+        /// \param width the image width, in pixels.
+        /// \param height the image height, in pixels.
+        /// \param blocks the image blocks.
+        /// \param texels the destination of the decoded texels, width * height * 4 bytes.
+        static void decode(scener::graphics::surface_format     format
+                         , std::uint32_t                        width
+                         , std::uint32_t                        height
+                         , const gsl::span<const std::uint8_t>& blocks
+                         , const gsl::span<std::uint8_t>&       texels) noexcept;
+
+        /// Encodes tightly packed RGBA8 texels into a block compressed image; partial blocks at the right and
+        /// bottom edges are padded by clamping to the last row and column.
+        /// \param format the block compressed format, BC1 (DXT1) or BC3 (DXT5).
+        /// \param width the image width, in pixels.
+        /// \param height the image height, in pixels.
+        /// \param texels the texels to encode, width * height * 4 bytes.
+        /// \param blocks the destination of the image blocks.
+        static void encode(scener::graphics::surface_format     format
+                         , std::uint32_t                        width
+                         , std::uint32_t                        height
+                         , const gsl::span<const std::uint8_t>& texels
+                         , const gsl::span<std::uint8_t>&       blocks) noexcept;
+
+    private:
+        block_compression() = delete;
+        block_compression(const block_compression& codec) = delete;
+        block_compression& operator=(const block_compression& codec) = delete;
+    };
+}
+
+#endif // SCENER_CONTENT_DDS_BLOCK_COMPRESSION_HPP
@@ -0,0 +1,37 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_DDS_DXGI_FORMAT_HPP
+#define SCENER_CONTENT_DDS_DXGI_FORMAT_HPP
+
+#include <cstdint>
+
+namespace scener::content::dds
+{
+    /// Resource data formats stored in the DDS_HEADER_DXT10 extended header, only the ones that can be loaded
+    /// are listed.
+    /// https://msdn.microsoft.com/en-us/library/windows/desktop/bb173059.aspx
+    enum class dxgi_format : std::uint32_t
+    {
+        unknown             = 0   ///< The format is not known.
+      , r16g16b16a16_float  = 10  ///< Four-component, 64-bit floating-point format that supports 16 bits per channel.
+      , r8g8b8a8_unorm      = 28  ///< Four-component, 32-bit unsigned-normalized-integer format.
+      , r8g8b8a8_unorm_srgb = 29  ///< Four-component, 32-bit unsigned-normalized-integer sRGB format.
+      , bc1_unorm           = 71  ///< Four-component block-compression format (DXT1).
+      , bc1_unorm_srgb      = 72  ///< Four-component block-compression format for sRGB data (DXT1).
+      , bc2_unorm           = 74  ///< Four-component block-compression format (DXT3).
+      , bc2_unorm_srgb      = 75  ///< Four-component block-compression format for sRGB data (DXT3).
+      , bc3_unorm           = 77  ///< Four-component block-compression format (DXT5).
+      , bc3_unorm_srgb      = 78  ///< Four-component block-compression format for sRGB data (DXT5).
+      , bc4_unorm           = 80  ///< One-component block-compression format.
+      , bc5_unorm           = 83  ///< Two-component block-compression format.
+      , b8g8r8a8_unorm      = 87  ///< Four-component, 32-bit unsigned-normalized-integer format, blue first.
+      , b8g8r8a8_unorm_srgb = 91  ///< Four-component, 32-bit unsigned-normalized-integer sRGB format, blue first.
+      , bc6h_uf16           = 95  ///< Three-component unsigned half floating-point block-compression format.
+      , bc6h_sf16           = 96  ///< Three-component signed half floating-point block-compression format.
+      , bc7_unorm           = 98  ///< Three or four-component block-compression format.
+      , bc7_unorm_srgb      = 99  ///< Three or four-component block-compression format for sRGB data.
+    };
+}
+
+#endif // SCENER_CONTENT_DDS_DXGI_FORMAT_HPP
@@ -14,11 +14,17 @@ namespace scener::content::dds
     /// When using a four-character code, dwFlags must include DDPF_FOURCC.
     enum class fourcc : std::uint32_t
     {
-        dxt1 = 0x31545844 ///< DXT1 (also known as Block Compression 1 or BC1).
-      , dxt2 = 0x32545844 ///< DXT2 and DXT3 (collectively also known as Block Compression 2 or BC2).
-      , dxt3 = 0x33545844 ///< DXT2 and DXT3 (collectively also known as Block Compression 2 or BC2).
-      , dxt4 = 0x34545844 ///< DXT4 and DXT5 (collectively also known as Block Compression 3 or BC3).
-      , dxt5 = 0x35545844 ///< DXT4 and DXT5 (collectively also known as Block Compression 3 or BC3).
+        dxt1          = 0x31545844 ///< DXT1 (also known as Block Compression 1 or BC1).
+      , dxt2          = 0x32545844 ///< DXT2 and DXT3 (collectively also known as Block Compression 2 or BC2).
+      , dxt3          = 0x33545844 ///< DXT2 and DXT3 (collectively also known as Block Compression 2 or BC2).
+      , dxt4          = 0x34545844 ///< DXT4 and DXT5 (collectively also known as Block Compression 3 or BC3).
+      , dxt5          = 0x35545844 ///< DXT4 and DXT5 (collectively also known as Block Compression 3 or BC3).
+      , ati1          = 0x31495441 ///< Block Compression 4 (BC4), single channel.
+      , bc4u          = 0x55344342 ///< Block Compression 4 (BC4), single channel.
+      , ati2          = 0x32495441 ///< Block Compression 5 (BC5), two channels.
+      , bc5u          = 0x55354342 ///< Block Compression 5 (BC5), two channels.
+      , dx10          = 0x30315844 ///< The DDS_HEADER_DXT10 extended header follows the file header.
+      , a16b16g16r16f = 113        ///< Legacy Direct3D 9 format code for 64-bit RGBA half floating-point data.
     };
 }
 
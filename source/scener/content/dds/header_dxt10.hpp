@@ -0,0 +1,31 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_DDS_HEADER_DXT10_HPP
+#define SCENER_CONTENT_DDS_HEADER_DXT10_HPP
+
+#include <cstdint>
+
+#include "scener/content/dds/dxgi_format.hpp"
+#include "scener/content/dds/resource_dimension.hpp"
+
+namespace scener::content::dds
+{
+    /// DDS header extension to handle resource arrays and DXGI formats; present right after the file header
+    /// when the pixel format four-character code is DX10.
+    /// https://msdn.microsoft.com/en-us/library/windows/desktop/bb943983.aspx
+    struct header_dxt10
+    {
+        /// Set in misc_flag when the 2D texture is a cube map.
+        static constexpr std::uint32_t misc_texturecube = 0x4;
+
+        scener::content::dds::dxgi_format        dxgi_format;        ///< The surface pixel format.
+        scener::content::dds::resource_dimension resource_dimension; ///< Identifies the type of resource.
+        std::uint32_t                            misc_flag;          ///< Less common options for resources.
+        std::uint32_t                            array_size;         ///< The number of elements in the array;
+                                                                     ///< the number of cubes for a cube map.
+        std::uint32_t                            misc_flags2;        ///< Alpha mode of the surface contents.
+    };
+}
+
+#endif // SCENER_CONTENT_DDS_HEADER_DXT10_HPP
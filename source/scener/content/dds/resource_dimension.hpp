@@ -0,0 +1,22 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_DDS_RESOURCE_DIMENSION_HPP
+#define SCENER_CONTENT_DDS_RESOURCE_DIMENSION_HPP
+
+#include <cstdint>
+
+namespace scener::content::dds
+{
+    /// Identifies the type of resource described by the DDS_HEADER_DXT10 extended header.
+    enum class resource_dimension : std::uint32_t
+    {
+        unknown   = 0 ///< Resource is of unknown type.
+      , buffer    = 1 ///< Resource is a buffer.
+      , texture1d = 2 ///< Resource is a 1D texture.
+      , texture2d = 3 ///< Resource is a 2D texture.
+      , texture3d = 4 ///< Resource is a 3D texture.
+    };
+}
+
+#endif // SCENER_CONTENT_DDS_RESOURCE_DIMENSION_HPP
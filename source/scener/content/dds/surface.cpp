@@ -3,25 +3,149 @@
 
 #include "scener/content/dds/surface.hpp"
 
+#include <algorithm>
+#include <cstring>
+
+#include "scener/content/dds/block_compression.hpp"
 #include "scener/content/dds/header.hpp"
+#include "scener/content/dds/header_dxt10.hpp"
 #include "scener/io/file.hpp"
+#include "scener/io/memory_mapped_file.hpp"
 
 namespace scener::content::dds
 {
     using scener::graphics::surface_format;
-    using scener::io::file_stream;
+
+    // Legacy pixel formats carry no color space, color data is assumed to be sRGB encoded
+    static surface_format legacy_surface_format(const pixel_format& format) noexcept
+    {
+        if ((format.flags & pixel_format_flags::fourcc) == pixel_format_flags::fourcc)
+        {
+            switch (format.fourcc)
+            {
+            case fourcc::dxt1:
+                return surface_format::dxt1_srgb;
+            case fourcc::dxt2:
+            case fourcc::dxt3:
+                return surface_format::dxt3_srgb;
+            case fourcc::dxt4:
+            case fourcc::dxt5:
+                return surface_format::dxt5_srgb;
+            case fourcc::ati1:
+            case fourcc::bc4u:
+                return surface_format::bc4;
+            case fourcc::ati2:
+            case fourcc::bc5u:
+                return surface_format::bc5;
+            case fourcc::a16b16g16r16f:
+                return surface_format::half_vector4;
+            default:
+                break;
+            }
+        }
+        else if ((format.flags & pixel_format_flags::rgb) == pixel_format_flags::rgb && format.rgb_bit_count == 32)
+        {
+            if (format.red_mask == 0x000000FF && format.green_mask == 0x0000FF00 && format.blue_mask == 0x00FF0000)
+            {
+                return surface_format::color_srgb;
+            }
+            if (format.red_mask == 0x00FF0000 && format.green_mask == 0x0000FF00 && format.blue_mask == 0x000000FF)
+            {
+                return surface_format::bgra32_srgb;
+            }
+        }
+
+        // unsupported pixel format
+        Ensures(false);
+
+        return surface_format::color;
+    }
+
+    static surface_format dxgi_surface_format(dxgi_format format) noexcept
+    {
+        switch (format)
+        {
+        case dxgi_format::r8g8b8a8_unorm:
+            return surface_format::color;
+        case dxgi_format::r8g8b8a8_unorm_srgb:
+            return surface_format::color_srgb;
+        case dxgi_format::b8g8r8a8_unorm:
+            return surface_format::bgra32;
+        case dxgi_format::b8g8r8a8_unorm_srgb:
+            return surface_format::bgra32_srgb;
+        case dxgi_format::r16g16b16a16_float:
+            return surface_format::half_vector4;
+        case dxgi_format::bc1_unorm:
+            return surface_format::dxt1;
+        case dxgi_format::bc1_unorm_srgb:
+            return surface_format::dxt1_srgb;
+        case dxgi_format::bc2_unorm:
+            return surface_format::dxt3;
+        case dxgi_format::bc2_unorm_srgb:
+            return surface_format::dxt3_srgb;
+        case dxgi_format::bc3_unorm:
+            return surface_format::dxt5;
+        case dxgi_format::bc3_unorm_srgb:
+            return surface_format::dxt5_srgb;
+        case dxgi_format::bc4_unorm:
+            return surface_format::bc4;
+        case dxgi_format::bc5_unorm:
+            return surface_format::bc5;
+        case dxgi_format::bc6h_uf16:
+            return surface_format::bc6h;
+        case dxgi_format::bc6h_sf16:
+            return surface_format::bc6h_signed;
+        case dxgi_format::bc7_unorm:
+            return surface_format::bc7;
+        case dxgi_format::bc7_unorm_srgb:
+            return surface_format::bc7_srgb;
+        default:
+            break;
+        }
+
+        // unsupported DXGI format
+        Ensures(false);
+
+        return surface_format::color;
+    }
+
+    surface::surface(surface_format              format
+                   , size_type                   width
+                   , size_type                   height
+                   , size_type                   levels
+                   , size_type                   layers
+                   , bool                        cubemap
+                   , std::vector<std::uint8_t>&& data) noexcept
+        : _mapping { nullptr }
+        , _storage { std::make_shared<std::vector<std::uint8_t>>(std::move(data)) }
+        , _layers  { }
+        , _view    { }
+        , _format  { format }
+        , _width   { width }
+        , _height  { height }
+        , _cubemap { cubemap }
+    {
+        Expects(levels > 0 && layers > 0);
+
+        _view = gsl::span<const std::uint8_t>(_storage->data(), static_cast<std::ptrdiff_t>(_storage->size()));
+
+        create_mipmaps(levels, layers);
+    }
 
     void surface::load(const std::string& filename) noexcept
     {
         Expects(scener::io::file::exists(filename));
 
-        auto      stream     = file_stream(filename);
-        header    dds_header = { };
-        size_type block_size = 16;
+        auto         mapping     = std::make_shared<io::memory_mapped_file>(filename);
+        auto         contents    = mapping->data();
+        header       dds_header  = { };
+        header_dxt10 dxt10       = { };
+        auto         header_size = sizeof dds_header;
 
-        Ensures(stream.length() >= sizeof dds_header);
+        Ensures(mapping->is_open());
+        Ensures(mapping->size() >= sizeof dds_header);
 
-        stream.read(reinterpret_cast<char*>(&dds_header), 0, sizeof dds_header);
+        std::memcpy(&dds_header, contents.data(), sizeof dds_header);
 
         // ensure contents are in DDS format
         Ensures(dds_header.magic == 0x20534444);
@@ -32,70 +156,140 @@ namespace scener::content::dds
         Ensures((dds_header.flags & header_flags::height)      == header_flags::height);
         Ensures((dds_header.flags & header_flags::width)       == header_flags::width);
 
-        if (dds_header.mipmap_count > 0)
+        if (dds_header.mipmap_count > 1)
         {
             Ensures((dds_header.flags & header_flags::mipmapcount) == header_flags::mipmapcount);
-            Ensures((dds_header.flags & header_flags::linearsize)  == header_flags::linearsize);
         }
 
         // ensure pixel format size is correct
         Ensures(dds_header.pixel_format.size == 32);
 
-        // ensure the texture is in compressed format
-        Ensures((dds_header.pixel_format.flags & pixel_format_flags::fourcc) == pixel_format_flags::fourcc);
+        // volume textures are not supported
+        Ensures((dds_header.caps2 & static_cast<std::uint32_t>(caps2::volume)) == 0);
 
-        // check DXTn format
-        Ensures(dds_header.pixel_format.fourcc == fourcc::dxt1
-             || dds_header.pixel_format.fourcc == fourcc::dxt3
-             || dds_header.pixel_format.fourcc == fourcc::dxt5);
+        const auto is_fourcc = (dds_header.pixel_format.flags & pixel_format_flags::fourcc) == pixel_format_flags::fourcc;
+        auto       layers    = size_type { 1 };
 
-        // process dds contents
-        _height = dds_header.height;
-        _width  = dds_header.width;
+        if (is_fourcc && dds_header.pixel_format.fourcc == fourcc::dx10)
+        {
+            // DX10 extended header, holds the DXGI format and the array size
+            Ensures(mapping->size() >= sizeof dds_header + sizeof dxt10);
+
+            std::memcpy(&dxt10, contents.data() + sizeof dds_header, sizeof dxt10);
 
-        if (dds_header.pixel_format.fourcc == fourcc::dxt1)
+            Ensures(dxt10.resource_dimension == resource_dimension::texture2d);
+
+            header_size += sizeof dxt10;
+            layers       = std::max<size_type>(1, dxt10.array_size);
+            _cubemap     = (dxt10.misc_flag & header_dxt10::misc_texturecube) == header_dxt10::misc_texturecube;
+            _format      = dxgi_surface_format(dxt10.dxgi_format);
+        }
+        else
         {
-            _format   = surface_format::dxt1;
-            block_size = 8;
+            _cubemap = (dds_header.caps2 & static_cast<std::uint32_t>(caps2::cubemap)) != 0;
+            _format  = legacy_surface_format(dds_header.pixel_format);
+
+            if (_cubemap)
+            {
+                // partial cube maps are not supported
+                constexpr auto all_faces = static_cast<std::uint32_t>(caps2::cubemap_positivex | caps2::cubemap_negativex
+                                                                    | caps2::cubemap_positivey | caps2::cubemap_negativey
+                                                                    | caps2::cubemap_positivez | caps2::cubemap_negativez);
+
+                Ensures((dds_header.caps2 & all_faces) == all_faces);
+            }
         }
-        else if (dds_header.pixel_format.fourcc == fourcc::dxt3)
+
+        if (_cubemap)
         {
-            _format = surface_format::dxt3;
+            layers *= 6;
         }
-        else if (dds_header.pixel_format.fourcc == fourcc::dxt5)
+
+        // process dds contents
+        _height = dds_header.height;
+        _width  = dds_header.width;
+
+        const auto levels = std::max<size_type>(1, dds_header.mipmap_count);
+        const auto length = mapping->size() - header_size;
+
+        // mipmaps are views of the mapping, the staging buffer upload is the only copy
+        _mapping = mapping;
+        _storage = nullptr;
+        _view    = contents.subspan(static_cast<std::ptrdiff_t>(header_size), static_cast<std::ptrdiff_t>(length));
+
+        create_mipmaps(levels, layers);
+    }
+
+    surface surface::transform(surface_format format) const noexcept
+    {
+        Expects(can_transform(_format, format));
+
+        const auto decode = (format == surface_format::color || format == surface_format::color_srgb);
+        auto       length = std::size_t { 0 };
+
+        for (const auto& mipmap : mipmaps())
         {
-            _format = surface_format::dxt5;
+            length += mipmap_size(format, mipmap.width(), mipmap.height());
         }
 
-        size_type mipmap_width  = _width;
-        size_type mipmap_height = _height;
-        auto      position      = size_type { 0 };
-        auto      length        = stream.length() - sizeof dds_header;
+        std::vector<std::uint8_t> data(length * layer_count());
+
+        auto position = std::size_t { 0 };
+
+        for (const auto& layer : _layers)
+        {
+            for (const auto& mipmap : layer)
+            {
+                const auto size   = mipmap_size(format, mipmap.width(), mipmap.height());
+                const auto target = gsl::span<std::uint8_t>(data.data() + position, static_cast<std::ptrdiff_t>(size));
 
-        _mipmaps.clear();
-        _buffer.clear();
-        _view = { };
+                if (decode)
+                {
+                    block_compression::decode(_format, mipmap.width(), mipmap.height(), mipmap.view(), target);
+                }
+                else
+                {
+                    block_compression::encode(format, mipmap.width(), mipmap.height(), mipmap.view(), target);
+                }
 
-        _mipmaps.reserve(dds_header.mipmap_count);
-        _buffer.reserve(length);
+                position += size;
+            }
+        }
 
-        auto readed = stream.read(reinterpret_cast<char*>(_buffer.data()), 0, length);
+        return { format, _width, _height, level_count(), layer_count(), _cubemap, std::move(data) };
+    }
 
-        Ensures(readed == length);
+    void surface::create_mipmaps(size_type levels, size_type layers) noexcept
+    {
+        const auto length   = static_cast<std::size_t>(_view.size());
+        auto       position = std::size_t { 0 };
 
-        _view = gsl::span<std::uint8_t>(_buffer.data(), static_cast<std::ptrdiff_t>(length));
+        _layers.clear();
+        _layers.resize(layers);
 
-        for (size_type level = 0; level < dds_header.mipmap_count; ++level)
+        // layers are stored one after another, each one with its full mipmap chain
+        for (auto& mipmaps : _layers)
         {
-            auto size = std::max<size_type>(4, mipmap_width) / 4 * std::max<size_type>(4, mipmap_height) / 4 * block_size;
-            auto view = _view.subspan(static_cast<std::ptrdiff_t>(position), static_cast<std::ptrdiff_t>(size));
+            size_type mipmap_width  = _width;
+            size_type mipmap_height = _height;
+
+            mipmaps.reserve(levels);
+
+            for (size_type level = 0; level < levels; ++level)
+            {
+                auto size = mipmap_size(_format, mipmap_width, mipmap_height);
+
+                Ensures(position + size <= length);
 
-            _mipmaps.push_back({ level, mipmap_width, mipmap_height, view });
+                auto view = _view.subspan(static_cast<std::ptrdiff_t>(position), static_cast<std::ptrdiff_t>(size));
 
-            mipmap_width  = std::max<size_type>(1, mipmap_width  >> 1);
-            mipmap_height = std::max<size_type>(1, mipmap_height >> 1);
+                mipmaps.push_back({ level, mipmap_width, mipmap_height, view });
 
-            position += size;
+                mipmap_width  = std::max<size_type>(1, mipmap_width  >> 1);
+                mipmap_height = std::max<size_type>(1, mipmap_height >> 1);
+
+                position += size;
+            }
         }
     }
 
@@ -114,15 +308,124 @@ namespace scener::content::dds
         return _height;
     }
 
+    surface::size_type surface::layer_count() const noexcept
+    {
+        return static_cast<size_type>(_layers.size());
+    }
+
+    surface::size_type surface::level_count() const noexcept
+    {
+        return (_layers.empty()) ? 0 : static_cast<size_type>(_layers.front().size());
+    }
+
+    bool surface::is_cubemap() const noexcept
+    {
+        return _cubemap;
+    }
+
     const std::vector<surface_mipmap>& surface::mipmaps() const noexcept
     {
-        return _mipmaps;
+        return mipmaps(0);
+    }
+
+    const std::vector<surface_mipmap>& surface::mipmaps(std::uint32_t layer) const noexcept
+    {
+        Expects(layer < _layers.size());
+
+        return _layers[layer];
     }
 
     const surface_mipmap& surface::mipmap(std::uint32_t index) const noexcept
     {
-        Expects(index <= _mipmaps.size());
+        Expects(index < level_count());
+
+        return _layers.front()[index];
+    }
 
-        return _mipmaps[index];
+    std::size_t surface::mipmap_size(surface_format format, size_type width, size_type height) noexcept
+    {
+        switch (format)
+        {
+        case surface_format::dxt1:
+        case surface_format::dxt1_srgb:
+        case surface_format::bc4:
+            return std::size_t { std::max<size_type>(1, (width + 3) / 4) } * std::max<size_type>(1, (height + 3) / 4) * 8;
+
+        case surface_format::dxt3:
+        case surface_format::dxt3_srgb:
+        case surface_format::dxt5:
+        case surface_format::dxt5_srgb:
+        case surface_format::bc5:
+        case surface_format::bc6h:
+        case surface_format::bc6h_signed:
+        case surface_format::bc7:
+        case surface_format::bc7_srgb:
+            return std::size_t { std::max<size_type>(1, (width + 3) / 4) } * std::max<size_type>(1, (height + 3) / 4) * 16;
+
+        case surface_format::half_vector4:
+        case surface_format::rgba64:
+            return std::size_t { width } * height * 8;
+
+        case surface_format::bgr565:
+        case surface_format::bgra5551:
+        case surface_format::bgra4444:
+        case surface_format::normalized_byte2:
+            return std::size_t { width } * height * 2;
+
+        default:
+            return std::size_t { width } * height * 4;
+        }
+    }
+
+    bool surface::can_transform(surface_format source, surface_format target) noexcept
+    {
+        if (target == surface_format::color || target == surface_format::color_srgb)
+        {
+            return (is_srgb(source) == is_srgb(target) && block_compression::can_decode(source));
+        }
+
+        return ((source == surface_format::color || source == surface_format::color_srgb)
+             && is_srgb(source) == is_srgb(target)
+             && block_compression::can_encode(target));
+    }
+
+    bool surface::is_compressed(surface_format format) noexcept
+    {
+        switch (format)
+        {
+        case surface_format::dxt1:
+        case surface_format::dxt1_srgb:
+        case surface_format::dxt3:
+        case surface_format::dxt3_srgb:
+        case surface_format::dxt5:
+        case surface_format::dxt5_srgb:
+        case surface_format::bc4:
+        case surface_format::bc5:
+        case surface_format::bc6h:
+        case surface_format::bc6h_signed:
+        case surface_format::bc7:
+        case surface_format::bc7_srgb:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    bool surface::is_srgb(surface_format format) noexcept
+    {
+        switch (format)
+        {
+        case surface_format::color_srgb:
+        case surface_format::bgra32_srgb:
+        case surface_format::dxt1_srgb:
+        case surface_format::dxt3_srgb:
+        case surface_format::dxt5_srgb:
+        case surface_format::bc7_srgb:
+            return true;
+
+        default:
+            return false;
+        }
     }
 }
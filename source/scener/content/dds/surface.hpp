@@ -5,16 +5,20 @@
 #define SCENER_CONTENT_DDS_SURFACE_HPP
 
 #include <cstddef>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <gsl/gsl>
 
 #include "scener/content/dds/surface_mipmap.hpp"
 #include "scener/graphics/surface_format.hpp"
+#include "scener/io/memory_mapped_file.hpp"
 
 namespace scener::content::dds
 {
-    /// Represents a DirectDraw surface.
+    /// Represents a DirectDraw surface; a single texture, a texture array or a cube map (six faces per cube, in
+    /// +X, -X, +Y, -Y, +Z, -Z order), each layer with its own mipmap chain.
     class surface final
     {
     public:
@@ -24,10 +28,33 @@ namespace scener::content::dds
         /// Initializes a new instance of the Surface class.
         surface() = default;
 
+        /// Initializes a new instance of the Surface class with the given data; layers are stored one after another,
+        /// each one with its full mipmap chain.
+        /// \param format the surface format.
+        /// \param width the surface width (in pixels).
+        /// \param height the surface height (in pixels).
+        /// \param levels the number of mipmaps of each layer.
+        /// \param layers the number of array layers, six per cube for cube maps.
+        /// \param cubemap a value indicating whether the layers are cube map faces.
+        /// \param data the surface data.
+        surface(scener::graphics::surface_format format
+              , size_type                        width
+              , size_type                        height
+              , size_type                        levels
+              , size_type                        layers
+              , bool                             cubemap
+              , std::vector<std::uint8_t>&&      data) noexcept;
+
     public:
-        /// Loads the given file.
+        /// Loads the given file; the file is mapped into memory and the mipmaps are views of the mapping.
         void load(const std::string& filename) noexcept;
 
+        /// Converts every layer and mipmap of this surface to the given format; block compressed surfaces can be
+        /// decoded to color, and color surfaces can be encoded to DXT1 or DXT5.
+        /// \param format the target surface format.
+        /// \returns a new surface with the converted data.
+        surface transform(scener::graphics::surface_format format) const noexcept;
+
     public:
         /// Gets the surface format.
         scener::graphics::surface_format format() const noexcept;
@@ -38,19 +65,57 @@ namespace scener::content::dds
         /// Gets the surface height (in pixels).
         size_type height() const noexcept;
 
-        /// Gets the surface mipmaps (when available).
+        /// Gets the number of array layers, six per cube for cube maps.
+        size_type layer_count() const noexcept;
+
+        /// Gets the number of mipmaps of each layer.
+        size_type level_count() const noexcept;
+
+        /// Gets a value indicating whether the surface layers are cube map faces.
+        bool is_cubemap() const noexcept;
+
+        /// Gets the mipmaps of the first layer (when available).
         const std::vector<surface_mipmap>& mipmaps() const noexcept;
 
-        /// Gets the mipamap at the given index
+        /// Gets the mipmaps of the given layer.
+        const std::vector<surface_mipmap>& mipmaps(std::uint32_t layer) const noexcept;
+
+        /// Gets the mipamap of the first layer at the given index
         const surface_mipmap& mipmap(std::uint32_t index) const noexcept;
 
+    public:
+        /// Gets the size, in bytes, of a mipmap with the given format and dimensions.
+        /// \param format the surface format.
+        /// \param width the mipmap width (in pixels).
+        /// \param height the mipmap height (in pixels).
+        /// \returns the size, in bytes, of the mipmap data.
+        static std::size_t mipmap_size(scener::graphics::surface_format format, size_type width, size_type height) noexcept;
+
+        /// Gets a value indicating whether the given format is block compressed.
+        static bool is_compressed(scener::graphics::surface_format format) noexcept;
+
+        /// Gets a value indicating whether the color channels of the given format are sRGB encoded.
+        static bool is_srgb(scener::graphics::surface_format format) noexcept;
+
+        /// Gets a value indicating whether surfaces can be transformed between the given formats; the transform
+        /// keeps the color space, so both formats must be either linear or sRGB.
+        /// \param source the format of the surface being transformed.
+        /// \param target the target format.
+        /// \returns true if surfaces with the source format can be transformed to the target format; false otherwise.
+        static bool can_transform(scener::graphics::surface_format source, scener::graphics::surface_format target) noexcept;
+
+    private:
+        void create_mipmaps(size_type levels, size_type layers) noexcept;
+
     private:
-        std::vector<std::uint8_t>        _buffer  { };
-        std::vector<surface_mipmap>      _mipmaps { };
-        gsl::span<std::uint8_t>          _view    { };
-        scener::graphics::surface_format _format  { scener::graphics::surface_format::color };
-        size_type                        _width   { 0 };
-        size_type                        _height  { 0 };
+        std::shared_ptr<io::memory_mapped_file>    _mapping { nullptr };
+        std::shared_ptr<std::vector<std::uint8_t>> _storage { nullptr };
+        std::vector<std::vector<surface_mipmap>>   _layers  { };
+        gsl::span<const std::uint8_t>              _view    { };
+        scener::graphics::surface_format           _format  { scener::graphics::surface_format::color };
+        size_type                                  _width   { 0 };
+        size_type                                  _height  { 0 };
+        bool                                       _cubemap { false };
     };
 }
 
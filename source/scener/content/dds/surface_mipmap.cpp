@@ -5,7 +5,7 @@
 
 namespace scener::content::dds
 {
-    surface_mipmap::surface_mipmap(index_type index, size_type width, size_type height, const gsl::span<std::uint8_t>& view) noexcept
+    surface_mipmap::surface_mipmap(index_type index, size_type width, size_type height, const gsl::span<const std::uint8_t>& view) noexcept
         : _index  { index  }
         , _width  { width  }
         , _height { height }
@@ -28,7 +28,7 @@ namespace scener::content::dds
         return _height;
     }
 
-    const gsl::span<std::uint8_t>& surface_mipmap::view() const noexcept
+    const gsl::span<const std::uint8_t>& surface_mipmap::view() const noexcept
     {
         return _view;
     }
@@ -24,7 +24,7 @@ namespace scener::content::dds
         /// \param width  The mipmap width (in pixels).
         /// \param height The mipmap height (in pixels).
         /// \param view   A view to the mipmap data.
-        surface_mipmap(index_type index, size_type width, size_type height, const gsl::span<std::uint8_t>& view) noexcept;
+        surface_mipmap(index_type index, size_type width, size_type height, const gsl::span<const std::uint8_t>& view) noexcept;
 
     public:
         /// Gets the mipmap index.
@@ -37,13 +37,13 @@ namespace scener::content::dds
         size_type  height() const noexcept;
 
         /// Gets a view to the mipmap data.
-        const gsl::span<std::uint8_t>& view() const noexcept;
+        const gsl::span<const std::uint8_t>& view() const noexcept;
 
     private:
-        index_type              _index;
-        size_type               _width;
-        size_type               _height;
-        gsl::span<std::uint8_t> _view;
+        index_type                    _index;
+        size_type                     _width;
+        size_type                     _height;
+        gsl::span<const std::uint8_t> _view;
     };
 }
 
@@ -0,0 +1,231 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/content/dds/texture_atlas.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#include <gsl/gsl>
+
+namespace scener::content::dds
+{
+    using scener::graphics::surface_format;
+
+    namespace
+    {
+        inline std::uint32_t align_up(std::uint32_t value, std::uint32_t alignment) noexcept
+        {
+            return ((value + alignment - 1) / alignment) * alignment;
+        }
+
+        inline std::uint32_t next_power_of_two(std::uint32_t value) noexcept
+        {
+            std::uint32_t result = 1;
+
+            while (result < value)
+            {
+                result <<= 1;
+            }
+
+            return result;
+        }
+    }
+
+    texture_atlas::texture_atlas(surface_format format, size_type max_size) noexcept
+        : texture_atlas(format, max_size, 1)
+    {
+    }
+
+    texture_atlas::texture_atlas(surface_format format, size_type max_size, size_type padding) noexcept
+        : _format    { format }
+        , _max_size  { max_size }
+        , _alignment { surface::is_compressed(format) ? 4u : 1u }
+        , _padding   { align_up(padding, _alignment) }
+        , _atlas     { }
+        , _regions   { }
+    {
+        Expects(max_size > 0 && (max_size % _alignment) == 0);
+    }
+
+    surface_format texture_atlas::format() const noexcept
+    {
+        return _format;
+    }
+
+    texture_atlas::size_type texture_atlas::max_size() const noexcept
+    {
+        return _max_size;
+    }
+
+    texture_atlas::size_type texture_atlas::padding() const noexcept
+    {
+        return _padding;
+    }
+
+    bool texture_atlas::pack(const std::vector<const surface*>& surfaces) noexcept
+    {
+        Expects(!surfaces.empty());
+
+        std::uint64_t area     = 0;
+        size_type     min_size = _alignment;
+
+        for (const auto source : surfaces)
+        {
+            Expects(source != nullptr && source->format() == _format && source->level_count() > 0);
+
+            const auto width  = align_up(source->width() , _alignment) + _padding * 2;
+            const auto height = align_up(source->height(), _alignment) + _padding * 2;
+
+            area    += std::uint64_t { width } * height;
+            min_size = std::max({ min_size, width, height });
+        }
+
+        // Start from the smallest square holding the total area and grow one side at a time
+        const auto side   = static_cast<size_type>(std::ceil(std::sqrt(static_cast<double>(area))));
+        auto       width  = next_power_of_two(std::max(min_size, side));
+        auto       height = width;
+
+        std::vector<atlas_region> regions;
+
+        while (width <= _max_size && height <= _max_size)
+        {
+            if (place(surfaces, width, height, regions))
+            {
+                break;
+            }
+
+            if (width > height)
+            {
+                height <<= 1;
+            }
+            else
+            {
+                width <<= 1;
+            }
+        }
+
+        if (regions.empty())
+        {
+            return false;
+        }
+
+        // Copy the rows of blocks (pixels for uncompressed formats) of each surface first mipmap into its region
+        const auto block_bytes = surface::mipmap_size(_format, _alignment, _alignment);
+        const auto atlas_pitch = (width / _alignment) * block_bytes;
+        const auto gutter      = _padding / _alignment;
+
+        std::vector<std::uint8_t> data(surface::mipmap_size(_format, width, height), 0);
+
+        const auto block = [&] (size_type x, size_type y) -> std::uint8_t* {
+            return data.data() + y * atlas_pitch + x * block_bytes;
+        };
+
+        for (std::size_t i = 0; i < surfaces.size(); ++i)
+        {
+            const auto& region   = regions[i];
+            const auto& mipmap   = surfaces[i]->mipmap(0);
+            const auto  blocks_x = std::max<size_type>(1, (mipmap.width()  + _alignment - 1) / _alignment);
+            const auto  blocks_y = std::max<size_type>(1, (mipmap.height() + _alignment - 1) / _alignment);
+            const auto  pitch    = blocks_x * block_bytes;
+            const auto  left     = region.x / _alignment;
+            const auto  top      = region.y / _alignment;
+
+            Ensures(static_cast<std::size_t>(mipmap.view().size()) >= pitch * blocks_y);
+
+            for (size_type row = 0; row < blocks_y; ++row)
+            {
+                std::memcpy(block(left, top + row), mipmap.view().data() + row * pitch, pitch);
+
+                // Left and right gutters repeat the first and last blocks of the row
+                for (size_type column = 1; column <= gutter; ++column)
+                {
+                    std::memcpy(block(left - column, top + row), block(left, top + row), block_bytes);
+                    std::memcpy(block(left + blocks_x - 1 + column, top + row), block(left + blocks_x - 1, top + row), block_bytes);
+                }
+            }
+
+            // Top and bottom gutters repeat the first and last rows, gutter corners included
+            const auto row_bytes = (blocks_x + gutter * 2) * block_bytes;
+
+            for (size_type row = 1; row <= gutter; ++row)
+            {
+                std::memcpy(block(left - gutter, top - row), block(left - gutter, top), row_bytes);
+                std::memcpy(block(left - gutter, top + blocks_y - 1 + row), block(left - gutter, top + blocks_y - 1), row_bytes);
+            }
+        }
+
+        for (auto& region : regions)
+        {
+            region.u_offset = static_cast<float>(region.x)      / static_cast<float>(width);
+            region.v_offset = static_cast<float>(region.y)      / static_cast<float>(height);
+            region.u_scale  = static_cast<float>(region.width)  / static_cast<float>(width);
+            region.v_scale  = static_cast<float>(region.height) / static_cast<float>(height);
+        }
+
+        _atlas   = surface(_format, width, height, 1, 1, false, std::move(data));
+        _regions = std::move(regions);
+
+        return true;
+    }
+
+    const surface& texture_atlas::atlas() const noexcept
+    {
+        return _atlas;
+    }
+
+    const std::vector<atlas_region>& texture_atlas::regions() const noexcept
+    {
+        return _regions;
+    }
+
+    bool texture_atlas::place(const std::vector<const surface*>& surfaces
+                            , size_type                          width
+                            , size_type                          height
+                            , std::vector<atlas_region>&         regions) const noexcept
+    {
+        std::vector<std::size_t> order(surfaces.size());
+
+        std::iota(order.begin(), order.end(), 0);
+
+        // Tallest first keeps the shelves tight
+        std::stable_sort(order.begin(), order.end(), [&] (std::size_t a, std::size_t b) -> bool {
+            return surfaces[a]->height() > surfaces[b]->height();
+        });
+
+        regions.assign(surfaces.size(), atlas_region());
+
+        size_type x     = 0;
+        size_type y     = 0;
+        size_type shelf = 0;
+
+        for (const auto index : order)
+        {
+            const auto& source = *surfaces[index];
+            const auto  w      = align_up(source.width() , _alignment) + _padding * 2;
+            const auto  h      = align_up(source.height(), _alignment) + _padding * 2;
+
+            if (x + w > width)
+            {
+                x     = 0;
+                y    += shelf;
+                shelf = 0;
+            }
+
+            if (x + w > width || y + h > height)
+            {
+                regions.clear();
+                return false;
+            }
+
+            regions[index] = { x + _padding, y + _padding, source.width(), source.height() };
+
+            x    += w;
+            shelf = std::max(shelf, h);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,97 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_DDS_TEXTURE_ATLAS_HPP
+#define SCENER_CONTENT_DDS_TEXTURE_ATLAS_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "scener/content/dds/surface.hpp"
+
+namespace scener::content::dds
+{
+    /// The placement of a packed surface inside a texture atlas.
+    struct atlas_region
+    {
+        /// The horizontal offset of the region (in pixels).
+        std::uint32_t x { 0 };
+        /// The vertical offset of the region (in pixels).
+        std::uint32_t y { 0 };
+        /// The region width (in pixels).
+        std::uint32_t width { 0 };
+        /// The region height (in pixels).
+        std::uint32_t height { 0 };
+        /// The texture coordinate offset, u' = u * u_scale + u_offset.
+        float u_offset { 0.0f };
+        /// The texture coordinate offset, v' = v * v_scale + v_offset.
+        float v_offset { 0.0f };
+        /// The texture coordinate scale.
+        float u_scale { 1.0f };
+        /// The texture coordinate scale.
+        float v_scale { 1.0f };
+    };
+
+    /// Offline packer of small surfaces into a single atlas surface.
+    /// Surfaces are placed on shelves, tallest first, in the smallest power of two atlas that holds them all.
+    /// Block compressed surfaces are placed on 4 pixel boundaries so their blocks are copied untouched. Only the
+    /// first mipmap of each surface is packed.
+    /// Each region is surrounded by a gutter that replicates its edge texels (its edge blocks, for block compressed
+    /// surfaces), so filtering at the region edges never samples the neighbouring regions.
+    class texture_atlas final
+    {
+    public:
+        typedef surface::size_type size_type;
+
+    public:
+        /// Initializes a new instance of the texture_atlas class, with a one pixel gutter (one block for block
+        /// compressed formats) around each region.
+        /// \param format the format of the packed surfaces.
+        /// \param max_size the maximum atlas width and height (in pixels).
+        texture_atlas(scener::graphics::surface_format format, size_type max_size) noexcept;
+
+        /// Initializes a new instance of the texture_atlas class.
+        /// \param format the format of the packed surfaces.
+        /// \param max_size the maximum atlas width and height (in pixels).
+        /// \param padding the gutter width around each region (in pixels), rounded up to whole blocks for block
+        ///        compressed formats.
+        texture_atlas(scener::graphics::surface_format format, size_type max_size, size_type padding) noexcept;
+
+    public:
+        /// Gets the format of the packed surfaces.
+        scener::graphics::surface_format format() const noexcept;
+
+        /// Gets the maximum atlas width and height (in pixels).
+        size_type max_size() const noexcept;
+
+        /// Gets the gutter width around each region (in pixels).
+        size_type padding() const noexcept;
+
+        /// Packs the given surfaces into a new atlas.
+        /// \param surfaces the surfaces to pack, all of them with the atlas format.
+        /// \returns true if the surfaces fit in an atlas of at most max_size pixels; false otherwise.
+        bool pack(const std::vector<const surface*>& surfaces) noexcept;
+
+        /// Gets the atlas built by the last successful call to pack.
+        const surface& atlas() const noexcept;
+
+        /// Gets the placement of each packed surface, in the order they were given to pack.
+        const std::vector<atlas_region>& regions() const noexcept;
+
+    private:
+        bool place(const std::vector<const surface*>& surfaces
+                 , size_type                          width
+                 , size_type                          height
+                 , std::vector<atlas_region>&         regions) const noexcept;
+
+    private:
+        scener::graphics::surface_format _format;
+        size_type                        _max_size;
+        size_type                        _alignment;
+        size_type                        _padding;
+        surface                          _atlas;
+        std::vector<atlas_region>        _regions;
+    };
+}
+
+#endif // SCENER_CONTENT_DDS_TEXTURE_ATLAS_HPP
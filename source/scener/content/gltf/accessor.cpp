@@ -3,6 +3,10 @@
 
 #include "scener/content/gltf/accessor.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 #include "scener/content/gltf/buffer_view.hpp"
 
 namespace scener::content::gltf
@@ -18,10 +22,56 @@ namespace scener::content::gltf
         , _byte_length     { 0 }
         , _byte_stride     { 0 }
         , _component_type  { component_type::single }
-        , _max             { 0 }
-        , _min             { 0 }
+        , _max             { }
+        , _min             { }
+        , _name            { }
+    {
+    }
+
+    accessor::accessor(gltf::attribute_type                gltf_attribute_type
+                     , gltf::component_type                gltf_component_type
+                     , const std::shared_ptr<buffer_view>& buffer_view
+                     , std::uint32_t                       byte_offset
+                     , std::uint32_t                       attribute_count
+                     , std::uint32_t                       byte_stride) noexcept
+        : _attribute_type  { gltf_attribute_type }
+        , _attribute_count { attribute_count }
+        , _buffer_view     { buffer_view }
+        , _byte_offset     { byte_offset }
+        , _byte_length     { 0 }
+        , _byte_stride     { byte_stride }
+        , _component_type  { gltf_component_type }
+        , _max             { }
+        , _min             { }
+        , _name            { }
+    {
+        _byte_length = _attribute_count * get_attribute_type_count() * get_component_size_in_bytes();
+
+        compute_min_max();
+    }
+
+    accessor::accessor(gltf::attribute_type                gltf_attribute_type
+                     , gltf::component_type                gltf_component_type
+                     , const std::shared_ptr<buffer_view>& buffer_view
+                     , std::uint32_t                       byte_offset
+                     , std::uint32_t                       attribute_count
+                     , std::uint32_t                       byte_stride
+                     , const std::vector<float>&           min
+                     , const std::vector<float>&           max) noexcept
+        : _attribute_type  { gltf_attribute_type }
+        , _attribute_count { attribute_count }
+        , _buffer_view     { buffer_view }
+        , _byte_offset     { byte_offset }
+        , _byte_length     { 0 }
+        , _byte_stride     { byte_stride }
+        , _component_type  { gltf_component_type }
+        , _max             { }
+        , _min             { }
         , _name            { }
     {
+        _byte_length = _attribute_count * get_attribute_type_count() * get_component_size_in_bytes();
+
+        set_min_max(min, max);
     }
 
     attribute_type accessor::attribute_type() const noexcept
@@ -78,4 +128,86 @@ namespace scener::content::gltf
     {
         return _buffer_view->get_data(_byte_offset + (offset * byte_stride()), count * byte_stride());
     }
+
+    void accessor::set_min_max(const std::vector<float>& min, const std::vector<float>& max) noexcept
+    {
+        const auto component_count = get_attribute_type_count();
+
+        // Bounds are optional for non vertex attributes
+        if (min.size() != component_count || max.size() != component_count)
+        {
+            compute_min_max();
+            return;
+        }
+
+        _min = min;
+        _max = max;
+    }
+
+    void accessor::compute_min_max() noexcept
+    {
+        const auto component_count = get_attribute_type_count();
+        const auto stride          = byte_stride();
+
+        _min.assign(component_count,  std::numeric_limits<float>::max());
+        _max.assign(component_count, -std::numeric_limits<float>::max());
+
+        if (_attribute_count == 0 || _buffer_view == nullptr)
+        {
+            std::fill(_min.begin(), _min.end(), 0.0f);
+            std::fill(_max.begin(), _max.end(), 0.0f);
+            return;
+        }
+
+        const auto data = get_data();
+
+        for (std::uint32_t i = 0; i < _attribute_count; ++i)
+        {
+            const auto element = data.data() + i * stride;
+
+            for (std::uint32_t c = 0; c < component_count; ++c)
+            {
+                const auto value = get_component(element, c);
+
+                _min[c] = std::min(_min[c], value);
+                _max[c] = std::max(_max[c], value);
+            }
+        }
+    }
+
+    float accessor::get_component(const std::uint8_t* element, std::uint32_t component) const noexcept
+    {
+        const auto source = element + component * get_component_size_in_bytes();
+
+        switch (_component_type)
+        {
+        case gltf::component_type::byte:
+            return static_cast<float>(*reinterpret_cast<const std::int8_t*>(source));
+
+        case gltf::component_type::ubyte:
+            return static_cast<float>(*source);
+
+        case gltf::component_type::int16:
+        {
+            std::int16_t value;
+            std::memcpy(&value, source, sizeof value);
+            return static_cast<float>(value);
+        }
+
+        case gltf::component_type::uint16:
+        {
+            std::uint16_t value;
+            std::memcpy(&value, source, sizeof value);
+            return static_cast<float>(value);
+        }
+
+        case gltf::component_type::single:
+        default:
+        {
+            float value;
+            std::memcpy(&value, source, sizeof value);
+            return value;
+        }
+        }
+    }
 }
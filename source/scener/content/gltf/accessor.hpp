@@ -29,6 +29,38 @@ namespace scener::content::gltf
         /// Initializes a new instance of the Accessor class.
         accessor() noexcept;
 
+        /// Initializes a new instance of the Accessor class over the given buffer-view.
+        /// \param gltf_attribute_type the attribute type.
+        /// \param gltf_component_type the data type of the attribute components.
+        /// \param buffer_view the buffer-view that holds the attribute data.
+        /// \param byte_offset the offset relative to the buffer-view in bytes.
+        /// \param attribute_count the number of attributes.
+        /// \param byte_stride the stride, in bytes, between attributes; 0 when the attributes are tightly packed.
+        accessor(gltf::attribute_type                gltf_attribute_type
+               , gltf::component_type                gltf_component_type
+               , const std::shared_ptr<buffer_view>& buffer_view
+               , std::uint32_t                       byte_offset
+               , std::uint32_t                       attribute_count
+               , std::uint32_t                       byte_stride) noexcept;
+
+        /// Initializes a new instance of the Accessor class over the given buffer-view with the given bounds.
+        /// \param gltf_attribute_type the attribute type.
+        /// \param gltf_component_type the data type of the attribute components.
+        /// \param buffer_view the buffer-view that holds the attribute data.
+        /// \param byte_offset the offset relative to the buffer-view in bytes.
+        /// \param attribute_count the number of attributes.
+        /// \param byte_stride the stride, in bytes, between attributes; 0 when the attributes are tightly packed.
+        /// \param min the minimum value of each component; computed from the data when it has not one value per component.
+        /// \param max the maximum value of each component; computed from the data when it has not one value per component.
+        accessor(gltf::attribute_type                gltf_attribute_type
+               , gltf::component_type                gltf_component_type
+               , const std::shared_ptr<buffer_view>& buffer_view
+               , std::uint32_t                       byte_offset
+               , std::uint32_t                       attribute_count
+               , std::uint32_t                       byte_stride
+               , const std::vector<float>&           min
+               , const std::vector<float>&           max) noexcept;
+
     public:
         /// Specifies if the attribute is a scalar, vector, or matrix.
         /// \returns the attribute type.
@@ -92,6 +124,16 @@ namespace scener::content::gltf
             return result;
         }
 
+    private:
+        /// Sets the minimum and maximum value of each component, computing them when either one is missing or malformed.
+        void set_min_max(const std::vector<float>& min, const std::vector<float>& max) noexcept;
+
+        /// Computes the minimum and maximum value of each component by scanning the accessor data.
+        void compute_min_max() noexcept;
+
+        /// Reads a single component of the given element converted to float.
+        float get_component(const std::uint8_t* element, std::uint32_t component) const noexcept;
+
     private:
         constexpr std::uint32_t get_attribute_type_count() const noexcept
         {
@@ -5,6 +5,16 @@
 
 namespace scener::content::gltf
 {
+    buffer::buffer(const std::string& name, const std::vector<std::uint8_t>& data) noexcept
+        : _byte_length { static_cast<std::uint32_t>(data.size()) }
+        , _data        { }
+        , _span        { }
+        , _name        { name }
+        , _uri         { }
+    {
+        set_data(data);
+    }
+
     const std::string& buffer::name() const noexcept
     {
         return _name;
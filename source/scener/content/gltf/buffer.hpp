@@ -22,6 +22,11 @@ namespace scener::content::gltf
         /// Initializes a new instance of the Buffer class.
         buffer() = default;
 
+        /// Initializes a new instance of the Buffer class with the given data.
+        /// \param name the buffer name.
+        /// \param data the buffer data.
+        buffer(const std::string& name, const std::vector<std::uint8_t>& data) noexcept;
+
     public:
         /// Gets the buffer name.
         /// \returns the buffer name.
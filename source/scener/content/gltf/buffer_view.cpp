@@ -7,6 +7,14 @@
 
 namespace scener::content::gltf
 {
+    buffer_view::buffer_view(const std::shared_ptr<buffer>& buffer, std::uint32_t byte_offset, std::uint32_t byte_length) noexcept
+        : _buffer      { buffer }
+        , _byte_offset { byte_offset }
+        , _byte_length { byte_length }
+        , _name        { }
+    {
+    }
+
     std::uint32_t buffer_view::byte_offset() const noexcept
     {
         return _byte_offset;
@@ -25,6 +25,12 @@ namespace scener::content::gltf
         /// Initializes a new instance of the BufferView class.
         buffer_view() = default;
 
+        /// Initializes a new instance of the BufferView class over the given buffer range.
+        /// \param buffer the buffer that holds the data.
+        /// \param byte_offset the offset into the buffer in bytes.
+        /// \param byte_length the length of the buffer-view in bytes.
+        buffer_view(const std::shared_ptr<buffer>& buffer, std::uint32_t byte_offset, std::uint32_t byte_length) noexcept;
+
     public:
         /// Gets the offset into the buffer in bytes.
         std::uint32_t byte_offset() const noexcept;
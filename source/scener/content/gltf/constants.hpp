@@ -62,6 +62,7 @@ namespace scener::content::gltf
     const std::string k_sources = "sources";
     const std::string k_target = "target";
     const std::string k_technique = "technique";
+    const std::string k_textures = "textures";
     const std::string k_time = "TIME";
     const std::string k_type = "type";
     const std::string k_uniforms = "uniforms";    
@@ -0,0 +1,491 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/content/mesh_optimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <gsl/gsl>
+
+#include "scener/content/model_description.hpp"
+
+namespace scener::content
+{
+    using scener::graphics::primitive_type;
+    using scener::graphics::vertex_element_format;
+    using scener::graphics::vertex_element_usage;
+
+    namespace
+    {
+        constexpr auto invalid_vertex = std::numeric_limits<std::uint32_t>::max();
+
+        /// FIFO post transform vertex cache, a vertex is resident while fewer than cache_size misses happened
+        /// after it was loaded.
+        class vertex_cache final
+        {
+        public:
+            explicit vertex_cache(std::uint32_t vertex_count) noexcept
+                : _time      (vertex_count, 0)
+                , _timestamp { mesh_optimizer::cache_size + 1 }
+            {
+            }
+
+        public:
+            std::uint32_t misses(const std::uint32_t* triangle) noexcept
+            {
+                std::uint32_t count = 0;
+
+                for (std::uint32_t k = 0; k < 3; ++k)
+                {
+                    if (_timestamp - _time[triangle[k]] > mesh_optimizer::cache_size)
+                    {
+                        _time[triangle[k]] = _timestamp++;
+                        count++;
+                    }
+                }
+
+                return count;
+            }
+
+            void flush() noexcept
+            {
+                _timestamp += mesh_optimizer::cache_size + 1;
+            }
+
+        private:
+            std::vector<std::uint32_t> _time;
+            std::uint32_t              _timestamp;
+        };
+
+        struct float3
+        {
+            float x;
+            float y;
+            float z;
+        };
+
+        inline float3 position_of(const std::vector<float>& positions, std::uint32_t vertex) noexcept
+        {
+            return { positions[vertex * 3], positions[vertex * 3 + 1], positions[vertex * 3 + 2] };
+        }
+    }
+
+    void mesh_optimizer::optimize(mesh_part_description& part) noexcept
+    {
+        if (part.primitive_type != primitive_type::triangle_list
+         || part.index_count < 3
+         || (part.index_count % 3) != 0
+         || part.vertex_count == 0)
+        {
+            return;
+        }
+
+        const auto element = std::find_if(part.vertex_elements.begin(), part.vertex_elements.end(), [] (const auto& e) -> bool {
+            return e.usage() == vertex_element_usage::position && e.format() == vertex_element_format::vector3;
+        });
+
+        if (element == part.vertex_elements.end())
+        {
+            return;
+        }
+
+        Expects(part.index_data.size() >= part.index_count * sizeof(std::uint16_t));
+        Expects(part.vertex_data.size() >= std::size_t { part.vertex_count } * part.vertex_stride);
+
+        // Mesh parts are indexed with 16 bit indices
+        std::vector<std::uint16_t> source(part.index_count);
+        std::vector<std::uint32_t> indices(part.index_count);
+        std::vector<float>         positions(part.vertex_count * 3);
+
+        std::memcpy(source.data(), part.index_data.data(), source.size() * sizeof(std::uint16_t));
+        std::copy(source.begin(), source.end(), indices.begin());
+
+        for (std::uint32_t i = 0; i < part.vertex_count; ++i)
+        {
+            std::memcpy(positions.data() + i * 3
+                      , part.vertex_data.data() + std::size_t { i } * part.vertex_stride + element->offset()
+                      , sizeof(float) * 3);
+        }
+
+        const auto clusters = optimize_vertex_cache(indices, part.vertex_count);
+
+        optimize_overdraw(indices, clusters, positions);
+        optimize_vertex_fetch(indices, part.vertex_data, part.vertex_stride);
+
+        std::transform(indices.begin(), indices.end(), source.begin(), [] (std::uint32_t index) -> std::uint16_t {
+            return static_cast<std::uint16_t>(index);
+        });
+
+        std::memcpy(part.index_data.data(), source.data(), source.size() * sizeof(std::uint16_t));
+    }
+
+    std::vector<std::uint32_t> mesh_optimizer::optimize_vertex_cache(std::vector<std::uint32_t>& indices
+                                                                   , std::uint32_t               vertex_count) noexcept
+    {
+        Expects((indices.size() % 3) == 0);
+
+        const auto triangle_count = static_cast<std::uint32_t>(indices.size() / 3);
+
+        std::vector<std::uint32_t> clusters;
+
+        if (triangle_count == 0)
+        {
+            return clusters;
+        }
+
+        // Triangles adjacent to each vertex, and the number of them not yet emitted
+        std::vector<std::uint32_t> live(vertex_count, 0);
+        std::vector<std::uint32_t> offsets(vertex_count + 1, 0);
+        std::vector<std::uint32_t> adjacency(indices.size());
+
+        for (const auto index : indices)
+        {
+            Expects(index < vertex_count);
+
+            live[index]++;
+        }
+
+        for (std::uint32_t v = 0; v < vertex_count; ++v)
+        {
+            offsets[v + 1] = offsets[v] + live[v];
+        }
+
+        std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+
+        for (std::uint32_t t = 0; t < triangle_count; ++t)
+        {
+            for (std::uint32_t k = 0; k < 3; ++k)
+            {
+                adjacency[fill[indices[t * 3 + k]]++] = t;
+            }
+        }
+
+        // Tipsify, fan around the current vertex and move to the adjacent vertex that stays longest in the cache
+        std::vector<std::uint32_t> cache_time(vertex_count, 0);
+        std::vector<bool>          emitted(triangle_count, false);
+        std::vector<std::uint32_t> dead_end;
+        std::vector<std::uint32_t> candidates;
+        std::vector<std::uint32_t> output;
+        std::uint32_t              timestamp = cache_size + 1;
+        std::uint32_t              cursor    = 0;
+        std::uint32_t              fanning   = indices[0];
+
+        dead_end.reserve(indices.size());
+        output.reserve(indices.size());
+        clusters.push_back(0);
+
+        while (fanning != invalid_vertex)
+        {
+            candidates.clear();
+
+            for (auto i = offsets[fanning]; i < offsets[fanning + 1]; ++i)
+            {
+                const auto t = adjacency[i];
+
+                if (emitted[t])
+                {
+                    continue;
+                }
+
+                for (std::uint32_t k = 0; k < 3; ++k)
+                {
+                    const auto v = indices[t * 3 + k];
+
+                    output.push_back(v);
+                    dead_end.push_back(v);
+                    candidates.push_back(v);
+
+                    live[v]--;
+
+                    if (timestamp - cache_time[v] > cache_size)
+                    {
+                        cache_time[v] = timestamp++;
+                    }
+                }
+
+                emitted[t] = true;
+            }
+
+            // Prefer the candidates whose remaining triangles can still be emitted before they leave the cache
+            auto best          = invalid_vertex;
+            auto best_priority = std::int64_t { -1 };
+
+            for (const auto v : candidates)
+            {
+                if (live[v] == 0)
+                {
+                    continue;
+                }
+
+                auto priority = std::int64_t { 0 };
+
+                if (timestamp - cache_time[v] + 2 * live[v] <= cache_size)
+                {
+                    priority = timestamp - cache_time[v];
+                }
+
+                if (priority > best_priority)
+                {
+                    best          = v;
+                    best_priority = priority;
+                }
+            }
+
+            if (best == invalid_vertex)
+            {
+                // Dead end, back track through the recently emitted vertices, then scan the input order
+                while (!dead_end.empty() && best == invalid_vertex)
+                {
+                    const auto v = dead_end.back();
+
+                    dead_end.pop_back();
+
+                    if (live[v] > 0)
+                    {
+                        best = v;
+                    }
+                }
+
+                while (cursor < vertex_count && best == invalid_vertex)
+                {
+                    if (live[cursor] > 0)
+                    {
+                        best = cursor;
+                    }
+
+                    cursor++;
+                }
+
+                if (best != invalid_vertex)
+                {
+                    clusters.push_back(static_cast<std::uint32_t>(output.size() / 3));
+                }
+            }
+
+            fanning = best;
+        }
+
+        Ensures(output.size() == indices.size());
+
+        indices.swap(output);
+
+        return clusters;
+    }
+
+    void mesh_optimizer::optimize_overdraw(std::vector<std::uint32_t>&       indices
+                                         , const std::vector<std::uint32_t>& clusters
+                                         , const std::vector<float>&         positions) noexcept
+    {
+        const auto triangle_count = static_cast<std::uint32_t>(indices.size() / 3);
+        const auto vertex_count   = static_cast<std::uint32_t>(positions.size() / 3);
+
+        if (triangle_count == 0 || clusters.empty())
+        {
+            return;
+        }
+
+        // Split the clusters where the cache miss ratio already approaches the ratio of the whole cluster, the
+        // smaller clusters sort better at a small cost in vertex cache efficiency
+        std::vector<std::uint32_t> boundaries;
+        vertex_cache               cache(vertex_count);
+
+        for (std::size_t c = 0; c < clusters.size(); ++c)
+        {
+            const auto start = clusters[c];
+            const auto end   = (c + 1 < clusters.size()) ? clusters[c + 1] : triangle_count;
+
+            cache.flush();
+
+            std::uint32_t cluster_misses = 0;
+
+            for (auto t = start; t < end; ++t)
+            {
+                cluster_misses += cache.misses(&indices[t * 3]);
+            }
+
+            const auto threshold = static_cast<float>(cluster_misses) / static_cast<float>(end - start) * overdraw_threshold;
+
+            std::uint32_t first  = start;
+            std::uint32_t misses = 0;
+
+            cache.flush();
+            boundaries.push_back(start);
+
+            for (auto t = start; t < end; ++t)
+            {
+                misses += cache.misses(&indices[t * 3]);
+
+                if (t + 1 < end && static_cast<float>(misses) / static_cast<float>(t + 1 - first) <= threshold)
+                {
+                    boundaries.push_back(t + 1);
+
+                    first  = t + 1;
+                    misses = 0;
+
+                    cache.flush();
+                }
+            }
+        }
+
+        // Sort the clusters by how much they face away from the mesh center, outward facing clusters occlude
+        // the rest of the mesh and are drawn first
+        const auto triangle_data = [&] (std::uint32_t t, float3& centroid, float3& normal) -> float {
+            const auto a = position_of(positions, indices[t * 3]);
+            const auto b = position_of(positions, indices[t * 3 + 1]);
+            const auto c = position_of(positions, indices[t * 3 + 2]);
+
+            const float3 ab = { b.x - a.x, b.y - a.y, b.z - a.z };
+            const float3 ac = { c.x - a.x, c.y - a.y, c.z - a.z };
+
+            normal   = { ab.y * ac.z - ab.z * ac.y, ab.z * ac.x - ab.x * ac.z, ab.x * ac.y - ab.y * ac.x };
+            centroid = { (a.x + b.x + c.x) / 3.0f, (a.y + b.y + c.y) / 3.0f, (a.z + b.z + c.z) / 3.0f };
+
+            return std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+        };
+
+        float3 mesh_center = { 0.0f, 0.0f, 0.0f };
+        float  mesh_area   = 0.0f;
+
+        for (std::uint32_t t = 0; t < triangle_count; ++t)
+        {
+            float3 centroid;
+            float3 normal;
+
+            const auto area = triangle_data(t, centroid, normal);
+
+            mesh_center = { mesh_center.x + centroid.x * area, mesh_center.y + centroid.y * area, mesh_center.z + centroid.z * area };
+            mesh_area  += area;
+        }
+
+        if (mesh_area > 0.0f)
+        {
+            mesh_center = { mesh_center.x / mesh_area, mesh_center.y / mesh_area, mesh_center.z / mesh_area };
+        }
+
+        std::vector<float> sort_keys(boundaries.size(), 0.0f);
+
+        for (std::size_t c = 0; c < boundaries.size(); ++c)
+        {
+            const auto start = boundaries[c];
+            const auto end   = (c + 1 < boundaries.size()) ? boundaries[c + 1] : triangle_count;
+
+            float3 center = { 0.0f, 0.0f, 0.0f };
+            float3 normal = { 0.0f, 0.0f, 0.0f };
+            float  area   = 0.0f;
+
+            for (auto t = start; t < end; ++t)
+            {
+                float3 tc;
+                float3 tn;
+
+                const auto ta = triangle_data(t, tc, tn);
+
+                center = { center.x + tc.x * ta, center.y + tc.y * ta, center.z + tc.z * ta };
+                normal = { normal.x + tn.x, normal.y + tn.y, normal.z + tn.z };
+                area  += ta;
+            }
+
+            const auto length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+
+            if (area <= 0.0f || length <= 0.0f)
+            {
+                continue;
+            }
+
+            center = { center.x / area - mesh_center.x, center.y / area - mesh_center.y, center.z / area - mesh_center.z };
+
+            sort_keys[c] = (center.x * normal.x + center.y * normal.y + center.z * normal.z) / length;
+        }
+
+        std::vector<std::size_t> order(boundaries.size());
+
+        for (std::size_t c = 0; c < order.size(); ++c)
+        {
+            order[c] = c;
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&] (std::size_t a, std::size_t b) -> bool {
+            return sort_keys[a] > sort_keys[b];
+        });
+
+        std::vector<std::uint32_t> output;
+
+        output.reserve(indices.size());
+
+        for (const auto c : order)
+        {
+            const auto start = boundaries[c];
+            const auto end   = (c + 1 < boundaries.size()) ? boundaries[c + 1] : triangle_count;
+
+            output.insert(output.end(), indices.begin() + start * 3, indices.begin() + end * 3);
+        }
+
+        indices.swap(output);
+    }
+
+    void mesh_optimizer::optimize_vertex_fetch(std::vector<std::uint32_t>& indices
+                                             , std::vector<std::uint8_t>&  vertex_data
+                                             , std::uint32_t               vertex_stride) noexcept
+    {
+        Expects(vertex_stride > 0 && (vertex_data.size() % vertex_stride) == 0);
+
+        const auto vertex_count = static_cast<std::uint32_t>(vertex_data.size() / vertex_stride);
+
+        std::vector<std::uint32_t> remap(vertex_count, invalid_vertex);
+        std::uint32_t              next = 0;
+
+        for (auto& index : indices)
+        {
+            Expects(index < vertex_count);
+
+            if (remap[index] == invalid_vertex)
+            {
+                remap[index] = next++;
+            }
+
+            index = remap[index];
+        }
+
+        for (auto& target : remap)
+        {
+            if (target == invalid_vertex)
+            {
+                target = next++;
+            }
+        }
+
+        std::vector<std::uint8_t> data(vertex_data.size());
+
+        for (std::uint32_t v = 0; v < vertex_count; ++v)
+        {
+            std::memcpy(data.data()        + std::size_t { remap[v] } * vertex_stride
+                      , vertex_data.data() + std::size_t { v }        * vertex_stride
+                      , vertex_stride);
+        }
+
+        vertex_data.swap(data);
+    }
+
+    float mesh_optimizer::average_cache_miss_ratio(const std::vector<std::uint32_t>& indices, std::uint32_t vertex_count) noexcept
+    {
+        const auto triangle_count = indices.size() / 3;
+
+        if (triangle_count == 0)
+        {
+            return 0.0f;
+        }
+
+        vertex_cache  cache(vertex_count);
+        std::uint32_t misses = 0;
+
+        for (std::size_t t = 0; t < triangle_count; ++t)
+        {
+            misses += cache.misses(&indices[t * 3]);
+        }
+
+        return static_cast<float>(misses) / static_cast<float>(triangle_count);
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_MESH_OPTIMIZER_HPP
+#define SCENER_CONTENT_MESH_OPTIMIZER_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace scener::content
+{
+    class mesh_part_description;
+
+    /// Load time triangle list optimizer.
+    /// Reorders triangles for the post transform vertex cache (Tipsify), sorts the resulting clusters to reduce
+    /// overdraw, and reorders the vertices in first use order so vertex fetches walk memory sequentially. The
+    /// geometry is unchanged, only the order of triangles and vertices.
+    class mesh_optimizer final
+    {
+    public:
+        /// The simulated post transform vertex cache size (FIFO).
+        static constexpr std::uint32_t cache_size = 16;
+
+        /// Clusters are split while their cache miss ratio stays within this factor of the whole cluster ratio.
+        static constexpr float overdraw_threshold = 1.05f;
+
+    public:
+        /// Optimizes a triangle list mesh part in place; other primitive types are left untouched.
+        /// \param part the mesh part description.
+        static void optimize(mesh_part_description& part) noexcept;
+
+        /// Reorders the triangles for the post transform vertex cache.
+        /// \param indices the triangle list indices.
+        /// \param vertex_count the number of vertices referenced by the indices.
+        /// \returns the first triangle of each cluster started after the optimizer reached a dead end.
+        static std::vector<std::uint32_t> optimize_vertex_cache(std::vector<std::uint32_t>& indices
+                                                              , std::uint32_t               vertex_count) noexcept;
+
+        /// Splits the vertex cache optimized triangles in clusters and draws the outward facing clusters first.
+        /// \param indices the triangle list indices, as reordered by optimize_vertex_cache.
+        /// \param clusters the cluster boundaries returned by optimize_vertex_cache.
+        /// \param positions the vertex positions, three floats per vertex.
+        static void optimize_overdraw(std::vector<std::uint32_t>&       indices
+                                    , const std::vector<std::uint32_t>& clusters
+                                    , const std::vector<float>&         positions) noexcept;
+
+        /// Reorders the vertices in the order they are first referenced and remaps the indices; unreferenced vertices
+        /// are moved to the end.
+        /// \param indices the triangle list indices.
+        /// \param vertex_data the interleaved vertex data.
+        /// \param vertex_stride the size, in bytes, of a single vertex.
+        static void optimize_vertex_fetch(std::vector<std::uint32_t>& indices
+                                        , std::vector<std::uint8_t>&  vertex_data
+                                        , std::uint32_t               vertex_stride) noexcept;
+
+        /// Gets the average number of vertex cache misses per triangle (ACMR), 0.5 is optimal for large meshes and 3
+        /// is the worst case.
+        /// \param indices the triangle list indices.
+        /// \param vertex_count the number of vertices referenced by the indices.
+        static float average_cache_miss_ratio(const std::vector<std::uint32_t>& indices, std::uint32_t vertex_count) noexcept;
+    };
+}
+
+#endif // SCENER_CONTENT_MESH_OPTIMIZER_HPP
@@ -0,0 +1,120 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_MODEL_DESCRIPTION_HPP
+#define SCENER_CONTENT_MODEL_DESCRIPTION_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "scener/content/dds/surface.hpp"
+#include "scener/graphics/primitive_type.hpp"
+#include "scener/graphics/sampler_state.hpp"
+#include "scener/graphics/vertex_element.hpp"
+#include "scener/math/bounding_sphere.hpp"
+
+namespace scener::content
+{
+    /// GPU agnostic description of a model mesh part, as decoded from the asset.
+    class mesh_part_description final
+    {
+    public:
+        /// The type of primitives to render.
+        graphics::primitive_type primitive_type { graphics::primitive_type::triangle_list };
+
+        /// The number of primitives to render.
+        std::uint32_t primitive_count { 0 };
+
+        /// The number of vertices.
+        std::uint32_t vertex_count { 0 };
+
+        /// The size, in bytes, of a single interleaved vertex.
+        std::uint32_t vertex_stride { 0 };
+
+        /// The layout of the interleaved vertex data.
+        std::vector<graphics::vertex_element> vertex_elements { };
+
+        /// The interleaved vertex data.
+        std::vector<std::uint8_t> vertex_data { };
+
+        /// The number of indices.
+        std::uint32_t index_count { 0 };
+
+        /// The index data.
+        std::vector<std::uint8_t> index_data { };
+
+        /// The id (JSON property name) of the material, empty when the part has no material.
+        std::string material { };
+    };
+
+    /// GPU agnostic description of a model mesh.
+    class mesh_description final
+    {
+    public:
+        /// The mesh name.
+        std::string name { };
+
+        /// The mesh parts.
+        std::vector<mesh_part_description> parts { };
+
+        /// The sphere enclosing the mesh geometry.
+        math::bounding_sphere bounding_sphere { math::vector3::zero(), 0.0f };
+    };
+
+    /// GPU agnostic description of a texture.
+    class texture_description final
+    {
+    public:
+        /// The texture name.
+        std::string name { };
+
+        /// The decoded texture data.
+        std::shared_ptr<dds::surface> surface { nullptr };
+
+        /// The sampler used to read the texture.
+        graphics::sampler_state sampler { };
+    };
+
+    /// GPU agnostic description of a material.
+    class material_description final
+    {
+    public:
+        /// The material name.
+        std::string name { };
+
+        /// The id (JSON property name) of the technique used to render the material.
+        std::string technique { };
+
+        /// The material parameter values, keyed and ordered by parameter name as in the asset.
+        std::map<std::string, nlohmann::json> values { };
+
+        /// The ids (JSON property name) of the textures referenced by the material, in declaration order.
+        std::vector<std::string> textures { };
+    };
+
+    /// GPU agnostic description of the meshes, textures and materials of an asset, produced by the content decode
+    /// stage and consumed by the device realization stage.
+    class model_description final
+    {
+    public:
+        /// The asset name.
+        std::string name { };
+
+        /// The asset meshes, keyed by id (JSON property name).
+        std::unordered_map<std::string, std::shared_ptr<mesh_description>> meshes { };
+
+        /// The asset materials, keyed by id (JSON property name).
+        std::unordered_map<std::string, std::shared_ptr<material_description>> materials { };
+
+        /// The asset textures, keyed by id (JSON property name).
+        std::unordered_map<std::string, std::shared_ptr<texture_description>> textures { };
+    };
+}
+
+#endif // SCENER_CONTENT_MODEL_DESCRIPTION_HPP
@@ -60,18 +60,19 @@ namespace scener::content::readers
             instance->_byte_stride = value[k_byte_stride].get<std::uint32_t>();
         }
 
-        if (value.count(k_max) != 0)
-        {
-            const auto& source = value[k_max].get<std::vector<float>>();
+        std::vector<float> min;
+        std::vector<float> max;
 
-            std::for_each(source.begin(), source.end(), [&](const auto& value) { instance->_max.push_back(value); });
-        }
         if (value.count(k_min) != 0)
         {
-            const auto& source = value[k_min].get<std::vector<float>>();
-
-            std::for_each(source.begin(), source.end(), [&](const auto& value) { instance->_max.push_back(value); });
+            min = value[k_min].get<std::vector<float>>();
         }
+        if (value.count(k_max) != 0)
+        {
+            max = value[k_max].get<std::vector<float>>();
+        }
+
+        instance->set_min_max(min, max);
 
         return instance;
     }
@@ -0,0 +1,43 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/content/readers/material_description_reader.hpp"
+
+#include "scener/content/content_reader.hpp"
+#include "scener/content/model_description.hpp"
+#include "scener/content/gltf/constants.hpp"
+
+namespace scener::content::readers
+{
+    using nlohmann::json;
+    using namespace scener::content::gltf;
+
+    auto content_type_reader<material_description>::read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const json& value) const noexcept
+    {
+        auto        instance = std::make_shared<material_description>();
+        const auto& textures = input->_root[k_textures];
+
+        instance->name      = key;
+        instance->technique = value[k_technique].get<std::string>();
+
+        for (auto it = value[k_values].begin(); it != value[k_values].end(); ++it)
+        {
+            const auto& pvalue = it.value();
+
+            if (pvalue.is_null())
+            {
+                continue;
+            }
+
+            // Sampler parameters reference textures by id
+            if (pvalue.is_string() && textures.count(pvalue.get<std::string>()) != 0)
+            {
+                instance->textures.push_back(pvalue.get<std::string>());
+            }
+
+            instance->values.emplace(it.key(), pvalue);
+        }
+
+        return instance;
+    }
+}
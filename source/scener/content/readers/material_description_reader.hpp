@@ -0,0 +1,25 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_READERS_MATERIAL_DESCRIPTION_READER_HPP
+#define SCENER_CONTENT_READERS_MATERIAL_DESCRIPTION_READER_HPP
+
+#include "scener/content/readers/content_type_reader.hpp"
+
+namespace scener::content { class material_description; }
+
+namespace scener::content::readers
+{
+    /// Decodes glTF materials into GPU agnostic material descriptions, no graphics device is required.
+    template <>
+    class content_type_reader<material_description>
+    {
+    public:
+        content_type_reader() = default;
+
+    public:
+        auto read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const nlohmann::json& value) const noexcept;
+    };
+}
+
+#endif // SCENER_CONTENT_READERS_MATERIAL_DESCRIPTION_READER_HPP
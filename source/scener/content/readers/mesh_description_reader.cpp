@@ -0,0 +1,252 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/content/readers/mesh_description_reader.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "scener/content/content_reader.hpp"
+#include "scener/content/mesh_optimizer.hpp"
+#include "scener/content/model_description.hpp"
+#include "scener/content/gltf/accessor.hpp"
+#include "scener/content/gltf/constants.hpp"
+
+using nlohmann::json;
+using scener::math::vector3;
+using namespace scener::content::gltf;
+using namespace scener::graphics;
+
+namespace scener::content::readers
+{
+    auto content_type_reader<mesh_description>::read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const json& value) const noexcept
+    {
+        auto instance = std::make_shared<mesh_description>();
+
+        instance->name = key;
+        instance->parts.resize(value[k_primitives].size());
+
+        for (std::size_t i = 0; i < instance->parts.size(); ++i)
+        {
+            read_mesh_part(input, value[k_primitives][i], instance->parts[i]);
+        }
+
+        instance->bounding_sphere = read_bounds(input, value);
+
+        return instance;
+    }
+
+    scener::math::bounding_sphere content_type_reader<mesh_description>::read_bounds(content_reader* input, const json& value) const noexcept
+    {
+        // Sphere enclosing the union of the POSITION bounding boxes of all the mesh primitives
+        constexpr auto limit = std::numeric_limits<float>::max();
+
+        auto min   = vector3 {  limit,  limit,  limit };
+        auto max   = vector3 { -limit, -limit, -limit };
+        auto found = false;
+
+        for (const auto& primitive : value[k_primitives])
+        {
+            const auto& attributes = primitive[k_attributes];
+
+            if (attributes.count(k_position) == 0)
+            {
+                continue;
+            }
+
+            const auto  accessor = input->read_object<gltf::accessor>(attributes[k_position].get<std::string>());
+            const auto& amin     = accessor->min();
+            const auto& amax     = accessor->max();
+
+            if (amin.size() < 3 || amax.size() < 3)
+            {
+                continue;
+            }
+
+            min   = { std::min(min.x, amin[0]), std::min(min.y, amin[1]), std::min(min.z, amin[2]) };
+            max   = { std::max(max.x, amax[0]), std::max(max.y, amax[1]), std::max(max.z, amax[2]) };
+            found = true;
+        }
+
+        if (!found)
+        {
+            return { vector3::zero(), 0.0f };
+        }
+
+        const auto center = vector3 { (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f };
+        const auto extent = vector3 { (max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f };
+
+        return { center, std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z) };
+    }
+
+    void content_type_reader<mesh_description>::read_mesh_part(content_reader*        input
+                                                             , const json&            value
+                                                             , mesh_part_description& part) const noexcept
+    {
+        auto accessors     = std::vector<std::shared_ptr<gltf::accessor>>();
+        auto vertex_stride = std::uint32_t { 0 };
+        auto vertex_count  = std::uint32_t { 0 };
+        auto indices       = input->read_object<gltf::accessor>(value[k_indices].get<std::string>());
+        auto index_data    = indices->get_data();
+
+        // Indices
+        part.index_count = indices->attribute_count();
+        part.index_data.assign(index_data.begin(), index_data.end());
+
+        // Vertex declaration
+        accessors.reserve(value[k_attributes].size());
+        part.vertex_elements.reserve(value[k_attributes].size());
+
+        for (auto it = value[k_attributes].begin(); it != value[k_attributes].end(); ++it)
+        {
+            const auto accessor = input->read_object<gltf::accessor>(it.value().get<std::string>());
+            const auto format   = get_vertex_element_format(accessor->attribute_type(), accessor->component_type());
+            const auto usage    = get_vertex_element_usage(it.key());
+            const auto index    = static_cast<std::uint32_t>(usage);
+
+            if (usage == vertex_element_usage::position)
+            {
+                vertex_count = accessor->attribute_count();
+            }
+
+            accessors.push_back(accessor);
+            part.vertex_elements.push_back({ vertex_stride, format, usage, index });
+
+            vertex_stride += accessor->byte_stride();
+        }
+
+        part.primitive_type  = static_cast<primitive_type>(value[k_mode].get<std::int32_t>());
+        part.vertex_count    = vertex_count;
+        part.vertex_stride   = vertex_stride;
+        part.primitive_count = 0;
+
+        switch (part.primitive_type)
+        {
+        case primitive_type::line_list:
+            part.primitive_count = (vertex_count / 2);
+            break;
+        case primitive_type::triangle_list:
+            part.primitive_count = (vertex_count / 3);
+            break;
+        case primitive_type::line_loop:
+        case primitive_type::line_strip:
+        case primitive_type::point_list:
+        case primitive_type::triangle_fan:
+        case primitive_type::triangle_strip:
+            // TODO: Fix
+            part.primitive_count = vertex_count;
+            break;
+        }
+
+        // Build interleaved data array
+        part.vertex_data.assign(vertex_stride * vertex_count, 0);
+
+        auto position = part.vertex_data.begin();
+
+        for (std::uint32_t i = 0; i < vertex_count; ++i)
+        {
+            for (const auto& accessor : accessors)
+            {
+                const auto view = accessor->get_data(i, 1);
+
+                std::copy_n(view.begin(), accessor->byte_stride(), position);
+
+                position += static_cast<std::ptrdiff_t>(accessor->byte_stride());
+            }
+        }
+
+        // Reorder triangles and vertices for the GPU
+        if (input->optimize_meshes())
+        {
+            mesh_optimizer::optimize(part);
+        }
+
+        // Effect Material
+        part.material = value[k_material].get<std::string>();
+    }
+
+    vertex_element_format content_type_reader<mesh_description>::get_vertex_element_format(attribute_type type
+                                                                                          , component_type component) noexcept
+    {
+        // Integer attributes keep their source layout, e.g. unsigned byte or short joint indices
+        if (component != component_type::single)
+        {
+            if (type == attribute_type::vector4 && component == component_type::ubyte)
+            {
+                return vertex_element_format::byte4;
+            }
+            if (type == attribute_type::vector4 && component == component_type::uint16)
+            {
+                return vertex_element_format::ushort4;
+            }
+            if (type == attribute_type::vector4 && component == component_type::int16)
+            {
+                return vertex_element_format::short4;
+            }
+            if (type == attribute_type::vector2 && component == component_type::int16)
+            {
+                return vertex_element_format::short2;
+            }
+
+            throw std::runtime_error("unsupported attribute component type");
+        }
+
+        switch (type)
+        {
+        case attribute_type::vector2:
+            return vertex_element_format::vector2;
+        case attribute_type::vector3:
+            return vertex_element_format::vector3;
+        case attribute_type::vector4:
+            return vertex_element_format::vector4;
+        case attribute_type::scalar:
+            return vertex_element_format::single;
+        case attribute_type::matrix2:
+        case attribute_type::matrix3:
+        case attribute_type::matrix4:
+        default:
+            throw std::runtime_error("unsupported attribute type");
+        }
+    }
+
+    vertex_element_usage content_type_reader<mesh_description>::get_vertex_element_usage(const std::string& semantic) const noexcept
+    {
+        auto usage = vertex_element_usage::color;
+
+        if (semantic == k_joint)
+        {
+            usage = vertex_element_usage::blend_indices;
+        }
+        else if (semantic == k_normal)
+        {
+            usage = vertex_element_usage::normal;
+        }
+        else if (semantic == k_position)
+        {
+            usage = vertex_element_usage::position;
+        }
+        else if (semantic == k_textbinormal)
+        {
+            usage = vertex_element_usage::binormal;
+        }
+        else if (semantic == k_textcoord_0)
+        {
+            usage = vertex_element_usage::texture_coordinate;
+        }
+        else if (semantic == k_texttangent)
+        {
+            usage = vertex_element_usage::tangent;
+        }
+        else if (semantic == k_weight)
+        {
+            usage = vertex_element_usage::blend_weight;
+        }
+        else
+        {
+            throw std::runtime_error("unknown attribute [" + semantic + "]");
+        }
+
+        return usage;
+    }
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_READERS_MESH_DESCRIPTION_READER_HPP
+#define SCENER_CONTENT_READERS_MESH_DESCRIPTION_READER_HPP
+
+#include "scener/content/readers/content_type_reader.hpp"
+#include "scener/math/bounding_sphere.hpp"
+
+namespace scener::graphics
+{
+    enum class vertex_element_format : std::uint32_t;
+    enum class vertex_element_usage  : std::uint32_t;
+}
+
+namespace scener::content
+{
+    class mesh_description;
+    class mesh_part_description;
+}
+
+namespace scener::content::gltf
+{
+    enum class attribute_type : std::uint32_t;
+    enum class component_type : std::uint32_t;
+}
+
+namespace scener::content::readers
+{
+    /// Decodes glTF meshes into GPU agnostic mesh descriptions, no graphics device is required.
+    template<>
+    class content_type_reader<mesh_description>
+    {
+    public:
+        content_type_reader() = default;
+
+    public:
+        auto read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const nlohmann::json& value) const noexcept;
+
+        /// Gets the vertex element format of a glTF attribute.
+        /// \param type the attribute type.
+        /// \param component the data type of the attribute components; integer components keep their layout.
+        /// \returns the vertex element format that matches the attribute data.
+        static graphics::vertex_element_format get_vertex_element_format(gltf::attribute_type type
+                                                                        , gltf::component_type component) noexcept;
+
+    private:
+        math::bounding_sphere read_bounds(content_reader* input, const nlohmann::json& value) const noexcept;
+
+        void read_mesh_part(content_reader* input, const nlohmann::json& value, mesh_part_description& part) const noexcept;
+
+        graphics::vertex_element_usage get_vertex_element_usage(const std::string& semantic) const noexcept;
+    };
+}
+
+#endif  // SCENER_CONTENT_READERS_MESH_DESCRIPTION_READER_HPP
@@ -3,9 +3,12 @@
 
 #include "scener/content/readers/model_mesh_reader.hpp"
 
+#include <algorithm>
+
 #include "scener/content/content_manager.hpp"
 #include "scener/content/content_reader.hpp"
-#include "scener/content/gltf/accessor.hpp"
+#include "scener/content/model_description.hpp"
+#include "scener/content/vertex_packer.hpp"
 #include "scener/content/gltf/constants.hpp"
 #include "scener/graphics/effect_parameter.hpp"
 #include "scener/graphics/effect_pass.hpp"
@@ -17,6 +20,7 @@
 #include "scener/graphics/model_mesh_part.hpp"
 #include "scener/graphics/service_container.hpp"
 #include "scener/graphics/texture2d.hpp"
+#include "scener/graphics/texture_streamer.hpp"
 #include "scener/graphics/vertex_buffer.hpp"
 #include "scener/graphics/vertex_declaration.hpp"
 
@@ -32,112 +36,76 @@ namespace scener::content::readers
 {
     auto content_type_reader<model_mesh>::read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const json& value) const noexcept
     {
-        auto instance = std::make_shared<model_mesh>();
-
-        instance->_name = key;
-        instance->_mesh_parts.reserve(value[k_primitives].size());
-
-        for (const auto& primitive : value[k_primitives])
-        {
-            instance->_mesh_parts.push_back(read_mesh_part(input, primitive));
-        }
+        // CPU decode, shared with the headless content_reader::decode_asset path
+        const auto description = input->read_object<mesh_description>(key, value);
 
-        return instance;
+        return realize(input, *description);
     }
 
-    std::shared_ptr<model_mesh_part> content_type_reader<model_mesh>::read_mesh_part(content_reader* input, const json& value) const noexcept
+    std::shared_ptr<model_mesh> content_type_reader<model_mesh>::realize(content_reader* input, const mesh_description& description) const noexcept
     {
-        auto instance      = std::make_shared<model_mesh_part>();
-        auto gdservice     = input->content_manager()->service_provider()->get_service<igraphics_device_service>();
-        auto device        = gdservice->device();
-        auto accessors     = std::vector<std::shared_ptr<gltf::accessor>>();
-        auto elements      = std::vector<vertex_element>();
-        auto vertex_stride = std::uint32_t { 0 };
-        auto vertex_count  = std::uint32_t { 0 };
-        auto indices       = input->read_object<gltf::accessor>(value[k_indices].get<std::string>());
+        auto instance = std::make_shared<model_mesh>();
 
-        // Index buffer
-        instance->_index_buffer = std::make_unique<index_buffer>(device, indices->attribute_count(), indices->get_data());
+        instance->_name            = description.name;
+        instance->_bounding_sphere = description.bounding_sphere;
+        instance->_mesh_parts.reserve(description.parts.size());
 
-        // Vertex buffer
-        accessors.reserve(value[k_attributes].size());
-        elements.reserve(value[k_attributes].size());
+        // Quantize the vertex attributes to the compact formats supported by the device, the decoded
+        // descriptions are left untouched
+        const auto pack_vertices = input->content_manager()->pack_vertices();
+        const auto gdservice     = input->content_manager()->service_provider()->get_service<igraphics_device_service>();
+        const auto device        = gdservice->device();
 
-        // Vertex declaration
-        for (auto it = value[k_attributes].begin(); it != value[k_attributes].end(); ++it)
+        for (const auto& part : description.parts)
         {
-            const auto accessor = input->read_object<gltf::accessor>(it.value().get<std::string>());
-            const auto format   = get_vertex_element_format(accessor->attribute_type());
-            const auto usage    = get_vertex_element_usage(it.key());
-            const auto index    = static_cast<std::uint32_t>(usage);
+            if (pack_vertices)
+            {
+                auto packed = part;
+
+                vertex_packer::pack(packed, [device] (vertex_element_format format) -> bool {
+                    return device->is_vertex_format_supported(format);
+                });
 
-            if (usage == vertex_element_usage::position)
+                instance->_mesh_parts.push_back(realize_mesh_part(input, packed));
+            }
+            else
             {
-                vertex_count = accessor->attribute_count();
+                instance->_mesh_parts.push_back(realize_mesh_part(input, part));
             }
+        }
 
-            accessors.push_back(accessor);
-            elements.push_back({ vertex_stride, format, usage, index });
+        return instance;
+    }
 
-            vertex_stride += accessor->byte_stride();
-        }
+    std::shared_ptr<model_mesh_part> content_type_reader<model_mesh>::realize_mesh_part(content_reader*              input
+                                                                                      , const mesh_part_description& description) const noexcept
+    {
+        auto instance  = std::make_shared<model_mesh_part>();
+        auto gdservice = input->content_manager()->service_provider()->get_service<igraphics_device_service>();
+        auto device    = gdservice->device();
 
-        vertex_declaration declaration(vertex_stride, elements);
+        vertex_declaration declaration(description.vertex_stride, description.vertex_elements);
 
-        instance->_primitive_type  = static_cast<primitive_type>(value[k_mode].get<std::int32_t>());
-        instance->_vertex_count    = vertex_count;
+        instance->_primitive_type  = description.primitive_type;
+        instance->_vertex_count    = description.vertex_count;
         instance->_start_index     = 0;
         instance->_vertex_offset   = 0;
-        instance->_primitive_count = 0;
-
-        switch (instance->_primitive_type)
-        {
-        case primitive_type::line_list:
-            instance->_primitive_count = (vertex_count / 2);
-            break;
-        case primitive_type::triangle_list:
-            instance->_primitive_count = (vertex_count / 3);
-            break;
-        case primitive_type::line_loop:
-        case primitive_type::line_strip:
-        case primitive_type::point_list:
-        case primitive_type::triangle_fan:
-        case primitive_type::triangle_strip:
-            // TODO: Fix
-            instance->_primitive_count = vertex_count;
-            break;
-        }
-
-        // Build interleaved data array
-        auto data     = std::vector<std::uint8_t>(vertex_stride * vertex_count, 0);
-        auto position = data.begin();
-
-        for (std::uint32_t i = 0; i < vertex_count; ++i)
-        {
-            for (const auto& accessor : accessors)
-            {
-                const auto view = accessor->get_data(i, 1);
-
-                std::copy_n(view.begin(), accessor->byte_stride(), position);
-
-                position += static_cast<std::ptrdiff_t>(accessor->byte_stride());
-            }
-        }
-
-        // Initialize vertex buffer
-        instance->_vertex_buffer = std::make_unique<vertex_buffer>(device, declaration, vertex_count, data);
+        instance->_primitive_count = description.primitive_count;
+        instance->_index_buffer    = std::make_unique<index_buffer>(device, description.index_count, description.index_data);
+        instance->_vertex_buffer   = std::make_unique<vertex_buffer>(device, declaration, description.vertex_count, description.vertex_data);
 
         // Effect Material
-        const auto& materialref = value[k_material].get<std::string>();
-        if (!materialref.empty())
+        if (!description.material.empty())
         {
-            instance->_effect = read_material(input, materialref);
+            instance->_effect = read_material(input, description.material);
 
             std::for_each(instance->_effect->passes().begin()
                         , instance->_effect->passes().end()
                         , [&] (const auto& pass) {
                             pass->_pipeline = device->create_graphics_pipeline(*instance);
                           });
+
+            device->texture_streamer()->track(instance->_effect);
         }
 
         return instance;
@@ -146,18 +114,12 @@ namespace scener::content::readers
     std::shared_ptr<effect_technique> content_type_reader<model_mesh>::read_material(content_reader*    input
                                                                                    , const std::string& key) const noexcept
     {
-        const auto& material  = input->_root[k_materials][key];
-        auto        technique = input->read_object_instance<effect_technique>(material[k_technique].get<std::string>());
+        const auto material  = input->read_object<material_description>(key);
+        auto       technique = input->read_object_instance<effect_technique>(material->technique);
 
-        for (auto it = material[k_values].begin(); it != material[k_values].end(); ++it)
+        for (const auto& [name, pvalue] : material->values)
         {
-            const auto& parameter = technique->_parameters[it.key()];
-            const auto& pvalue    = it.value();
-
-            if (pvalue.is_null())
-            {
-                continue;
-            }
+            const auto& parameter = technique->_parameters[name];
 
             if (parameter->parameter_class() == effect_parameter_class::scalar)
             {
@@ -221,64 +183,4 @@ namespace scener::content::readers
 
         return technique;
     }
-
-    vertex_element_format content_type_reader<model_mesh>::get_vertex_element_format(attribute_type type) const noexcept
-    {
-        switch (type)
-        {
-        case attribute_type::vector2:
-            return vertex_element_format::vector2;
-        case attribute_type::vector3:
-            return vertex_element_format::vector3;
-        case attribute_type::vector4:
-            return vertex_element_format::vector4;
-        case attribute_type::scalar:
-            return vertex_element_format::single;
-        case attribute_type::matrix2:
-        case attribute_type::matrix3:
-        case attribute_type::matrix4:
-        default:
-            throw std::runtime_error("unsupported attribute type");
-        }
-    }
-
-    vertex_element_usage content_type_reader<model_mesh>::get_vertex_element_usage(const std::string& semantic) const noexcept
-    {
-        auto usage = vertex_element_usage::color;
-
-        if (semantic == k_joint)
-        {
-            usage = vertex_element_usage::blend_indices;
-        }
-        else if (semantic == k_normal)
-        {
-            usage = vertex_element_usage::normal;
-        }
-        else if (semantic == k_position)
-        {
-            usage = vertex_element_usage::position;
-        }
-        else if (semantic == k_textbinormal)
-        {
-            usage = vertex_element_usage::binormal;
-        }
-        else if (semantic == k_textcoord_0)
-        {
-            usage = vertex_element_usage::texture_coordinate;
-        }
-        else if (semantic == k_texttangent)
-        {
-            usage = vertex_element_usage::tangent;
-        }
-        else if (semantic == k_weight)
-        {
-            usage = vertex_element_usage::blend_weight;
-        }
-        else
-        {
-            throw std::runtime_error("unknown attribute [" + semantic + "]");
-        }
-
-        return usage;
-    }
 }
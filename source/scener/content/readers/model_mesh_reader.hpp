@@ -8,18 +8,20 @@
 
 namespace scener::graphics
 {
-    enum class vertex_element_format : std::uint32_t;
-    enum class vertex_element_usage  : std::uint32_t;
-
     class effect_technique;
     class model_mesh;
     class model_mesh_part;
 }
 
-namespace scener::content::gltf { enum class attribute_type : std::uint32_t; }
+namespace scener::content
+{
+    class mesh_description;
+    class mesh_part_description;
+}
 
 namespace scener::content::readers
 {
+    /// Realizes model meshes on the graphics device from their decoded mesh descriptions.
     template<>
     class content_type_reader<graphics::model_mesh>
     {
@@ -29,14 +31,16 @@ namespace scener::content::readers
     public:
         auto read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const nlohmann::json& value) const noexcept;
 
+        /// Creates the device resources of a mesh from its description.
+        /// \param input the content reader.
+        /// \param description the decoded mesh.
+        /// \returns the mesh ready to be rendered.
+        std::shared_ptr<graphics::model_mesh> realize(content_reader* input, const mesh_description& description) const noexcept;
+
     private:
-        std::shared_ptr<graphics::model_mesh_part> read_mesh_part(content_reader* input, const nlohmann::json& value) const noexcept;
+        std::shared_ptr<graphics::model_mesh_part> realize_mesh_part(content_reader* input, const mesh_part_description& description) const noexcept;
 
         std::shared_ptr<graphics::effect_technique> read_material(content_reader* input, const std::string& key) const noexcept;
-
-        graphics::vertex_element_format get_vertex_element_format(gltf::attribute_type type) const noexcept;
-
-        graphics::vertex_element_usage get_vertex_element_usage(const std::string& semantic) const noexcept;
     };
 }
 
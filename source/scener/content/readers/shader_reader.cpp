@@ -17,9 +17,11 @@ namespace scener::content::readers
     auto content_type_reader<shader>::read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const json& value) const noexcept
     {
         auto type     = value[k_type].get<std::int32_t>();
-        auto filename = value[k_uri].get<std::string>() + ".spv";
+        auto uri      = value[k_uri].get<std::string>();
+        auto filename = input->get_shader_name(uri);
         auto buffer   = input->read_external_reference(filename);
         auto stage    = shader_stage::all;
+        auto bindless = (filename != uri + ".spv");
 
         switch (type)
         {
@@ -44,7 +46,7 @@ namespace scener::content::readers
             break;
         }
 
-        return std::make_shared<shader>(key, stage, buffer);
+        return std::make_shared<shader>(key, stage, buffer, bindless);
     }
 }
 
@@ -86,7 +86,16 @@ namespace scener::content::readers
 
             if (parameter->_uniform_name == "u_jointMat")
             {
-                offset = offsetof(scener::graphics::default_constant_buffer, u_jointMat);
+                // Joint matrices live in the device bone palette, the constant buffer only holds the index
+                // of the first joint of the skinned draw
+                parameter->_parameter_class = effect_parameter_class::scalar;
+                parameter->_parameter_type  = effect_parameter_type::uint32;
+                parameter->_row_count       = 0;
+                parameter->_column_count    = 0;
+                parameter->_count           = 1;
+                parameter->_size            = sizeof(std::uint32_t);
+
+                offset = offsetof(scener::graphics::default_constant_buffer, u_jointOffset);
             }
             else if (parameter->_uniform_name == "u_normalMatrix")
             {
@@ -0,0 +1,29 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/content/readers/texture_description_reader.hpp"
+
+#include "scener/content/content_reader.hpp"
+#include "scener/content/model_description.hpp"
+#include "scener/content/dds/surface.hpp"
+#include "scener/content/gltf/constants.hpp"
+#include "scener/graphics/sampler_state.hpp"
+
+namespace scener::content::readers
+{
+    using nlohmann::json;
+    using scener::content::dds::surface;
+    using scener::graphics::sampler_state;
+    using namespace scener::content::gltf;
+
+    auto content_type_reader<texture_description>::read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const json& value) const noexcept
+    {
+        auto instance = std::make_shared<texture_description>();
+
+        instance->name    = key;
+        instance->surface = input->read_object<surface>(value[k_source].get<std::string>());
+        instance->sampler = *input->read_object<sampler_state>(value[k_sampler].get<std::string>());
+
+        return instance;
+    }
+}
@@ -7,46 +7,72 @@
 
 #include "scener/content/content_manager.hpp"
 #include "scener/content/content_reader.hpp"
+#include "scener/content/model_description.hpp"
 #include "scener/content/dds/surface.hpp"
-#include "scener/content/gltf/constants.hpp"
 #include "scener/graphics/igraphics_device_service.hpp"
 #include "scener/graphics/graphics_device.hpp"
 #include "scener/graphics/service_container.hpp"
 #include "scener/graphics/sampler_state.hpp"
 #include "scener/graphics/texture2d.hpp"
+#include "scener/graphics/texture_streamer.hpp"
+#include "scener/graphics/texture_table.hpp"
 #include "scener/graphics/texture_target.hpp"
 
 namespace scener::content::readers
 {
     using nlohmann::json;
-    using scener::content::dds::surface;
-    using scener::content::dds::surface_mipmap;
     using scener::graphics::igraphics_device_service;
-    using scener::graphics::sampler_state;
-    using scener::graphics::surface_format;
     using scener::graphics::texture2d;
     using scener::graphics::texture_target;
-    using namespace scener::content::gltf;
 
     auto content_type_reader<texture2d>::read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const json& value) const noexcept
+    {
+        // CPU decode, shared with the headless content_reader::decode_asset path
+        const auto description = input->read_object<texture_description>(key, value);
+
+        return realize(input, *description);
+    }
+
+    std::shared_ptr<texture2d> content_type_reader<texture2d>::realize(content_reader* input, const texture_description& description) const noexcept
     {
         const auto gdservice = input->content_manager()->service_provider()->get_service<igraphics_device_service>();
         const auto device    = gdservice->device();
-        const auto dds       = input->read_object<surface>(value[k_source].get<std::string>());
-        const auto sstate    = input->read_object<sampler_state>(value[k_sampler].get<std::string>());
+        auto       dds       = description.surface;
 
-        auto instance = std::make_shared<texture2d>(gdservice->device(), dds->width(), dds->height(), dds->format());
+        // Devices without support for the block compressed format sample the texture decoded to RGBA8
+        const auto decoded = scener::content::dds::surface::is_srgb(dds->format()) ? graphics::surface_format::color_srgb
+                                                                                   : graphics::surface_format::color;
 
-        sstate->max_mip_level    = instance->level_count();
-        instance->name            = key;
+        if (!device->is_texture_format_supported(dds->format())
+         && scener::content::dds::surface::can_transform(dds->format(), decoded))
+        {
+            dds = std::make_shared<scener::content::dds::surface>(dds->transform(decoded));
+        }
+
+        auto instance   = std::make_shared<texture2d>(device, dds->width(), dds->height(), dds->format());
+        auto sstate     = description.sampler;
+        auto base_level = device->texture_streamer()->initial_level(*dds);
+
+        // Only the low resolution mipmaps are uploaded, the streamer brings in the rest on demand
+        sstate.max_mip_level      = dds->mipmaps().size() - base_level - 1;
+        instance->name            = description.name;
         instance->_mipmap_levels  = static_cast<std::uint32_t>(dds->mipmaps().size());
+        instance->_surface        = dds;
+        instance->_sampler_state  = description.sampler;
         instance->_texture_object = device->create_texture_object(
             dds.get()
-          , sstate.get()
+          , base_level
+          , &sstate
           , vk::ImageTiling::eOptimal
           , vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst
           , vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
 
+        // Materials compiled for the texture table refer to the texture by its index
+        if (device->texture_table() != nullptr)
+        {
+            instance->_table_index = device->texture_table()->add(*instance);
+        }
+
         return instance;
     }
 }
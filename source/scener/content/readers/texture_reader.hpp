@@ -8,8 +8,11 @@
 
 namespace scener::graphics { class texture2d; }
 
+namespace scener::content { class texture_description; }
+
 namespace scener::content::readers
 {
+    /// Realizes textures on the graphics device from their decoded texture descriptions.
     template <>
     class content_type_reader<graphics::texture2d>
     {
@@ -18,6 +21,12 @@ namespace scener::content::readers
 
     public:
         auto read([[maybe_unused]] content_reader* input, [[maybe_unused]] const std::string& key, const nlohmann::json& value) const noexcept;
+
+        /// Creates the device resources of a texture from its description.
+        /// \param input the content reader.
+        /// \param description the decoded texture.
+        /// \returns the texture ready to be sampled.
+        std::shared_ptr<graphics::texture2d> realize(content_reader* input, const texture_description& description) const noexcept;
     };
 }
 
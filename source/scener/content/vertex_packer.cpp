@@ -0,0 +1,393 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/content/vertex_packer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#include <gsl/gsl>
+
+#include "scener/content/model_description.hpp"
+
+namespace scener::content
+{
+    using scener::graphics::vertex_element;
+    using scener::graphics::vertex_element_format;
+    using scener::graphics::vertex_element_usage;
+
+    namespace
+    {
+        /// Reads the components of a float attribute, integer attributes have no components to read.
+        inline std::array<float, 4> read_components(const std::uint8_t* source, std::uint32_t count) noexcept
+        {
+            Expects(count <= 4);
+
+            std::array<float, 4> components = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+            std::memcpy(components.data(), source, count * sizeof(float));
+
+            return components;
+        }
+
+        inline std::uint32_t component_count(vertex_element_format format) noexcept
+        {
+            switch (format)
+            {
+            case vertex_element_format::single:
+                return 1;
+            case vertex_element_format::vector2:
+                return 2;
+            case vertex_element_format::vector3:
+                return 3;
+            case vertex_element_format::vector4:
+                return 4;
+            default:
+                return 0;
+            }
+        }
+
+        inline std::int32_t snorm(float value, float scale) noexcept
+        {
+            return static_cast<std::int32_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * scale));
+        }
+
+        /// Gets the compact format of a float attribute, or its own format when it must be kept as is.
+        vertex_element_format packed_format(const vertex_element&                  element
+                                          , const mesh_part_description&           part
+                                          , const vertex_packer::format_predicate& is_supported) noexcept
+        {
+            const auto format = element.format();
+            const auto count  = component_count(format);
+
+            // Only float sources are packed, integer sources (e.g. byte4 or short4 joints) are already compact
+            if (count == 0)
+            {
+                return format;
+            }
+
+            switch (element.usage())
+            {
+            case vertex_element_usage::texture_coordinate:
+                if (format == vertex_element_format::vector2 && is_supported(vertex_element_format::half_vector2))
+                {
+                    return vertex_element_format::half_vector2;
+                }
+                break;
+
+            case vertex_element_usage::normal:
+            case vertex_element_usage::binormal:
+            case vertex_element_usage::tangent:
+                if (count >= 3 && is_supported(vertex_element_format::normalized_packed))
+                {
+                    return vertex_element_format::normalized_packed;
+                }
+                if (count >= 3 && is_supported(vertex_element_format::normalized_byte4))
+                {
+                    return vertex_element_format::normalized_byte4;
+                }
+                break;
+
+            case vertex_element_usage::blend_indices:
+                if (is_supported(vertex_element_format::byte4))
+                {
+                    // Only when every joint index fits in a byte
+                    for (std::uint32_t v = 0; v < part.vertex_count; ++v)
+                    {
+                        const auto source  = part.vertex_data.data() + std::size_t { v } * part.vertex_stride + element.offset();
+                        const auto indices = read_components(source, count);
+
+                        for (std::uint32_t c = 0; c < count; ++c)
+                        {
+                            if (indices[c] < 0.0f || indices[c] > 255.0f || indices[c] != std::floor(indices[c]))
+                            {
+                                return format;
+                            }
+                        }
+                    }
+
+                    return vertex_element_format::byte4;
+                }
+                break;
+
+            case vertex_element_usage::blend_weight:
+                if (is_supported(vertex_element_format::color))
+                {
+                    return vertex_element_format::color;
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            return format;
+        }
+
+        void write_element(vertex_element_format                format
+                         , std::uint32_t                        count
+                         , const std::array<float, 4>&          components
+                         , std::uint8_t*                        target) noexcept
+        {
+            switch (format)
+            {
+            case vertex_element_format::half_vector2:
+                {
+                    const std::uint16_t half[2] = { vertex_packer::to_half(components[0]), vertex_packer::to_half(components[1]) };
+
+                    std::memcpy(target, half, sizeof(half));
+                }
+                break;
+
+            case vertex_element_format::normalized_packed:
+                {
+                    // Three component vectors get w = 0, tangents keep their handedness in w
+                    const auto w      = (count == 4) ? components[3] : 0.0f;
+                    const auto packed = vertex_packer::pack_snorm_1010102(components[0], components[1], components[2], w);
+
+                    std::memcpy(target, &packed, sizeof(packed));
+                }
+                break;
+
+            case vertex_element_format::normalized_byte4:
+                for (std::uint32_t c = 0; c < 4; ++c)
+                {
+                    const auto value = (c < count) ? components[c] : 0.0f;
+
+                    target[c] = static_cast<std::uint8_t>(static_cast<std::int8_t>(snorm(value, 127.0f)));
+                }
+                break;
+
+            case vertex_element_format::byte4:
+                for (std::uint32_t c = 0; c < 4; ++c)
+                {
+                    target[c] = static_cast<std::uint8_t>((c < count) ? components[c] : 0.0f);
+                }
+                break;
+
+            case vertex_element_format::color:
+                {
+                    // Quantized weights still add up to one, the rounding error goes to the largest weight
+                    std::int32_t weights[4] = { 0, 0, 0, 0 };
+                    std::int32_t sum        = 0;
+                    std::int32_t largest    = 0;
+
+                    for (std::uint32_t c = 0; c < count; ++c)
+                    {
+                        weights[c] = static_cast<std::int32_t>(std::lround(std::clamp(components[c], 0.0f, 1.0f) * 255.0f));
+                        sum       += weights[c];
+                        largest    = (weights[c] > weights[largest]) ? static_cast<std::int32_t>(c) : largest;
+                    }
+
+                    if (sum > 0)
+                    {
+                        weights[largest] = std::clamp(weights[largest] + 255 - sum, 0, 255);
+                    }
+
+                    for (std::uint32_t c = 0; c < 4; ++c)
+                    {
+                        target[c] = static_cast<std::uint8_t>(weights[c]);
+                    }
+                }
+                break;
+
+            default:
+                Expects(false);
+            }
+        }
+    }
+
+    void vertex_packer::pack(mesh_part_description& part, const format_predicate& is_supported) noexcept
+    {
+        if (part.vertex_count == 0)
+        {
+            return;
+        }
+
+        Expects(part.vertex_data.size() >= std::size_t { part.vertex_count } * part.vertex_stride);
+
+        std::vector<vertex_element> elements;
+        std::uint32_t               stride  = 0;
+        bool                        changed = false;
+
+        elements.reserve(part.vertex_elements.size());
+
+        for (const auto& element : part.vertex_elements)
+        {
+            const auto format = packed_format(element, part, is_supported);
+
+            elements.push_back({ stride, format, element.usage(), element.usage_index() });
+
+            stride += element_size(format);
+            changed = changed || (format != element.format());
+        }
+
+        if (!changed)
+        {
+            return;
+        }
+
+        std::vector<std::uint8_t> data(std::size_t { stride } * part.vertex_count);
+
+        for (std::uint32_t v = 0; v < part.vertex_count; ++v)
+        {
+            const auto source = part.vertex_data.data() + std::size_t { v } * part.vertex_stride;
+            const auto target = data.data() + std::size_t { v } * stride;
+
+            for (std::size_t e = 0; e < elements.size(); ++e)
+            {
+                const auto& from = part.vertex_elements[e];
+                const auto& to   = elements[e];
+
+                if (from.format() == to.format())
+                {
+                    std::memcpy(target + to.offset(), source + from.offset(), element_size(from.format()));
+                }
+                else
+                {
+                    const auto count = component_count(from.format());
+
+                    write_element(to.format(), count, read_components(source + from.offset(), count), target + to.offset());
+                }
+            }
+        }
+
+        part.vertex_elements = std::move(elements);
+        part.vertex_stride   = stride;
+        part.vertex_data     = std::move(data);
+    }
+
+    std::uint32_t vertex_packer::element_size(vertex_element_format format) noexcept
+    {
+        switch (format)
+        {
+        case vertex_element_format::single:
+        case vertex_element_format::color:
+        case vertex_element_format::byte4:
+        case vertex_element_format::short2:
+        case vertex_element_format::normalized_short2:
+        case vertex_element_format::half_vector2:
+        case vertex_element_format::normalized_byte4:
+        case vertex_element_format::normalized_packed:
+            return 4;
+
+        case vertex_element_format::vector2:
+        case vertex_element_format::short4:
+        case vertex_element_format::ushort4:
+        case vertex_element_format::normalized_short4:
+        case vertex_element_format::half_vector4:
+            return 8;
+
+        case vertex_element_format::vector3:
+            return 12;
+
+        case vertex_element_format::vector4:
+        default:
+            return 16;
+        }
+    }
+
+    std::uint16_t vertex_packer::to_half(float value) noexcept
+    {
+        std::uint32_t bits;
+
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        const auto sign     = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+        const auto exponent = static_cast<std::int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+        auto       mantissa = bits & 0x007FFFFF;
+
+        // Infinity and NaN
+        if ((bits & 0x7FFFFFFF) >= 0x7F800000)
+        {
+            return sign | 0x7C00 | ((mantissa != 0) ? 0x0200 : 0);
+        }
+
+        // Overflow
+        if (exponent >= 31)
+        {
+            return sign | 0x7C00;
+        }
+
+        // Subnormal halfs, or zero when too small
+        if (exponent <= 0)
+        {
+            if (exponent < -10)
+            {
+                return sign;
+            }
+
+            mantissa |= 0x00800000;
+
+            const auto shift    = static_cast<std::uint32_t>(14 - exponent);
+            const auto halfway  = 1u << (shift - 1);
+            const auto rest     = mantissa & ((1u << shift) - 1);
+            auto       half     = mantissa >> shift;
+
+            if (rest > halfway || (rest == halfway && (half & 1)))
+            {
+                half++;
+            }
+
+            return sign | static_cast<std::uint16_t>(half);
+        }
+
+        auto half = (static_cast<std::uint32_t>(exponent) << 10) | (mantissa >> 13);
+
+        // Round to nearest even, a carry into the exponent is still correctly rounded
+        const auto rest = mantissa & 0x1FFF;
+
+        if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+        {
+            half++;
+        }
+
+        return sign | static_cast<std::uint16_t>(half);
+    }
+
+    float vertex_packer::from_half(std::uint16_t value) noexcept
+    {
+        const auto sign     = static_cast<std::uint32_t>(value & 0x8000) << 16;
+        auto       exponent = static_cast<std::uint32_t>(value >> 10) & 0x1F;
+        auto       mantissa = static_cast<std::uint32_t>(value) & 0x03FF;
+        auto       bits     = sign;
+
+        if (exponent == 0x1F)
+        {
+            bits |= 0x7F800000 | (mantissa << 13);
+        }
+        else if (exponent != 0)
+        {
+            bits |= ((exponent + 127 - 15) << 23) | (mantissa << 13);
+        }
+        else if (mantissa != 0)
+        {
+            // Normalize the subnormal half
+            exponent = 127 - 15 + 1;
+
+            while ((mantissa & 0x0400) == 0)
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+
+            bits |= (exponent << 23) | ((mantissa & 0x03FF) << 13);
+        }
+
+        float result;
+
+        std::memcpy(&result, &bits, sizeof(result));
+
+        return result;
+    }
+
+    std::uint32_t vertex_packer::pack_snorm_1010102(float x, float y, float z, float w) noexcept
+    {
+        return (static_cast<std::uint32_t>(snorm(x, 511.0f)) & 0x3FF)
+             | (static_cast<std::uint32_t>(snorm(y, 511.0f)) & 0x3FF) << 10
+             | (static_cast<std::uint32_t>(snorm(z, 511.0f)) & 0x3FF) << 20
+             | (static_cast<std::uint32_t>(snorm(w, 1.0f))   & 0x003) << 30;
+    }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_CONTENT_VERTEX_PACKER_HPP
+#define SCENER_CONTENT_VERTEX_PACKER_HPP
+
+#include <cstdint>
+#include <functional>
+
+#include "scener/graphics/vertex_element_format.hpp"
+
+namespace scener::content
+{
+    class mesh_part_description;
+
+    /// Load time vertex attribute quantization.
+    /// Rewrites the interleaved float attributes of a mesh part with compact formats the vertex fetch expands back
+    /// to floats, so shaders read them unchanged: half float texture coordinates, 10-10-10-2 signed normalized
+    /// normals, binormals and tangents (8 bit when 10-10-10-2 is not supported), 8 bit joint indices and 8 bit
+    /// normalized joint weights. Positions are kept as floats.
+    class vertex_packer final
+    {
+    public:
+        /// Returns true if the device can read vertex attributes with the given format.
+        typedef std::function<bool(graphics::vertex_element_format)> format_predicate;
+
+    public:
+        /// Packs the vertex attributes of the given mesh part; attributes without a supported compact format are
+        /// kept as they are.
+        /// \param part the mesh part description.
+        /// \param is_supported the vertex formats supported by the device.
+        static void pack(mesh_part_description& part, const format_predicate& is_supported) noexcept;
+
+        /// Gets the size, in bytes, of a vertex element with the given format.
+        static std::uint32_t element_size(graphics::vertex_element_format format) noexcept;
+
+        /// Converts a single precision float to half precision, rounding to nearest even.
+        static std::uint16_t to_half(float value) noexcept;
+
+        /// Converts a half precision float to single precision.
+        static float from_half(std::uint16_t value) noexcept;
+
+        /// Packs four signed normalized values into 10-10-10-2 bits, x in the lowest bits.
+        static std::uint32_t pack_snorm_1010102(float x, float y, float z, float w) noexcept;
+    };
+}
+
+#endif // SCENER_CONTENT_VERTEX_PACKER_HPP
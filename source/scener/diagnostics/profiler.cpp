@@ -0,0 +1,330 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/diagnostics/profiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+namespace scener::diagnostics
+{
+    namespace
+    {
+        using clock = std::chrono::steady_clock;
+
+        struct profiler_state
+        {
+            const clock::time_point           epoch        { clock::now() };
+            std::atomic<bool>                 enabled      { false };
+            std::atomic<std::uint32_t>        next_thread  { 1 };
+            std::atomic<std::uint64_t>        draws        { 0 };
+            std::atomic<std::uint64_t>        pipelines    { 0 };
+            std::atomic<std::uint64_t>        descriptors  { 0 };
+            std::atomic<std::uint64_t>        buffers      { 0 };
+            std::atomic<std::uint64_t>        uploaded     { 0 };
+            std::atomic<std::uint64_t>        dropped      { 0 };
+            std::mutex                        mutex        { };
+            std::size_t                       capacity     { profiler::default_capacity };
+            std::vector<profile_event>        events       { };
+            std::vector<frame_statistics>     frames       { };
+            std::uint64_t                     frame        { 0 };
+            std::uint64_t                     frame_start  { 0 };
+        };
+
+        profiler_state& state() noexcept
+        {
+            static profiler_state instance;
+
+            return instance;
+        }
+
+        std::uint32_t thread_id() noexcept
+        {
+            // Small sequential ids keep the trace viewer rows readable
+            thread_local const std::uint32_t id = state().next_thread.fetch_add(1, std::memory_order_relaxed);
+
+            return id;
+        }
+
+        void push(const profile_event& event) noexcept
+        {
+            auto& current = state();
+
+            std::lock_guard<std::mutex> lock(current.mutex);
+
+            if (current.events.size() >= current.capacity)
+            {
+                current.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            current.events.push_back(event);
+        }
+
+        void write_string(std::ostream& stream, const char* value) noexcept
+        {
+            stream << '"';
+
+            for (const char* c = value; c != nullptr && *c != '\0'; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                {
+                    stream << '\\';
+                }
+                stream << *c;
+            }
+
+            stream << '"';
+        }
+
+        void write_microseconds(std::ostream& stream, std::uint64_t nanoseconds) noexcept
+        {
+            // Trace timestamps are microseconds, keep the nanosecond precision as decimals
+            const auto fraction = nanoseconds % 1000;
+
+            stream << (nanoseconds / 1000) << '.' << (fraction / 100) << ((fraction / 10) % 10) << (fraction % 10);
+        }
+    }
+
+    bool profiler::enabled() noexcept
+    {
+        return state().enabled.load(std::memory_order_relaxed);
+    }
+
+    void profiler::enabled(bool value) noexcept
+    {
+        state().enabled.store(value, std::memory_order_relaxed);
+    }
+
+    void profiler::capacity(std::size_t value) noexcept
+    {
+        auto& current = state();
+
+        std::lock_guard<std::mutex> lock(current.mutex);
+
+        current.capacity = value;
+    }
+
+    std::uint64_t profiler::now() noexcept
+    {
+        const auto elapsed = clock::now() - state().epoch;
+
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    void profiler::record(const char* name, const char* category, std::uint64_t start, std::uint64_t end) noexcept
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        push({ name, category, thread_id(), start, (end > start) ? end - start : 0 });
+    }
+
+    void profiler::record_gpu(const char* name, std::uint64_t start, std::uint64_t duration) noexcept
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        push({ name, "gpu", gpu_thread, start, duration });
+    }
+
+    void profiler::mark(const char* name, const char* category) noexcept
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        push({ name, category, thread_id(), now(), 0 });
+    }
+
+    void profiler::add(const frame_counters& counters) noexcept
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        auto& current = state();
+
+        current.draws.fetch_add(counters.draws, std::memory_order_relaxed);
+        current.pipelines.fetch_add(counters.pipeline_binds, std::memory_order_relaxed);
+        current.descriptors.fetch_add(counters.descriptor_binds, std::memory_order_relaxed);
+        current.buffers.fetch_add(counters.buffer_binds, std::memory_order_relaxed);
+        current.uploaded.fetch_add(counters.uploaded_bytes, std::memory_order_relaxed);
+    }
+
+    void profiler::add_uploaded_bytes(std::uint64_t count) noexcept
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        state().uploaded.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void profiler::begin_frame() noexcept
+    {
+        auto& current = state();
+
+        std::lock_guard<std::mutex> lock(current.mutex);
+
+        current.frame_start = now();
+    }
+
+    void profiler::end_frame() noexcept
+    {
+        auto& current = state();
+        auto  stats   = frame_statistics { };
+
+        stats.counters.draws            = current.draws.exchange(0, std::memory_order_relaxed);
+        stats.counters.pipeline_binds   = current.pipelines.exchange(0, std::memory_order_relaxed);
+        stats.counters.descriptor_binds = current.descriptors.exchange(0, std::memory_order_relaxed);
+        stats.counters.buffer_binds     = current.buffers.exchange(0, std::memory_order_relaxed);
+        stats.counters.uploaded_bytes   = current.uploaded.exchange(0, std::memory_order_relaxed);
+
+        if (!enabled())
+        {
+            return;
+        }
+
+        const auto end = now();
+
+        std::lock_guard<std::mutex> lock(current.mutex);
+
+        stats.frame    = current.frame++;
+        stats.start    = current.frame_start;
+        stats.duration = end - current.frame_start;
+
+        if (current.frames.size() >= current.capacity)
+        {
+            current.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        current.frames.push_back(stats);
+    }
+
+    std::vector<profile_event> profiler::events() noexcept
+    {
+        auto& current = state();
+
+        std::lock_guard<std::mutex> lock(current.mutex);
+
+        return current.events;
+    }
+
+    std::vector<frame_statistics> profiler::frames() noexcept
+    {
+        auto& current = state();
+
+        std::lock_guard<std::mutex> lock(current.mutex);
+
+        return current.frames;
+    }
+
+    std::uint64_t profiler::dropped() noexcept
+    {
+        return state().dropped.load(std::memory_order_relaxed);
+    }
+
+    void profiler::clear() noexcept
+    {
+        auto& current = state();
+
+        std::lock_guard<std::mutex> lock(current.mutex);
+
+        current.events.clear();
+        current.frames.clear();
+        current.dropped.store(0, std::memory_order_relaxed);
+    }
+
+    void profiler::write_chrome_trace(std::ostream& stream) noexcept
+    {
+        const auto recorded = events();
+        const auto stats    = frames();
+        auto       first    = true;
+
+        const auto separator = [&] () -> void
+        {
+            stream << (first ? "\n" : ",\n");
+            first = false;
+        };
+
+        stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        separator();
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"frames\"}}";
+        separator();
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << gpu_thread
+               << ",\"args\":{\"name\":\"gpu\"}}";
+
+        for (const auto& event : recorded)
+        {
+            separator();
+            stream << "{\"name\":";
+            write_string(stream, event.name);
+            stream << ",\"cat\":";
+            write_string(stream, event.category);
+
+            if (event.duration == 0)
+            {
+                stream << ",\"ph\":\"i\",\"s\":\"t\",\"ts\":";
+                write_microseconds(stream, event.start);
+            }
+            else
+            {
+                stream << ",\"ph\":\"X\",\"ts\":";
+                write_microseconds(stream, event.start);
+                stream << ",\"dur\":";
+                write_microseconds(stream, event.duration);
+            }
+
+            stream << ",\"pid\":1,\"tid\":" << event.thread << "}";
+        }
+
+        for (const auto& frame : stats)
+        {
+            separator();
+            stream << "{\"name\":\"frame\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":";
+            write_microseconds(stream, frame.start);
+            stream << ",\"dur\":";
+            write_microseconds(stream, frame.duration);
+            stream << ",\"pid\":1,\"tid\":0,\"args\":{\"frame\":" << frame.frame << "}}";
+
+            separator();
+            stream << "{\"name\":\"frame_counters\",\"ph\":\"C\",\"ts\":";
+            write_microseconds(stream, frame.start);
+            stream << ",\"pid\":1,\"args\":{"
+                   << "\"draws\":"            << frame.counters.draws
+                   << ",\"pipeline_binds\":"   << frame.counters.pipeline_binds
+                   << ",\"descriptor_binds\":" << frame.counters.descriptor_binds
+                   << ",\"buffer_binds\":"     << frame.counters.buffer_binds
+                   << ",\"uploaded_bytes\":"   << frame.counters.uploaded_bytes
+                   << "}}";
+        }
+
+        stream << "\n]}\n";
+    }
+
+    bool profiler::save_chrome_trace(const std::string& path) noexcept
+    {
+        std::ofstream stream(path, std::ios::out | std::ios::trunc);
+
+        if (!stream.is_open())
+        {
+            return false;
+        }
+
+        write_chrome_trace(stream);
+
+        return stream.good();
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_DIAGNOSTICS_PROFILER_HPP
+#define SCENER_DIAGNOSTICS_PROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace scener::diagnostics
+{
+    /// Counters of the work submitted to the device during a frame.
+    struct frame_counters final
+    {
+        std::uint64_t draws            { 0 }; ///< Number of draw calls.
+        std::uint64_t pipeline_binds   { 0 }; ///< Number of graphics pipeline binds.
+        std::uint64_t descriptor_binds { 0 }; ///< Number of descriptor set binds.
+        std::uint64_t buffer_binds     { 0 }; ///< Number of vertex and index buffer binds.
+        std::uint64_t uploaded_bytes   { 0 }; ///< Number of bytes copied to device memory.
+    };
+
+    /// Statistics of a completed frame.
+    struct frame_statistics final
+    {
+        std::uint64_t  frame    { 0 }; ///< The frame number.
+        std::uint64_t  start    { 0 }; ///< Frame start, in nanoseconds since the profiler epoch.
+        std::uint64_t  duration { 0 }; ///< Frame duration, in nanoseconds.
+        frame_counters counters { };   ///< The work submitted during the frame.
+    };
+
+    /// A timed region recorded by the profiler.
+    struct profile_event final
+    {
+        const char*   name     { nullptr }; ///< The region name, must have static storage duration.
+        const char*   category { nullptr }; ///< The region category, must have static storage duration.
+        std::uint32_t thread   { 0 };       ///< The recording thread, or profiler::gpu_thread for device timings.
+        std::uint64_t start    { 0 };       ///< Region start, in nanoseconds since the profiler epoch.
+        std::uint64_t duration { 0 };       ///< Region duration, in nanoseconds; zero for instant markers.
+    };
+
+    /// Collects CPU zones, device timings and per-frame counters, and exports them as Chrome trace JSON
+    /// (chrome://tracing, Perfetto). Recording is disabled by default, zones are close to free while disabled.
+    class profiler final
+    {
+    public:
+        /// The thread id used for the device (GPU) timeline.
+        constexpr static const std::uint32_t gpu_thread = 0xFFFF;
+
+        /// The default maximum number of recorded events.
+        constexpr static const std::size_t default_capacity = 1 << 20;
+
+    public:
+        /// Gets a value indicating whether recording is enabled.
+        /// \returns true if recording is enabled; false otherwise.
+        static bool enabled() noexcept;
+
+        /// Enables or disables recording.
+        /// \param value true to enable recording; false otherwise.
+        static void enabled(bool value) noexcept;
+
+        /// Sets the maximum number of recorded events, newer events are dropped once reached.
+        /// \param value the maximum number of events.
+        static void capacity(std::size_t value) noexcept;
+
+        /// Gets the current time.
+        /// \returns the number of nanoseconds elapsed since the profiler epoch.
+        static std::uint64_t now() noexcept;
+
+        /// Records a timed region on the calling thread.
+        /// \param name the region name.
+        /// \param category the region category.
+        /// \param start region start, in nanoseconds since the profiler epoch.
+        /// \param end region end, in nanoseconds since the profiler epoch.
+        static void record(const char* name, const char* category, std::uint64_t start, std::uint64_t end) noexcept;
+
+        /// Records a timed region on the device timeline.
+        /// \param name the region name.
+        /// \param start region start, in nanoseconds since the profiler epoch.
+        /// \param duration region duration, in nanoseconds.
+        static void record_gpu(const char* name, std::uint64_t start, std::uint64_t duration) noexcept;
+
+        /// Records an instant marker on the calling thread.
+        /// \param name the marker name.
+        /// \param category the marker category.
+        static void mark(const char* name, const char* category) noexcept;
+
+        /// Adds the given counters to the current frame.
+        /// \param counters the counters to add.
+        static void add(const frame_counters& counters) noexcept;
+
+        /// Adds the given number of uploaded bytes to the current frame.
+        /// \param count the number of bytes copied to device memory.
+        static void add_uploaded_bytes(std::uint64_t count) noexcept;
+
+        /// Starts a new frame.
+        static void begin_frame() noexcept;
+
+        /// Completes the current frame, storing its statistics and resetting the frame counters.
+        static void end_frame() noexcept;
+
+        /// Gets a copy of the recorded events.
+        /// \returns the recorded events.
+        static std::vector<profile_event> events() noexcept;
+
+        /// Gets a copy of the statistics of the completed frames.
+        /// \returns the statistics of the completed frames.
+        static std::vector<frame_statistics> frames() noexcept;
+
+        /// Gets the number of events dropped because the capacity has been reached.
+        /// \returns the number of dropped events.
+        static std::uint64_t dropped() noexcept;
+
+        /// Discards all the recorded events and frame statistics.
+        static void clear() noexcept;
+
+        /// Writes the recorded events and frame counters in Chrome trace event format.
+        /// \param stream the output stream.
+        static void write_chrome_trace(std::ostream& stream) noexcept;
+
+        /// Writes the recorded events and frame counters in Chrome trace event format to the given file.
+        /// \param path the output file path.
+        /// \returns true if the file has been written; false otherwise.
+        static bool save_chrome_trace(const std::string& path) noexcept;
+
+    private:
+        profiler() = delete;
+        profiler(const profiler& profiler) = delete;
+        profiler& operator=(const profiler& profiler) = delete;
+    };
+
+    /// Records the lifetime of the object as a CPU zone.
+    class profile_zone final
+    {
+    public:
+        /// Starts a new zone.
+        /// \param name the zone name, must have static storage duration.
+        /// \param category the zone category, must have static storage duration.
+        explicit profile_zone(const char* name, const char* category = "cpu") noexcept
+            : _name     { name }
+            , _category { category }
+            , _active   { profiler::enabled() }
+            , _start    { _active ? profiler::now() : 0 }
+        {
+        }
+
+        /// Ends the zone.
+        ~profile_zone()
+        {
+            if (_active)
+            {
+                profiler::record(_name, _category, _start, profiler::now());
+            }
+        }
+
+    private:
+        profile_zone(const profile_zone& zone) = delete;
+        profile_zone& operator=(const profile_zone& zone) = delete;
+
+    private:
+        const char*   _name;
+        const char*   _category;
+        bool          _active;
+        std::uint64_t _start;
+    };
+}
+
+#endif // SCENER_DIAGNOSTICS_PROFILER_HPP
@@ -7,6 +7,23 @@ namespace scener::graphics
 {
     using scener::timespan;
 
+    // The animation time is eased towards the target time by pi / 16 (0.19635) per update, as a 14 bit fraction
+    constexpr std::int64_t easing_numerator   = 3217;
+    constexpr std::int64_t easing_denominator = 16384;
+
+    animation::animation(const std::string& name, const std::vector<keyframe>& keyframes) noexcept
+        : _current_time     { 0 }
+        , _duration         { 0 }
+        , _current_keyframe { 0 }
+        , _keyframes        { keyframes }
+        , _name             { name }
+    {
+        if (!_keyframes.empty())
+        {
+            _duration = _keyframes.crbegin()->time();
+        }
+    }
+
     const timespan& animation::current_time() const noexcept
     {
         return _current_time;
@@ -45,15 +62,13 @@ namespace scener::graphics
             // If we reached the end, loop back to the start.
             if (current_time >= _duration)
             {
-                current_time      = 0;
+                current_time      = (_duration > timespan::zero()) ? current_time.wrap(_duration) : timespan::zero();
                 _current_time     = 0;
                 _current_keyframe = 0;
             }
         }
 
-        _current_time = timespan::from_seconds(scener::math::lerp(_current_time.total_seconds()
-                                                                 , current_time.total_seconds()
-                                                                 , scener::math::pi<double> / 16));
+        _current_time = timespan::lerp(_current_time, current_time, easing_numerator, easing_denominator);
 
         while (_current_keyframe < count)
         {
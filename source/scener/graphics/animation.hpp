@@ -17,6 +17,15 @@ namespace scener::graphics
     /// Stores keyframe based animations.
     class animation final
     {
+    public:
+        /// Initializes a new instance of the animation class.
+        animation() = default;
+
+        /// Initializes a new instance of the animation class with the given keyframes.
+        /// \param name the animation name.
+        /// \param keyframes the animation keyframes, sorted by time; the last one sets the animation duration.
+        animation(const std::string& name, const std::vector<keyframe>& keyframes) noexcept;
+
     public:
         /// Gets the current time of the animation.
         /// \returns the current time of the animation.
@@ -7,6 +7,16 @@ namespace scener::graphics
 {
     using scener::math::matrix4;
 
+    bone::bone(index_type index, const std::string& name, const std::shared_ptr<graphics::animation>& animation) noexcept
+        : _index     { index }
+        , _children  { }
+        , _parent    { nullptr }
+        , _animation { animation }
+        , _transform { matrix4::identity() }
+        , _name      { name }
+    {
+    }
+
     bone::index_type bone::index() const noexcept
     {
         return _index;
@@ -41,4 +51,11 @@ namespace scener::graphics
     {
         _transform = transform;
     }
+
+    void bone::add_child(const std::shared_ptr<bone>& child) noexcept
+    {
+        child->_parent = shared_from_this();
+
+        _children.push_back(child);
+    }
 }
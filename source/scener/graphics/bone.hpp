@@ -18,11 +18,21 @@ namespace scener::graphics
     class animation;
 
     /// Represents bone data for a skeleton.
-    class bone final
+    class bone final : public std::enable_shared_from_this<bone>
     {
     public:
         typedef std::size_t index_type;
 
+    public:
+        /// Initializes a new instance of the bone class.
+        bone() = default;
+
+        /// Initializes a new instance of the bone class.
+        /// \param index the index of the bone in the skeleton bones collection.
+        /// \param name the bone name.
+        /// \param animation the bone animation; nullptr when the bone is not animated.
+        bone(index_type index, const std::string& name, const std::shared_ptr<graphics::animation>& animation) noexcept;
+
     public:
         /// Gets the index of this bone in the Bones collection.
         /// \returns the index of this bone in the Bones collection.
@@ -52,6 +62,10 @@ namespace scener::graphics
         /// \param transform the matrix used to transform this bone relative only to its parent bone.
         void transform(const scener::math::matrix4& transform) noexcept;
 
+        /// Adds the given bone to the children of this bone.
+        /// \param child the child bone.
+        void add_child(const std::shared_ptr<bone>& child) noexcept;
+
     private:
         index_type                           _index     { 0 };
         std::vector<std::shared_ptr<bone>>   _children  { };
@@ -0,0 +1,171 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/bone_palette.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "scener/graphics/graphics_device.hpp"
+
+namespace scener::graphics
+{
+    using scener::math::matrix4;
+
+    namespace
+    {
+        constexpr std::uint32_t palette_stride(bone_palette_format format) noexcept
+        {
+            return (format == bone_palette_format::matrix3x4) ? sizeof(float) * 12 : sizeof(matrix4);
+        }
+    }
+
+    bone_palette::bone_palette(gsl::not_null<graphics_device*> device
+                             , std::uint32_t                   capacity
+                             , bone_palette_format             format) noexcept
+        : graphics_resource { device }
+        , _capacity         { capacity }
+        , _joint_count      { 0 }
+        , _format           { format }
+        , _free             { }
+        , _packed           { }
+        , _buffer           { device->create_storage_buffer(capacity * palette_stride(format)) }
+    {
+        Expects(capacity > 0);
+    }
+
+    std::uint32_t bone_palette::capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    std::uint32_t bone_palette::joint_count() const noexcept
+    {
+        return _joint_count;
+    }
+
+    bone_palette_format bone_palette::format() const noexcept
+    {
+        return _format;
+    }
+
+    std::uint32_t bone_palette::stride() const noexcept
+    {
+        return palette_stride(_format);
+    }
+
+    std::uint32_t bone_palette::allocate(std::uint32_t count) noexcept
+    {
+        // First fit on the released ranges, kept sorted by offset
+        const auto it = std::find_if(_free.begin(), _free.end(), [&] (const range& free) -> bool
+        {
+            return free.count >= count;
+        });
+
+        if (it != _free.end())
+        {
+            const auto offset = it->offset;
+
+            it->offset += count;
+            it->count  -= count;
+
+            if (it->count == 0)
+            {
+                _free.erase(it);
+            }
+
+            return offset;
+        }
+
+        Expects(count <= _capacity - _joint_count);
+
+        const auto offset = _joint_count;
+
+        _joint_count += count;
+
+        return offset;
+    }
+
+    void bone_palette::release(std::uint32_t offset, std::uint32_t count) noexcept
+    {
+        Expects(offset + count <= _joint_count);
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        auto next = std::lower_bound(_free.begin(), _free.end(), offset, [] (const range& free, std::uint32_t value) -> bool
+        {
+            return free.offset < value;
+        });
+
+        // Released twice, or overlapping a released range
+        Expects(next == _free.end() || offset + count <= next->offset);
+        Expects(next == _free.begin() || std::prev(next)->offset + std::prev(next)->count <= offset);
+
+        // Merge with the adjacent released ranges
+        if (next != _free.begin() && std::prev(next)->offset + std::prev(next)->count == offset)
+        {
+            next = std::prev(next);
+            next->count += count;
+        }
+        else
+        {
+            next = _free.insert(next, { offset, count });
+        }
+
+        const auto following = std::next(next);
+
+        if (following != _free.end() && next->offset + next->count == following->offset)
+        {
+            next->count += following->count;
+            _free.erase(following);
+        }
+
+        // A released range at the end of the palette gives the joints back to the tail
+        if (_free.back().offset + _free.back().count == _joint_count)
+        {
+            _joint_count = _free.back().offset;
+            _free.pop_back();
+        }
+    }
+
+    void bone_palette::set_data(std::uint32_t offset, const gsl::span<const matrix4>& transforms) noexcept
+    {
+        const auto count = static_cast<std::uint32_t>(transforms.size());
+
+        Expects(offset + count <= _joint_count);
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (_format == bone_palette_format::matrix4x4)
+        {
+            _buffer.set_data(offset * stride(), count * stride(), transforms.data());
+            return;
+        }
+
+        // The shaders read matrices column major, so the rows of the affine 3x4 matrix are the first three
+        // columns of the (row major) joint matrix; its last column is always (0, 0, 0, 1)
+        _packed.resize(count * 12);
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const float* source = transforms[i].data();
+            float*       target = _packed.data() + i * 12;
+
+            for (std::uint32_t row = 0; row < 3; ++row)
+            {
+                target[row * 4 + 0] = source[row];
+                target[row * 4 + 1] = source[row + 4];
+                target[row * 4 + 2] = source[row + 8];
+                target[row * 4 + 3] = source[row + 12];
+            }
+        }
+
+        _buffer.set_data(offset * stride(), count * stride(), _packed.data());
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_BONE_PALETTE_HPP
+#define SCENER_GRAPHICS_BONE_PALETTE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "scener/graphics/bone_palette_format.hpp"
+#include "scener/graphics/graphics_resource.hpp"
+#include "scener/graphics/vulkan/buffer.hpp"
+#include "scener/math/matrix.hpp"
+
+namespace scener::graphics::vulkan { class logical_device; }
+
+namespace scener::graphics
+{
+    class graphics_device;
+
+    /// Represents a host visible storage buffer shared by every skinned draw, holding the joint matrices of all
+    /// the skeletons. Each skeleton owns a range sized to its joint count; draws index the palette through the
+    /// range base offset. Released ranges are reused by later allocations.
+    class bone_palette final : public graphics_resource
+    {
+    public:
+        /// Initializes a new instance of the bone_palette class.
+        /// \param device the graphics device associated with this bone palette.
+        /// \param capacity the maximum number of joints the palette can hold.
+        /// \param format the layout of the stored joint matrices.
+        bone_palette(gsl::not_null<graphics_device*> device, std::uint32_t capacity, bone_palette_format format) noexcept;
+
+    public:
+        /// Gets the maximum number of joints the palette can hold.
+        /// \returns the maximum number of joints the palette can hold.
+        std::uint32_t capacity() const noexcept;
+
+        /// Gets the number of joints in use, from the start of the palette to the end of the last allocated range.
+        /// \returns the number of joints in use, including any released range below the last allocated one.
+        std::uint32_t joint_count() const noexcept;
+
+        /// Gets the layout of the stored joint matrices.
+        /// \returns the layout of the stored joint matrices.
+        bone_palette_format format() const noexcept;
+
+        /// Gets the size, in bytes, of a single joint matrix.
+        /// \returns the size, in bytes, of a single joint matrix.
+        std::uint32_t stride() const noexcept;
+
+        /// Reserves a range of joints in the palette.
+        /// \param count the number of joints to reserve.
+        /// \returns the index of the first joint of the range.
+        std::uint32_t allocate(std::uint32_t count) noexcept;
+
+        /// Releases a range of joints, so it can be reused by later allocations.
+        /// \param offset the index of the first joint of the range, as returned by allocate.
+        /// \param count the number of joints of the range.
+        void release(std::uint32_t offset, std::uint32_t count) noexcept;
+
+        /// Writes joint matrices into the palette.
+        /// \param offset the index of the first joint to write, as returned by allocate.
+        /// \param transforms the joint matrices.
+        void set_data(std::uint32_t offset, const gsl::span<const math::matrix4>& transforms) noexcept;
+
+    private:
+        struct range
+        {
+            std::uint32_t offset;
+            std::uint32_t count;
+        };
+
+    private:
+        std::uint32_t       _capacity;
+        std::uint32_t       _joint_count;
+        bone_palette_format _format;
+        std::vector<range>  _free;
+        std::vector<float>  _packed;
+        vulkan::buffer      _buffer;
+
+        friend class scener::graphics::vulkan::logical_device;
+    };
+}
+
+#endif // SCENER_GRAPHICS_BONE_PALETTE_HPP
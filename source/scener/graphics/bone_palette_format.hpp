@@ -0,0 +1,19 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_BONE_PALETTE_FORMAT_HPP
+#define SCENER_GRAPHICS_BONE_PALETTE_FORMAT_HPP
+
+#include <cstdint>
+
+namespace scener::graphics
+{
+    /// Defines the layout of the joint matrices stored in the bone palette.
+    enum class bone_palette_format : std::uint32_t
+    {
+        matrix4x4 = 0 ///< Full 4x4 matrices, 64 bytes per joint.
+      , matrix3x4 = 1 ///< Affine 3x4 matrices (the constant last column is dropped), 48 bytes per joint.
+    };
+}
+
+#endif // SCENER_GRAPHICS_BONE_PALETTE_FORMAT_HPP
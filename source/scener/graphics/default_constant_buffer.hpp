@@ -4,6 +4,8 @@
 #ifndef SCENER_GRAPHICS_DEFAULT_CONSTANT_BUFFER_HPP
 #define SCENER_GRAPHICS_DEFAULT_CONSTANT_BUFFER_HPP
 
+#include <cstdint>
+
 #include "scener/math/matrix.hpp"
 #include "scener/math/basic_matrix.hpp"
 #include "scener/math/basic_quaternion.hpp"
@@ -17,7 +19,6 @@ namespace scener::graphics
     {
     public:       
         // Vertex shader
-        math::matrix4 u_jointMat[57];
         math::matrix4 u_normalMatrix;
         math::matrix4 u_modelViewMatrix;
         math::matrix4 u_projectionMatrix;
@@ -32,6 +33,10 @@ namespace scener::graphics
         float         u_light0LinearAttenuation;
         float         u_light0QuadraticAttenuation;
         math::vector3 u_light0Color;
+
+        // Skinning, packed after u_light0Color as in the std140 layout.
+        // Index of the first joint matrix in the bone palette storage buffer.
+        std::uint32_t u_jointOffset;
     };
 }
 
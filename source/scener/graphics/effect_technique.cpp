@@ -3,6 +3,7 @@
 
 #include "scener/graphics/effect_technique.hpp"
 
+#include "scener/graphics/bone_palette.hpp"
 #include "scener/graphics/effect_parameter.hpp"
 #include "scener/graphics/effect_pass.hpp"
 #include "scener/graphics/graphics_device.hpp"
@@ -18,6 +19,8 @@ namespace scener::graphics
         , _alpha                     { 1.0 }
         , _ambient_light_color       { vector3::zero() }
         , _bone_transforms           { }
+        , _bone_palette_offset       { }
+        , _bone_palette_count        { 0 }
         , _diffuse_color             { vector3::one() }
         , _light_0                   { }
         , _light_1                   { }
@@ -38,6 +41,14 @@ namespace scener::graphics
     {
     }
 
+    effect_technique::~effect_technique()
+    {
+        if (_bone_palette_count != 0)
+        {
+            _graphics_device->bone_palette()->release(_bone_palette_offset.value(), _bone_palette_count);
+        }
+    }
+
     float effect_technique::alpha() const noexcept
     {
         return _alpha;
@@ -187,6 +198,11 @@ namespace scener::graphics
         return _textures;
     }
 
+    const std::vector<std::shared_ptr<texture2d>>& effect_technique::textures() const noexcept
+    {
+        return _textures;
+    }
+
     bool effect_technique::texture_enabled() const noexcept
     {
         return _texture_enabled;
@@ -243,11 +259,50 @@ namespace scener::graphics
 
     void effect_technique::bone_transforms(const std::vector<matrix4>& boneTransforms) noexcept
     {
+        auto palette = _graphics_device->bone_palette();
+
         _bone_transforms.clear();
         _bone_transforms.reserve(boneTransforms.size());
         _bone_transforms.assign(boneTransforms.begin(), boneTransforms.end());
 
-        _bones_param->set_value(_bone_transforms);
+        if (!_bone_palette_offset.has_value())
+        {
+            const auto count = static_cast<std::uint32_t>(_bone_transforms.size());
+
+            bone_palette_offset(palette->allocate(count));
+
+            _bone_palette_count = count;
+        }
+
+        palette->set_data(_bone_palette_offset.value(), _bone_transforms);
+    }
+
+    bool effect_technique::skinned() const noexcept
+    {
+        return _bones_param.get() != nullptr;
+    }
+
+    std::uint32_t effect_technique::bone_palette_offset() const noexcept
+    {
+        return _bone_palette_offset.value_or(0);
+    }
+
+    void effect_technique::bone_palette_offset(std::uint32_t offset) noexcept
+    {
+        Expects(skinned());
+
+        if (_bone_palette_offset != offset)
+        {
+            // A range shared by the mesh replaces the one reserved for the technique own bone transforms
+            if (_bone_palette_count != 0)
+            {
+                _graphics_device->bone_palette()->release(_bone_palette_offset.value(), _bone_palette_count);
+                _bone_palette_count = 0;
+            }
+
+            _bone_palette_offset = offset;
+            _bones_param->set_value(offset);
+        }
     }
 
     const std::vector<std::shared_ptr<effect_pass>>& effect_technique::passes() const noexcept
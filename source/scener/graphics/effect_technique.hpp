@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -35,6 +36,10 @@ namespace scener::graphics
         /// \param device the graphics device associated with this effect_technique.
         effect_technique(gsl::not_null<graphics_device*> device) noexcept;
 
+        /// Releases all resources being used by this effect_technique, giving back the bone palette range it
+        /// reserved for its own bone transforms.
+        ~effect_technique() override;
+
     public:
         /// Gets the material alpha which determines its transparency.
         /// Range is between 1 (fully opaque) and 0 (fully transparent).
@@ -107,6 +112,9 @@ namespace scener::graphics
         /// Gets the textures to be applied by this effect.
         std::vector<std::shared_ptr<texture2d>>& textures() noexcept;
 
+        /// Gets the textures to be applied by this effect.
+        const std::vector<std::shared_ptr<texture2d>>& textures() const noexcept;
+
         /// Gets a value indicating wheter textures are enabled for this effect.
         bool texture_enabled() const noexcept;
 
@@ -130,8 +138,19 @@ namespace scener::graphics
         std::vector<math::matrix4> bone_transforms(std::size_t count) const noexcept;
 
         /// Sets an array of bone transform matrices for a SkinnedEffect.
+        /// The matrices are written into the device bone palette, reserving a range for them on first use.
         void bone_transforms(const std::vector<math::matrix4>& boneTransforms) noexcept;
 
+        /// Gets a value indicating whether this effect skins its geometry with the device bone palette.
+        bool skinned() const noexcept;
+
+        /// Gets the index of the first joint matrix of this effect in the device bone palette.
+        std::uint32_t bone_palette_offset() const noexcept;
+
+        /// Sets the index of the first joint matrix of this effect in the device bone palette.
+        /// \param offset the index of the first joint matrix, as returned by bone_palette::allocate.
+        void bone_palette_offset(std::uint32_t offset) noexcept;
+
     public:
         const std::vector<std::shared_ptr<effect_pass>>& passes() const noexcept;
 
@@ -146,6 +165,8 @@ namespace scener::graphics
         float                                   _alpha;
         math::vector3                           _ambient_light_color;
         std::vector<math::matrix4>              _bone_transforms;
+        std::optional<std::uint32_t>            _bone_palette_offset;
+        std::uint32_t                           _bone_palette_count;
         math::vector3                           _diffuse_color;
         directional_light                       _light_0;
         directional_light                       _light_1;
@@ -166,6 +187,7 @@ namespace scener::graphics
         std::vector<std::shared_ptr<effect_pass>>                _passes;
         std::map<std::string, std::shared_ptr<effect_parameter>> _parameters;
 
+        /// Index of the first joint matrix in the device bone palette.
         std::shared_ptr<effect_parameter> _bones_param                   = nullptr;
 
         /// Transforms from model to world coordinates using the transform's node and all of its parents.
@@ -0,0 +1,173 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/frustum_culler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace scener::graphics
+{
+    using scener::math::bounding_sphere;
+    using scener::math::matrix4;
+    using scener::math::vector3;
+
+    constexpr std::size_t k_plane_count = 6;
+
+    bounding_sphere frustum_culler::transform(const bounding_sphere& sphere, const matrix4& world) noexcept
+    {
+        // Row vector convention: p' = p * world
+        const auto& c = sphere.center;
+
+        const vector3 center = { c.x * world[0][0] + c.y * world[1][0] + c.z * world[2][0] + world[3][0]
+                               , c.x * world[0][1] + c.y * world[1][1] + c.z * world[2][1] + world[3][1]
+                               , c.x * world[0][2] + c.y * world[1][2] + c.z * world[2][2] + world[3][2] };
+
+        float max_scale = 0.0f;
+
+        for (std::size_t row = 0; row < 3; ++row)
+        {
+            const auto scale = world[row][0] * world[row][0]
+                             + world[row][1] * world[row][1]
+                             + world[row][2] * world[row][2];
+
+            max_scale = std::max(max_scale, scale);
+        }
+
+        return { center, sphere.radius * std::sqrt(max_scale) };
+    }
+
+    bounding_sphere frustum_culler::merge(const bounding_sphere& a, const bounding_sphere& b) noexcept
+    {
+        const auto dx       = b.center.x - a.center.x;
+        const auto dy       = b.center.y - a.center.y;
+        const auto dz       = b.center.z - a.center.z;
+        const auto distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        // One of the spheres already contains the other
+        if (distance + b.radius <= a.radius)
+        {
+            return a;
+        }
+        if (distance + a.radius <= b.radius)
+        {
+            return b;
+        }
+
+        // The merged sphere touches the far side of both spheres, its center lies on the line joining them
+        const auto radius = (distance + a.radius + b.radius) * 0.5f;
+        const auto t      = (radius - a.radius) / distance;
+
+        const vector3 center = { a.center.x + dx * t, a.center.y + dy * t, a.center.z + dz * t };
+
+        return { center, radius };
+    }
+
+    frustum_culler::frustum_culler(const matrix4& m) noexcept
+        : _nx { }
+        , _ny { }
+        , _nz { }
+        , _d  { }
+    {
+        // Gribb & Hartmann plane extraction for row vectors and a [0, 1] clip space depth range.
+        const float planes[k_plane_count][4] =
+        {
+            { m[0][3] + m[0][0], m[1][3] + m[1][0], m[2][3] + m[2][0], m[3][3] + m[3][0] }  // left
+          , { m[0][3] - m[0][0], m[1][3] - m[1][0], m[2][3] - m[2][0], m[3][3] - m[3][0] }  // right
+          , { m[0][3] + m[0][1], m[1][3] + m[1][1], m[2][3] + m[2][1], m[3][3] + m[3][1] }  // bottom
+          , { m[0][3] - m[0][1], m[1][3] - m[1][1], m[2][3] - m[2][1], m[3][3] - m[3][1] }  // top
+          , { m[0][2]          , m[1][2]          , m[2][2]          , m[3][2]           }  // near
+          , { m[0][3] - m[0][2], m[1][3] - m[1][2], m[2][3] - m[2][2], m[3][3] - m[3][2] }  // far
+        };
+
+        for (std::size_t i = 0; i < k_plane_count; ++i)
+        {
+            const auto length = std::sqrt(planes[i][0] * planes[i][0]
+                                        + planes[i][1] * planes[i][1]
+                                        + planes[i][2] * planes[i][2]);
+            const auto scale  = (length > 0.0f) ? (1.0f / length) : 0.0f;
+
+            _nx[i] = planes[i][0] * scale;
+            _ny[i] = planes[i][1] * scale;
+            _nz[i] = planes[i][2] * scale;
+            _d[i]  = planes[i][3] * scale;
+        }
+    }
+
+    bool frustum_culler::is_visible(const bounding_sphere& sphere) const noexcept
+    {
+        const auto& c = sphere.center;
+
+        for (std::size_t i = 0; i < k_plane_count; ++i)
+        {
+            if ((_nx[i] * c.x + _ny[i] * c.y + _nz[i] * c.z + _d[i]) < -sphere.radius)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::size_t frustum_culler::cull(const gsl::span<const bounding_sphere>& spheres
+                                   , const gsl::span<std::uint8_t>&          visibility) const noexcept
+    {
+        Expects(visibility.size() >= spheres.size());
+
+        const auto  count   = static_cast<std::size_t>(spheres.size());
+        std::size_t visible = 0;
+        std::size_t index   = 0;
+
+#if defined(__SSE2__)
+        // Four spheres per iteration, tested against one plane at a time
+        for (; index + 4 <= count; index += 4)
+        {
+            const auto& s0 = spheres[index];
+            const auto& s1 = spheres[index + 1];
+            const auto& s2 = spheres[index + 2];
+            const auto& s3 = spheres[index + 3];
+
+            const auto cx = _mm_setr_ps(s0.center.x, s1.center.x, s2.center.x, s3.center.x);
+            const auto cy = _mm_setr_ps(s0.center.y, s1.center.y, s2.center.y, s3.center.y);
+            const auto cz = _mm_setr_ps(s0.center.z, s1.center.z, s2.center.z, s3.center.z);
+            const auto nr = _mm_setr_ps(-s0.radius , -s1.radius , -s2.radius , -s3.radius);
+
+            auto inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (std::size_t i = 0; i < k_plane_count; ++i)
+            {
+                auto distance = _mm_mul_ps(cx, _mm_set1_ps(_nx[i]));
+
+                distance = _mm_add_ps(distance, _mm_mul_ps(cy, _mm_set1_ps(_ny[i])));
+                distance = _mm_add_ps(distance, _mm_mul_ps(cz, _mm_set1_ps(_nz[i])));
+                distance = _mm_add_ps(distance, _mm_set1_ps(_d[i]));
+                inside   = _mm_and_ps(inside, _mm_cmpge_ps(distance, nr));
+            }
+
+            const auto mask = _mm_movemask_ps(inside);
+
+            for (std::size_t lane = 0; lane < 4; ++lane)
+            {
+                const auto is_inside = static_cast<std::uint8_t>((mask >> lane) & 1);
+
+                visibility[index + lane] = is_inside;
+                visible                 += is_inside;
+            }
+        }
+#endif
+
+        for (; index < count; ++index)
+        {
+            const auto is_inside = static_cast<std::uint8_t>(is_visible(spheres[index]) ? 1 : 0);
+
+            visibility[index] = is_inside;
+            visible          += is_inside;
+        }
+
+        return visible;
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_FRUSTUM_CULLER_HPP
+#define SCENER_GRAPHICS_FRUSTUM_CULLER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <gsl/gsl>
+
+#include "scener/math/bounding_sphere.hpp"
+#include "scener/math/matrix.hpp"
+
+namespace scener::graphics
+{
+    /// Tests bounding spheres against the six planes of a view frustum.
+    class frustum_culler final
+    {
+    public:
+        /// Transforms a bounding sphere by the given world matrix.
+        /// \param sphere the bounding sphere to transform.
+        /// \param world the world matrix.
+        /// \returns the transformed bounding sphere, its radius scaled by the largest axis scale of the matrix.
+        static math::bounding_sphere transform(const math::bounding_sphere& sphere, const math::matrix4& world) noexcept;
+
+        /// Gets the smallest bounding sphere containing the two given spheres.
+        /// \param a the first bounding sphere.
+        /// \param b the second bounding sphere.
+        /// \returns the merged bounding sphere.
+        static math::bounding_sphere merge(const math::bounding_sphere& a, const math::bounding_sphere& b) noexcept;
+
+    public:
+        /// Initializes a new instance of the frustum_culler class; the frustum planes are extracted
+        /// from the given combined view and projection matrices.
+        /// \param view_projection the combined view and projection matrices.
+        frustum_culler(const math::matrix4& view_projection) noexcept;
+
+    public:
+        /// Gets a value indicating whether the given sphere intersects or is contained by the frustum.
+        /// \param sphere the bounding sphere to test.
+        /// \returns true if the sphere is visible; false otherwise.
+        bool is_visible(const math::bounding_sphere& sphere) const noexcept;
+
+        /// Tests a batch of bounding spheres against the frustum, four spheres at a time.
+        /// \param spheres the bounding spheres to test.
+        /// \param visibility receives 1 for each visible sphere and 0 for each culled one.
+        /// \returns the number of visible spheres.
+        std::size_t cull(const gsl::span<const math::bounding_sphere>& spheres
+                       , const gsl::span<std::uint8_t>&                visibility) const noexcept;
+
+    private:
+        // Planes are stored as structure of arrays (nx, ny, nz, d), pointing towards the inside of the frustum
+        alignas(16) std::array<float, 8> _nx;
+        alignas(16) std::array<float, 8> _ny;
+        alignas(16) std::array<float, 8> _nz;
+        alignas(16) std::array<float, 8> _d;
+    };
+}
+
+#endif // SCENER_GRAPHICS_FRUSTUM_CULLER_HPP
@@ -3,14 +3,31 @@
 
 #include "graphics_device.hpp"
 
+#include <algorithm>
+#include <array>
+#include <optional>
+
 #include "scener/graphics/vertex_buffer.hpp"
 #include "scener/graphics/index_buffer.hpp"
 #include "scener/graphics/effect_technique.hpp"
 #include "scener/graphics/effect_pass.hpp"
+#include "scener/graphics/frustum_culler.hpp"
+#include "scener/graphics/texture2d.hpp"
 #include "scener/graphics/vulkan/physical_device.hpp"
 
 namespace scener::graphics
 {
+    namespace
+    {
+        /// Gets the view space distance of the object origin of the given technique.
+        inline float view_depth(const effect_technique& technique) noexcept
+        {
+            const auto world_view = technique.world() * technique.view();
+
+            return -world_view[3][2];
+        }
+    }
+
     graphics_device::graphics_device(const graphics_adapter&                  adapter
                                    , const graphics::presentation_parameters& presentation_params) noexcept
         : _blend_state             { blend_state::opaque }
@@ -21,6 +38,18 @@ namespace scener::graphics
         , _adapter                 { adapter }
         , _render_surface          { }
         , _logical_device          { }
+        , _identity_instance       { }
+        , _bone_palette            { }
+        , _texture_table           { }
+        , _texture_streamer        { }
+        , _render_queue            { }
+        , _instance_buffers        { }
+        , _cull_indices            { }
+        , _cull_bounds             { }
+        , _frustum_culling         { true }
+        , _recorded_counters       { }
+        , _stale_images            { }
+        , _draw_order              { 0 }
     {
         Expects(_presentation_parameters.device_window_handle != nullptr);
 
@@ -34,27 +63,87 @@ namespace scener::graphics
         _logical_device = gpu.create_logical_device(*_render_surface, _viewport);
         // Swap chain
         _logical_device->create_swap_chain(*_render_surface);
+        // Instance stream bound by non-instanced draws
+        const auto identity = scener::math::matrix4::identity();
+
+        _identity_instance = std::make_unique<instance_buffer>(this, 1);
+        _identity_instance->set_data({ &identity, 1 });
+        // Joint matrices shared by every skinned mesh
+        _bone_palette = std::make_unique<graphics::bone_palette>(this
+                                                                , _presentation_parameters.bone_palette_capacity
+                                                                , _presentation_parameters.bone_palette_format);
+        // Bindless texture table
+        if (_presentation_parameters.bindless_textures && _logical_device->supports_descriptor_indexing())
+        {
+            _texture_table = std::make_unique<graphics::texture_table>(this, _presentation_parameters.texture_table_capacity);
+        }
+        // Background texture mipmap streaming
+        _texture_streamer = std::make_unique<graphics::texture_streamer>(this
+                                                                        , _presentation_parameters.texture_budget
+                                                                        , _presentation_parameters.texture_streaming_initial_size);
     }
 
     void graphics_device::begin_prepare() noexcept
     {
         Expects(_logical_device.get() != nullptr);
 
-        return _logical_device->begin_prepare();
+        _render_queue.clear();
+        _instance_buffers.clear();
+
+        _draw_order = 0;
     }
 
     void graphics_device::end_prepare() noexcept
     {
         Expects(_logical_device.get() != nullptr);
 
-        _logical_device->end_prepare();
+        update_render_queue();
+
+        _stale_images.assign(_logical_device->image_count(), false);
+
+        for (std::uint32_t image = 0; image < _logical_device->image_count(); ++image)
+        {
+            record_command_buffer(image);
+        }
     }
 
     void graphics_device::draw() noexcept
     {
         Expects(_logical_device.get() != nullptr);
 
-        _logical_device->draw(*_render_surface);
+        const auto image = _logical_device->acquire_next_image(*_render_surface);
+
+        // The command buffers are recorded once and replayed every frame, they are recorded again when the descriptor
+        // sets of the image are rewritten, or when draws are culled, become visible or move in depth enough to change
+        // their order
+        const auto textures_changed = _texture_streamer->update(image);
+        const auto draws_changed    = update_render_queue();
+
+        if (draws_changed)
+        {
+            std::fill(_stale_images.begin(), _stale_images.end(), true);
+        }
+        if (textures_changed)
+        {
+            _stale_images[image] = true;
+        }
+
+        // The previous submission to the acquired image has completed, its command buffer can be recorded again
+        if (_stale_images[image])
+        {
+            record_command_buffer(image);
+
+            _stale_images[image] = false;
+        }
+
+        // The previous submission to the acquired image has completed, its copy of the instance streams can be written
+        std::for_each(_instance_buffers.begin(), _instance_buffers.end(), [&] (auto instances) -> void {
+            instances->update(image);
+        });
+
+        diagnostics::profiler::add(_recorded_counters);
+
+        _logical_device->submit(image);
     }
 
     void graphics_device::present() noexcept
@@ -71,24 +160,70 @@ namespace scener::graphics
                                      , std::uint32_t     primitive_count
                                      , vertex_buffer*    vertex_buffer
                                      , index_buffer*     index_buffer
-                                     , effect_technique* technique) const noexcept
+                                     , effect_technique* technique) noexcept
     {
-        Expects(index_buffer  != nullptr);
-        Expects(vertex_buffer != nullptr);
-        Expects(technique     != nullptr);
+        queue_draw(base_vertex, start_index, vertex_buffer, index_buffer, _identity_instance.get(), technique, nullptr);
+    }
 
-        std::for_each(technique->passes().begin(), technique->passes().end(), [&](auto& pass) {
-            _logical_device->bind_graphics_pipeline(pass->pipeline());
-        });
+    void graphics_device::draw_indexed(std::uint32_t                base_vertex
+                                     , std::uint32_t                min_vertex_index
+                                     , std::uint32_t                num_vertices
+                                     , std::uint32_t                start_index
+                                     , std::uint32_t                primitive_count
+                                     , vertex_buffer*               vertex_buffer
+                                     , index_buffer*                index_buffer
+                                     , effect_technique*            technique
+                                     , const math::bounding_sphere& bounds) noexcept
+    {
+        queue_draw(base_vertex, start_index, vertex_buffer, index_buffer, _identity_instance.get(), technique, &bounds);
+    }
 
-        _logical_device->draw_indexed(
-              base_vertex
-            , min_vertex_index
-            , num_vertices
-            , start_index
-            , primitive_count
-            , vertex_buffer
-            , index_buffer);
+    void graphics_device::draw_indexed_instanced(std::uint32_t     base_vertex
+                                               , std::uint32_t     min_vertex_index
+                                               , std::uint32_t     num_vertices
+                                               , std::uint32_t     start_index
+                                               , std::uint32_t     primitive_count
+                                               , vertex_buffer*    vertex_buffer
+                                               , index_buffer*     index_buffer
+                                               , instance_buffer*  instances
+                                               , effect_technique* technique) noexcept
+    {
+        queue_draw(base_vertex, start_index, vertex_buffer, index_buffer, instances, technique, nullptr);
+    }
+
+    bool graphics_device::frustum_culling() const noexcept
+    {
+        return _frustum_culling;
+    }
+
+    void graphics_device::frustum_culling(bool enabled) noexcept
+    {
+        _frustum_culling = enabled;
+    }
+
+    std::uint32_t graphics_device::draw_order() const noexcept
+    {
+        return _draw_order;
+    }
+
+    void graphics_device::draw_order(std::uint32_t order) noexcept
+    {
+        _draw_order = order;
+    }
+
+    bone_palette* graphics_device::bone_palette() const noexcept
+    {
+        return _bone_palette.get();
+    }
+
+    texture_streamer* graphics_device::texture_streamer() const noexcept
+    {
+        return _texture_streamer.get();
+    }
+
+    texture_table* graphics_device::texture_table() const noexcept
+    {
+        return _texture_table.get();
     }
 
     blend_state& graphics_device::blend_state() noexcept
@@ -127,6 +262,8 @@ namespace scener::graphics
             _blend_state
           , _depth_stencil_state
           , _rasterizer_state
+          , *_bone_palette
+          , _texture_table.get()
           , model_mesh_part);
     }
 
@@ -145,17 +282,221 @@ namespace scener::graphics
         return _logical_device->create_uniform_buffer(size);
     }
 
+    vulkan::buffer graphics_device::create_storage_buffer(std::uint64_t size) const noexcept
+    {
+        return _logical_device->create_storage_buffer(size);
+    }
+
+    vulkan::buffer graphics_device::create_instance_buffer(std::uint64_t size) const noexcept
+    {
+        return _logical_device->create_instance_buffer(size);
+    }
+
     vulkan::texture_object graphics_device::create_texture_object(gsl::not_null<const scener::content::dds::surface*>   texture
+                                                                , std::uint32_t                                         base_level
                                                                 , gsl::not_null<const scener::graphics::sampler_state*> sampler_state
                                                                 , vk::ImageTiling                                       tiling
                                                                 , vk::ImageUsageFlags                                   usage
                                                                 , vk::MemoryPropertyFlags                               required_props) noexcept
     {
-        return _logical_device->create_texture_object(texture, sampler_state, tiling, usage, required_props);
+        return _logical_device->create_texture_object(texture, base_level, sampler_state, tiling, usage, required_props);
     }
 
     void graphics_device::destroy(const vulkan::texture_object& texture) const noexcept
     {
         _logical_device->destroy(texture);
     }
+
+    bool graphics_device::is_texture_format_supported(surface_format format) const noexcept
+    {
+        return _logical_device->is_sampled_format_supported(format);
+    }
+
+    bool graphics_device::is_vertex_format_supported(vertex_element_format format) const noexcept
+    {
+        return _logical_device->is_vertex_format_supported(format);
+    }
+
+    void graphics_device::queue_draw(std::uint32_t                base_vertex
+                                   , std::uint32_t                start_index
+                                   , vertex_buffer*               vertex_buffer
+                                   , index_buffer*                index_buffer
+                                   , instance_buffer*             instances
+                                   , effect_technique*            technique
+                                   , const math::bounding_sphere* bounds) noexcept
+    {
+        Expects(index_buffer  != nullptr);
+        Expects(vertex_buffer != nullptr);
+        Expects(instances     != nullptr);
+        Expects(technique     != nullptr);
+
+        if (instances->instance_count() == 0)
+        {
+            return;
+        }
+
+        if (std::find(_instance_buffers.begin(), _instance_buffers.end(), instances) == _instance_buffers.end())
+        {
+            _instance_buffers.push_back(instances);
+        }
+
+        // View space distance of the object origin, opaque draws sharing the same state go front to back and
+        // translucent draws back to front
+        const auto depth = view_depth(*technique);
+
+        draw_packet packet;
+
+        packet.base_vertex     = base_vertex;
+        packet.start_index     = start_index;
+        packet.vertex_buffer   = vertex_buffer;
+        packet.instance_buffer = instances;
+        packet.index_buffer    = index_buffer;
+        packet.technique       = technique;
+        packet.draw_order      = _draw_order;
+        packet.bounds          = bounds;
+
+        std::for_each(technique->passes().begin(), technique->passes().end(), [&](const auto& pass) {
+            packet.pipeline    = &pass->pipeline();
+            packet.translucent = packet.pipeline->blended();
+
+            _render_queue.submit(packet, depth);
+        });
+    }
+
+    bool graphics_device::update_render_queue() noexcept
+    {
+        const auto&                   packets         = _render_queue.packets();
+        std::optional<frustum_culler> culler          = { };
+        math::matrix4                 view_projection = math::matrix4::identity();
+        bool                          changed         = false;
+
+        // Draws sharing the same view frustum are culled in a single batch
+        const auto cull_batch = [&] () -> bool {
+            const auto batch_changed = culler.has_value() && _render_queue.cull(*culler, _cull_indices, _cull_bounds);
+
+            _cull_indices.clear();
+            _cull_bounds.clear();
+
+            return batch_changed;
+        };
+
+        for (std::size_t i = 0; i < packets.size(); ++i)
+        {
+            const auto& packet    = packets[i];
+            const auto& technique = *packet.technique;
+
+            _render_queue.depth(i, view_depth(technique));
+
+            if (!_frustum_culling || packet.bounds == nullptr || packet.bounds->radius <= 0.0f)
+            {
+                changed = _render_queue.visible(i, true) || changed;
+                continue;
+            }
+
+            const auto draw_view_projection = technique.view() * technique.projection();
+
+            if (!culler.has_value() || draw_view_projection != view_projection)
+            {
+                changed         = cull_batch() || changed;
+                view_projection = draw_view_projection;
+
+                culler.emplace(view_projection);
+            }
+
+            _cull_indices.push_back(i);
+            _cull_bounds.push_back(frustum_culler::transform(*packet.bounds, technique.world()));
+        }
+
+        changed = cull_batch() || changed;
+
+        // Depth and visibility updates address the packets by position, they are only reordered at the end
+        return _render_queue.sort() || changed;
+    }
+
+    void graphics_device::record_command_buffer(std::uint32_t image) noexcept
+    {
+        vk::Pipeline                     pipeline    = { };
+        const vk::DescriptorSet*         descriptors = nullptr;
+        const graphics::vertex_buffer*   vertices    = nullptr;
+        const graphics::instance_buffer* instances   = nullptr;
+        const graphics::index_buffer*    indices     = nullptr;
+        const effect_technique*          technique   = nullptr;
+
+        std::array<std::uint32_t, graphics::texture_table::max_material_textures> texture_indices;
+
+        _recorded_counters = { };
+
+        _logical_device->begin_prepare(image);
+
+        // Packets are ordered by state, only record the binds that actually change it
+        for (const auto& packet : _render_queue.packets())
+        {
+            if (!packet.visible)
+            {
+                continue;
+            }
+            if (packet.pipeline->pipeline() != pipeline)
+            {
+                pipeline = packet.pipeline->pipeline();
+
+                _logical_device->bind_graphics_pipeline(image, *packet.pipeline);
+
+                _recorded_counters.pipeline_binds++;
+
+                technique = nullptr;
+            }
+            if (packet.pipeline->descriptors().data() != descriptors)
+            {
+                descriptors = packet.pipeline->descriptors().data();
+
+                _logical_device->bind_descriptor_sets(image, *packet.pipeline);
+
+                _recorded_counters.descriptor_binds++;
+            }
+            if (packet.vertex_buffer != vertices || packet.instance_buffer != instances)
+            {
+                vertices  = packet.vertex_buffer;
+                instances = packet.instance_buffer;
+
+                _logical_device->bind_vertex_buffers(image, vertices, instances);
+
+                _recorded_counters.buffer_binds++;
+            }
+            if (packet.index_buffer != indices)
+            {
+                indices = packet.index_buffer;
+
+                _logical_device->bind_index_buffer(image, indices);
+
+                _recorded_counters.buffer_binds++;
+            }
+            if (packet.pipeline->uses_texture_table() && packet.technique != technique)
+            {
+                // Materials sharing the pipeline only differ in the texture table indices pushed before the draw
+                const auto& textures = packet.technique->textures();
+                const auto  count    = std::min<std::size_t>(textures.size(), texture_indices.size());
+
+                technique = packet.technique;
+
+                texture_indices.fill(0);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    texture_indices[i] = textures[i]->table_index();
+                }
+
+                _logical_device->push_texture_indices(image, *packet.pipeline, texture_indices);
+            }
+
+            _logical_device->draw_indexed(image
+                                        , indices->index_count()
+                                        , instances->instance_count()
+                                        , packet.start_index
+                                        , packet.base_vertex);
+
+            _recorded_counters.draws++;
+        }
+
+        _logical_device->end_prepare(image);
+    }
 }
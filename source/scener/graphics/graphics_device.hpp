@@ -6,15 +6,23 @@
 
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 #include <gsl/gsl>
 
+#include "scener/diagnostics/profiler.hpp"
 #include "scener/graphics/blend_state.hpp"
+#include "scener/graphics/bone_palette.hpp"
 #include "scener/graphics/depth_stencil_state.hpp"
 #include "scener/graphics/graphics_adapter.hpp"
+#include "scener/graphics/instance_buffer.hpp"
 #include "scener/graphics/presentation_parameters.hpp"
 #include "scener/graphics/model_mesh_part.hpp"
 #include "scener/graphics/rasterizer_state.hpp"
+#include "scener/graphics/render_queue.hpp"
+#include "scener/graphics/texture_streamer.hpp"
+#include "scener/graphics/texture_table.hpp"
+#include "scener/graphics/vertex_element_format.hpp"
 #include "scener/graphics/viewport.hpp"
 #include "scener/graphics/vulkan/adapter.hpp"
 #include "scener/graphics/vulkan/graphics_pipeline.hpp"
@@ -43,7 +51,8 @@ namespace scener::graphics
         /// Starts the preparation phase
         void begin_prepare() noexcept;
 
-        /// Called by the renderer at the end of drawing; presents the final rendering.
+        /// Called by the renderer at the end of drawing; sorts the queued draws by draw order, translucency and
+        /// render state, and records them into the command buffers.
         void end_prepare() noexcept;
 
         /// Draws the current frame
@@ -71,7 +80,66 @@ namespace scener::graphics
                         , std::uint32_t     primitive_count
                         , vertex_buffer*    vertex_buffer
                         , index_buffer*     index_buffer
-                        , effect_technique* technique) const noexcept;
+                        , effect_technique* technique) noexcept;
+
+        /// Renders the specified geometric primitive, based on indexing into an array of vertices,
+        /// while its bounds are inside the view frustum of the technique.
+        /// \param base_vertex      offset to add to each vertex index in the index buffer.
+        /// \param min_vertex_index minimum vertex index for vertices used during the call.
+        /// \param num_vertices     number of vertices used during the call.
+        /// \param start_index      location in the index array at which to start reading vertices.
+        /// \param primitive_count  number of primitives to render.
+        /// \param bounds           the object space bounds of the geometry, transformed by the technique world matrix;
+        ///                         read every frame to cull the draw, so they must outlive it.
+        void draw_indexed(std::uint32_t                base_vertex
+                        , std::uint32_t                min_vertex_index
+                        , std::uint32_t                num_vertices
+                        , std::uint32_t                start_index
+                        , std::uint32_t                primitive_count
+                        , vertex_buffer*               vertex_buffer
+                        , index_buffer*                index_buffer
+                        , effect_technique*            technique
+                        , const math::bounding_sphere& bounds) noexcept;
+
+        /// Renders multiple instances of the specified geometric primitive, based on indexing into an array of vertices.
+        /// \param base_vertex      offset to add to each vertex index in the index buffer.
+        /// \param min_vertex_index minimum vertex index for vertices used during the call.
+        /// \param num_vertices     number of vertices used during the call.
+        /// \param start_index      location in the index array at which to start reading vertices.
+        /// \param primitive_count  number of primitives to render.
+        /// \param instances        the per-instance data stream, one element per instance to render.
+        void draw_indexed_instanced(std::uint32_t     base_vertex
+                                  , std::uint32_t     min_vertex_index
+                                  , std::uint32_t     num_vertices
+                                  , std::uint32_t     start_index
+                                  , std::uint32_t     primitive_count
+                                  , vertex_buffer*    vertex_buffer
+                                  , index_buffer*     index_buffer
+                                  , instance_buffer*  instances
+                                  , effect_technique* technique) noexcept;
+
+        /// Gets the draw order of the draws being queued.
+        std::uint32_t draw_order() const noexcept;
+
+        /// Sets the draw order of the draws queued next; draws with a lower draw order are drawn first, regardless
+        /// of their render state. The renderer sets it before drawing each component.
+        void draw_order(std::uint32_t order) noexcept;
+
+        /// Gets a value indicating whether draws with bounds are frustum culled every frame. The default value is true.
+        bool frustum_culling() const noexcept;
+
+        /// Sets a value indicating whether draws with bounds are frustum culled every frame.
+        void frustum_culling(bool enabled) noexcept;
+
+        /// Gets the storage buffer holding the joint matrices of every skinned mesh.
+        graphics::bone_palette* bone_palette() const noexcept;
+
+        /// Gets the streamer managing the resident mipmaps of the loaded textures.
+        graphics::texture_streamer* texture_streamer() const noexcept;
+
+        /// Gets the bindless texture table.
+        /// \returns the bindless texture table; nullptr when bindless textures are disabled or not supported.
+        graphics::texture_table* texture_table() const noexcept;
 
         /// Gets or sets a system-defined instance of a blend state object initialized for alpha blending.
         /// The default value is BlendState.Opaque.
@@ -107,8 +175,17 @@ namespace scener::graphics
         /// \para size the buffer size.
         vulkan::buffer create_uniform_buffer(std::uint32_t size)const noexcept;
 
-        // creates a texture object ( image, view, sampler, ... )
+        /// Creates a new host visible storage buffer with the given size.
+        /// \para size the buffer size.
+        vulkan::buffer create_storage_buffer(std::uint64_t size) const noexcept;
+
+        /// Creates a new host visible per-instance vertex buffer with the given size.
+        /// \para size the buffer size.
+        vulkan::buffer create_instance_buffer(std::uint64_t size) const noexcept;
+
+        // creates a texture object ( image, view, sampler, ... ) from the mipmaps starting at the given level
         vulkan::texture_object create_texture_object(gsl::not_null<const scener::content::dds::surface*>   texture
+                                                   , std::uint32_t                                         base_level
                                                    , gsl::not_null<const scener::graphics::sampler_state*> sampler_state
                                                    , vk::ImageTiling                                       tiling
                                                    , vk::ImageUsageFlags                                   usage
@@ -117,15 +194,53 @@ namespace scener::graphics
         /// Destroys the given texture releasing its resources
         void destroy(const vulkan::texture_object& texture) const noexcept;
 
+        /// Gets a value indicating whether textures of the given format can be sampled by the device.
+        /// \param format the texture surface format.
+        /// \returns true if the device can sample textures of the given format; false otherwise.
+        bool is_texture_format_supported(surface_format format) const noexcept;
+
+        /// Gets a value indicating whether vertex attributes of the given format can be read by the device.
+        /// \param format the vertex element format.
+        /// \returns true if the device can read vertex attributes of the given format; false otherwise.
+        bool is_vertex_format_supported(vertex_element_format format) const noexcept;
+
+    private:
+        void queue_draw(std::uint32_t                base_vertex
+                      , std::uint32_t                start_index
+                      , vertex_buffer*               vertex_buffer
+                      , index_buffer*                index_buffer
+                      , instance_buffer*             instances
+                      , effect_technique*            technique
+                      , const math::bounding_sphere* bounds) noexcept;
+
+        bool update_render_queue() noexcept;
+
+        void record_command_buffer(std::uint32_t image) noexcept;
+
     private:
-        graphics::blend_state                   _blend_state;
-        graphics::depth_stencil_state           _depth_stencil_state;
-        graphics::rasterizer_state              _rasterizer_state;
-        graphics::presentation_parameters       _presentation_parameters;
-        graphics::viewport                      _viewport;
-        graphics_adapter                        _adapter;
-        std::unique_ptr<vulkan::render_surface> _render_surface;
-        std::unique_ptr<vulkan::logical_device> _logical_device;
+        graphics::blend_state                       _blend_state;
+        graphics::depth_stencil_state               _depth_stencil_state;
+        graphics::rasterizer_state                  _rasterizer_state;
+        graphics::presentation_parameters           _presentation_parameters;
+        graphics::viewport                          _viewport;
+        graphics_adapter                            _adapter;
+        std::unique_ptr<vulkan::render_surface>     _render_surface;
+        std::unique_ptr<vulkan::logical_device>     _logical_device;
+        std::unique_ptr<instance_buffer>            _identity_instance;
+        std::unique_ptr<graphics::bone_palette>     _bone_palette;
+        std::unique_ptr<graphics::texture_table>    _texture_table;
+        std::unique_ptr<graphics::texture_streamer> _texture_streamer;
+        render_queue                                _render_queue;
+        std::vector<instance_buffer*>               _instance_buffers;
+        std::vector<std::size_t>                    _cull_indices;
+        std::vector<math::bounding_sphere>          _cull_bounds;
+        bool                                        _frustum_culling;
+        diagnostics::frame_counters                 _recorded_counters;
+        std::vector<bool>                           _stale_images;
+        std::uint32_t                               _draw_order;
+
+        friend class graphics::texture_streamer;
+        friend class graphics::texture_table;
     };
 }
 
@@ -0,0 +1,67 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/instance_buffer.hpp"
+
+#include "scener/graphics/graphics_device.hpp"
+
+namespace scener::graphics
+{
+    using scener::math::matrix4;
+
+    instance_buffer::instance_buffer(gsl::not_null<graphics_device*> device, std::uint32_t capacity) noexcept
+        : graphics_resource { device }
+        , _capacity         { capacity }
+        , _instance_count   { 0 }
+        , _transforms       { }
+        , _stale            { }
+        , _buffer           { device->create_instance_buffer(capacity * sizeof(matrix4)) }
+    {
+        Expects(capacity > 0);
+
+        _transforms.reserve(capacity);
+        _stale.assign(_buffer.copies(), false);
+    }
+
+    std::uint32_t instance_buffer::capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    std::uint32_t instance_buffer::instance_count() const noexcept
+    {
+        return _instance_count;
+    }
+
+    const vertex_declaration& instance_buffer::vertex_declaration() const noexcept
+    {
+        return graphics::vertex_declaration::instance_transform();
+    }
+
+    void instance_buffer::set_data(const gsl::span<const matrix4>& transforms) noexcept
+    {
+        Expects(transforms.size() <= _capacity);
+
+        _instance_count = static_cast<std::uint32_t>(transforms.size());
+
+        _transforms.assign(transforms.begin(), transforms.end());
+        _stale.assign(_stale.size(), true);
+    }
+
+    void instance_buffer::update(std::uint32_t image) noexcept
+    {
+        Expects(image < _stale.size());
+
+        if (!_stale[image])
+        {
+            return;
+        }
+
+        if (_instance_count > 0)
+        {
+            _buffer.set_data(image, 0, _instance_count * sizeof(matrix4), _transforms.data());
+        }
+
+        _stale[image] = false;
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_INSTANCE_BUFFER_HPP
+#define SCENER_GRAPHICS_INSTANCE_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "scener/graphics/graphics_resource.hpp"
+#include "scener/graphics/vertex_declaration.hpp"
+#include "scener/graphics/vulkan/buffer.hpp"
+#include "scener/math/matrix.hpp"
+
+namespace scener::graphics::vulkan { class logical_device; }
+
+namespace scener::graphics
+{
+    class graphics_device;
+
+    /// Represents a host visible stream of per-instance world transforms used for instanced drawing. The stream keeps
+    /// one copy per swap chain image; new transforms are written to each copy once the device has finished the
+    /// previous frame rendered to its image.
+    class instance_buffer final : public graphics_resource
+    {
+    public:
+        /// Initializes a new instance of the instance_buffer class.
+        /// \param device the graphics device associated with this instance buffer.
+        /// \param capacity the maximum number of instances the buffer can hold.
+        instance_buffer(gsl::not_null<graphics_device*> device, std::uint32_t capacity) noexcept;
+
+    public:
+        /// Gets the maximum number of instances the buffer can hold.
+        /// \returns the maximum number of instances the buffer can hold.
+        std::uint32_t capacity() const noexcept;
+
+        /// Gets the number of instances currently stored in the buffer.
+        /// \returns the number of instances currently stored in the buffer.
+        std::uint32_t instance_count() const noexcept;
+
+        /// Defines per-instance data in a buffer.
+        /// \returns the per instance data definition of this instance_buffer.
+        const graphics::vertex_declaration& vertex_declaration() const noexcept;
+
+        /// Sets the instance world transforms.
+        /// \param transforms the per-instance world matrices.
+        void set_data(const gsl::span<const math::matrix4>& transforms) noexcept;
+
+        /// Writes the current transforms to the copy read by the given swap chain image, if it is out of date.
+        /// \param image the swap chain image being drawn; its previous submission must have completed.
+        void update(std::uint32_t image) noexcept;
+
+    private:
+        std::uint32_t              _capacity;
+        std::uint32_t              _instance_count;
+        std::vector<math::matrix4> _transforms;
+        std::vector<bool>          _stale;
+        vulkan::buffer             _buffer;
+
+        friend class scener::graphics::vulkan::logical_device;
+    };
+}
+
+#endif // SCENER_GRAPHICS_INSTANCE_BUFFER_HPP
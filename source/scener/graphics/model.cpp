@@ -5,13 +5,18 @@
 
 #include <algorithm>
 
+#include "scener/graphics/model_mesh_part.hpp"
+
 namespace scener::graphics
 {
     using scener::math::matrix4;
 
     model::model() noexcept
-        : _meshes { }
-        , _name   { }
+        : _meshes     { }
+        , _mesh_nodes { }
+        , _name       { }
+        , _instances  { }
+        , _scene      { }
     {
     }
 
@@ -25,16 +30,66 @@ namespace scener::graphics
         return _meshes;
     }
 
+    scene_graph& model::scene() noexcept
+    {
+        return _scene;
+    }
+
     void model::update(const steptime& time
                      , const matrix4&  world
                      , const matrix4&  view
                      , const matrix4&  projection) noexcept
     {
-        std::for_each(_meshes.begin(), _meshes.end(), [&time, &world, &view, &projection] (auto& mesh) -> void { mesh->update(time, world, view, projection); });
+        _scene.update();
+
+        for (std::size_t i = 0; i < _meshes.size(); ++i)
+        {
+            const auto& mesh = _meshes[i];
+            const auto  node = (i < _mesh_nodes.size()) ? _mesh_nodes[i] : scene_graph::no_parent;
+
+            // Skinned meshes are positioned by their joints, so the node transform does not apply
+            if (node == scene_graph::no_parent || mesh->skeleton() != nullptr)
+            {
+                mesh->update(time, world, view, projection);
+            }
+            else
+            {
+                mesh->update(time, _scene.world_transform(node) * world, view, projection);
+            }
+        }
     }
 
     void model::draw() noexcept
     {
         std::for_each(_meshes.begin(), _meshes.end(), [&] (const auto& mesh) -> void { mesh->draw(); });
     }
+
+    void model::draw_instanced(const gsl::span<const matrix4>& transforms) noexcept
+    {
+        if (_meshes.empty() || transforms.empty())
+        {
+            return;
+        }
+
+        const auto count = static_cast<std::uint32_t>(transforms.size());
+
+        if (_instances == nullptr || _instances->capacity() < count)
+        {
+            const auto device = _meshes.front()->mesh_parts().front()->vertex_buffer()->device();
+
+            _instances = std::make_unique<instance_buffer>(device, count);
+        }
+
+        _instances->set_data(transforms);
+
+        std::for_each(_meshes.begin(), _meshes.end(), [&] (const auto& mesh) -> void { mesh->draw_instanced(_instances.get()); });
+    }
+
+    void model::update_instances(const gsl::span<const matrix4>& transforms) noexcept
+    {
+        Expects(_instances != nullptr);
+        Expects(static_cast<std::uint32_t>(transforms.size()) == _instances->instance_count());
+
+        _instances->set_data(transforms);
+    }
 }
@@ -8,7 +8,11 @@
 #include <string>
 #include <vector>
 
+#include <gsl/gsl>
+
+#include "scener/graphics/instance_buffer.hpp"
 #include "scener/graphics/model_mesh.hpp"
+#include "scener/graphics/scene_graph.hpp"
 #include "scener/graphics/steptime.hpp"
 #include "scener/math/basic_matrix.hpp"
 
@@ -34,7 +38,13 @@ namespace scener::graphics
         /// \returns the ModelMesh objects used by this model.
         const std::vector<std::shared_ptr<model_mesh>>& meshes() const noexcept;
 
+        /// Gets the node hierarchy of the model. Moving a node moves every mesh attached to its subtree.
+        /// \returns the node hierarchy of the model.
+        scene_graph& scene() noexcept;
+
         /// Updates the model animation and skin state.
+        /// Non skinned meshes are placed using the world transform of the node they are attached to,
+        /// combined with the given world matrix.
         /// \param time snapshot of the rendering timing state.
         /// \param world the world matrix
         /// \param view the view matrix
@@ -47,9 +57,22 @@ namespace scener::graphics
         /// Render a model after applying the given matrix transformations.
         void draw() noexcept;
 
+        /// Renders one copy of the model per world transform, issuing a single draw per mesh part.
+        /// The transforms are exposed to the vertex shader through the instance_transform vertex stream, and are
+        /// applied before the world matrix given to update.
+        /// \param transforms the per-instance world matrices.
+        void draw_instanced(const gsl::span<const scener::math::matrix4>& transforms) noexcept;
+
+        /// Updates the per-instance world transforms used by previously recorded instanced draws.
+        /// \param transforms the per-instance world matrices; must match the instance count being drawn.
+        void update_instances(const gsl::span<const scener::math::matrix4>& transforms) noexcept;
+
     private:
         std::vector<std::shared_ptr<model_mesh>> _meshes;
+        std::vector<std::int32_t>                _mesh_nodes;
         std::string                              _name;
+        std::unique_ptr<instance_buffer>         _instances;
+        scene_graph                              _scene;
 
         friend class scener::content::content_reader;
     };
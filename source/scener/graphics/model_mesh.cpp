@@ -5,15 +5,27 @@
 
 #include <algorithm>
 
+#include "scener/graphics/frustum_culler.hpp"
 #include "scener/graphics/graphics_device.hpp"
-#include "scener/graphics/model_mesh_part.hpp"
+#include "scener/graphics/instance_buffer.hpp"
 #include "scener/graphics/model_mesh_part.hpp"
 #include "scener/graphics/skeleton.hpp"
+#include "scener/graphics/texture_streamer.hpp"
 
 namespace scener::graphics
 {
     using scener::math::matrix4;
 
+    model_mesh::~model_mesh()
+    {
+        if (_bone_palette_offset.has_value() && !_mesh_parts.empty())
+        {
+            auto palette = _mesh_parts.front()->vertex_buffer()->device()->bone_palette();
+
+            palette->release(_bone_palette_offset.value(), _bone_palette_count);
+        }
+    }
+
     const math::bounding_sphere& model_mesh::bounding_sphere() const noexcept
     {
         return _bounding_sphere;
@@ -39,16 +51,43 @@ namespace scener::graphics
                           , const matrix4&  view
                           , const matrix4&  projection) noexcept
     {
-        if (_skeleton != nullptr)
+        if (_skeleton != nullptr && !_mesh_parts.empty())
         {
             _skeleton->update(time.elapsed_render_time);
+
+            // The parts share the skeleton, its joint matrices are written once into the palette
+            const auto& transforms = _skeleton->skin_transforms();
+            auto        palette    = _mesh_parts.front()->vertex_buffer()->device()->bone_palette();
+
+            if (!_bone_palette_offset.has_value())
+            {
+                _bone_palette_count  = static_cast<std::uint32_t>(transforms.size());
+                _bone_palette_offset = palette->allocate(_bone_palette_count);
+            }
+
+            palette->set_data(_bone_palette_offset.value(), transforms);
+
+            // Skinned vertices are weighted averages of the vertex transformed by its joints, so they stay inside
+            // the spheres enclosing the bind pose bounds transformed by every joint
+            _pose_bounds = _bounding_sphere;
+
+            for (std::size_t i = 0; i < transforms.size(); ++i)
+            {
+                const auto joint_bounds = frustum_culler::transform(_bounding_sphere, transforms[i]);
+
+                _pose_bounds = (i == 0) ? joint_bounds : frustum_culler::merge(_pose_bounds, joint_bounds);
+            }
+        }
+        else
+        {
+            _pose_bounds = _bounding_sphere;
         }
 
         std::for_each(_mesh_parts.begin(), _mesh_parts.end(), [&] (const auto& part) -> void
         {
-            if (_skeleton.get() != nullptr)
+            if (_bone_palette_offset.has_value() && part->effect_technique()->skinned())
             {
-                part->effect_technique()->bone_transforms(_skeleton->skin_transforms());
+                part->effect_technique()->bone_palette_offset(_bone_palette_offset.value());
             }
 
             auto technique = part->effect_technique();
@@ -58,12 +97,15 @@ namespace scener::graphics
             technique->projection(projection);
 
             technique->update();
+
+            // Request the texture mipmaps matching the mesh size on screen
+            part->vertex_buffer()->device()->texture_streamer()->request(*technique, _pose_bounds);
         });
     }
 
     void model_mesh::draw() noexcept
     {
-        std::for_each(_mesh_parts.begin(), _mesh_parts.end(), [] (const auto& part) -> void
+        std::for_each(_mesh_parts.begin(), _mesh_parts.end(), [&] (const auto& part) -> void
         {
             part->vertex_buffer()
                 ->device()
@@ -74,7 +116,28 @@ namespace scener::graphics
                              , part->primitive_count()
                              , part->vertex_buffer()
                              , part->index_buffer()
-                             , part->effect_technique());
+                             , part->effect_technique()
+                             , _pose_bounds);
+        });
+    }
+
+    void model_mesh::draw_instanced(instance_buffer* instances) noexcept
+    {
+        Expects(instances != nullptr);
+
+        std::for_each(_mesh_parts.begin(), _mesh_parts.end(), [&] (const auto& part) -> void
+        {
+            part->vertex_buffer()
+                ->device()
+                ->draw_indexed_instanced(part->vertex_offset()
+                                       , 0
+                                       , part->vertex_count()
+                                       , part->start_index()
+                                       , part->primitive_count()
+                                       , part->vertex_buffer()
+                                       , part->index_buffer()
+                                       , instances
+                                       , part->effect_technique());
         });
     }
 }
@@ -4,7 +4,9 @@
 #ifndef SCENER_GRAPHICS_MODEL_MESH_HPP
 #define SCENER_GRAPHICS_MODEL_MESH_HPP
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 
@@ -16,12 +18,17 @@ namespace scener::content::readers { template <typename T> class content_type_re
 
 namespace scener::graphics
 {
+    class instance_buffer;
     class model_mesh_part;
     class skeleton;
 
     /// Represents a mesh that is part of a Model.
     class model_mesh final
     {
+    public:
+        /// Releases all resources being used by this model_mesh, giving its bone palette range back.
+        ~model_mesh();
+
     public:
         /// Gets the BoundingSphere that contains this mesh.
         /// \returns The BoundingSphere that contains this mesh.
@@ -47,17 +54,22 @@ namespace scener::graphics
                   , const scener::math::matrix4& view
                   , const scener::math::matrix4& projection) noexcept;
 
-        /// Render a model after applying the given matrix transformations.
-        /// \param world the world matrix
-        /// \param view the view matrix
-        /// \param projection the projection matrix
+        /// Render a model after applying the given matrix transformations; the draws are frustum culled every frame
+        /// using the bounds of the mesh in its current pose.
         void draw() noexcept;
 
+        /// Renders one copy of this mesh per element of the given instance stream.
+        /// \param instances the per-instance world transforms.
+        void draw_instanced(instance_buffer* instances) noexcept;
+
     private:
-        std::vector<std::shared_ptr<model_mesh_part>> _mesh_parts      { };
-        math::bounding_sphere                         _bounding_sphere { math::vector3::zero(), 0.0f };
-        std::shared_ptr<graphics::skeleton>           _skeleton        { nullptr };
-        std::string                                   _name            { };
+        std::vector<std::shared_ptr<model_mesh_part>> _mesh_parts          { };
+        math::bounding_sphere                         _bounding_sphere     { math::vector3::zero(), 0.0f };
+        math::bounding_sphere                         _pose_bounds         { math::vector3::zero(), 0.0f };
+        std::shared_ptr<graphics::skeleton>           _skeleton            { nullptr };
+        std::optional<std::uint32_t>                  _bone_palette_offset { };
+        std::uint32_t                                 _bone_palette_count  { 0 };
+        std::string                                   _name                { };
 
         template <typename T> friend class scener::content::readers::content_type_reader;
     };
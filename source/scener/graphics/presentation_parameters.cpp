@@ -6,12 +6,18 @@
 namespace scener::graphics
 {
     presentation_parameters::presentation_parameters() noexcept
-        : full_screen          { false }
-        , back_buffer_height   { 0 }
-        , back_buffer_width    { 0 }
-        , multi_sample_count   { 8 }
-        , present_interval     { present_interval::one }
-        , device_window_handle { nullptr }
+        : full_screen                    { false }
+        , back_buffer_height             { 0 }
+        , back_buffer_width              { 0 }
+        , multi_sample_count             { 8 }
+        , present_interval               { present_interval::one }
+        , device_window_handle           { nullptr }
+        , bone_palette_capacity          { 4096 }
+        , bone_palette_format            { bone_palette_format::matrix3x4 }
+        , texture_budget                 { 0 }
+        , texture_streaming_initial_size { 128 }
+        , bindless_textures              { false }
+        , texture_table_capacity         { 4096 }
     {
     }
 }
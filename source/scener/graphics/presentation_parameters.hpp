@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "scener/graphics/bone_palette_format.hpp"
 #include "scener/graphics/present_interval.hpp"
 #include "scener/graphics/vulkan/surface.hpp"
 
@@ -38,6 +39,27 @@ namespace scener::graphics
 
         /// Gets or sets the handle to the device window.
         scener::graphics::vulkan::display_surface* device_window_handle;
+
+        /// Gets or sets the maximum number of joints, across all the skeletons, held by the bone palette.
+        std::uint32_t bone_palette_capacity;
+
+        /// Gets or sets the layout of the joint matrices stored in the bone palette.
+        graphics::bone_palette_format bone_palette_format;
+
+        /// Gets or sets the amount, in bytes, of device local memory textures are streamed into; zero to use the
+        /// budget reported by the driver.
+        std::uint64_t texture_budget;
+
+        /// Gets or sets the size, in pixels, of the largest mipmap uploaded when a texture is loaded; higher
+        /// resolution mipmaps are streamed in on demand.
+        std::uint32_t texture_streaming_initial_size;
+
+        /// Gets or sets a value indicating whether textures are sampled through the bindless texture table, when the
+        /// device supports descriptor indexing and the shaders provide a variant compiled for it.
+        bool bindless_textures;
+
+        /// Gets or sets the maximum number of textures held by the bindless texture table.
+        std::uint32_t texture_table_capacity;
     };
 }
 
@@ -0,0 +1,181 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/render_queue.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <gsl/gsl>
+
+#include "scener/graphics/frustum_culler.hpp"
+
+namespace scener::graphics
+{
+    // Sort key layout (most significant first)
+    //
+    //  63        56  55  54                                                          0
+    // | draw order | T |                        draw state                           |
+    //
+    //  T = 0, opaque draws grouped by state, front to back:
+    //                    | pipeline (12) | descriptors (12) | vertex buf (11) | index buf (8) | depth (12)  |
+    //  T = 1, translucent draws back to front:
+    //                    | inverted depth (12) | pipeline (12) | descriptors (12) | vertex buf (11) | index (8) |
+    //
+    // Draw orders above 255 share the last slot. State ids are handed out in first seen order; when a field
+    // overflows ids wrap around, which only degrades the grouping, as redundant bind elimination compares the
+    // actual state objects.
+    constexpr std::uint64_t k_draw_order_shift    = 56;
+    constexpr std::uint64_t k_draw_order_mask     = 0xFF;
+    constexpr std::uint64_t k_translucent_bit     = std::uint64_t { 1 } << 55;
+    constexpr std::uint64_t k_pipeline_shift      = 31;
+    constexpr std::uint64_t k_pipeline_mask       = 0xFFF;
+    constexpr std::uint64_t k_descriptors_shift   = 19;
+    constexpr std::uint64_t k_descriptors_mask    = 0xFFF;
+    constexpr std::uint64_t k_vertex_buffer_shift = 8;
+    constexpr std::uint64_t k_vertex_buffer_mask  = 0x7FF;
+    constexpr std::uint64_t k_index_buffer_mask   = 0xFF;
+    constexpr std::uint64_t k_state_bits          = 43;
+    constexpr std::uint64_t k_depth_bits          = 12;
+    constexpr std::uint64_t k_depth_mask          = 0xFFF;
+
+    render_queue::render_queue() noexcept
+        : _packets           { }
+        , _pipeline_ids      { }
+        , _descriptor_ids    { }
+        , _vertex_buffer_ids { }
+        , _index_buffer_ids  { }
+        , _visibility        { }
+    {
+    }
+
+    const std::vector<draw_packet>& render_queue::packets() const noexcept
+    {
+        return _packets;
+    }
+
+    std::size_t render_queue::size() const noexcept
+    {
+        return _packets.size();
+    }
+
+    void render_queue::clear() noexcept
+    {
+        _packets.clear();
+        _pipeline_ids.clear();
+        _descriptor_ids.clear();
+        _vertex_buffer_ids.clear();
+        _index_buffer_ids.clear();
+    }
+
+    void render_queue::submit(const draw_packet& packet, float depth) noexcept
+    {
+        Expects(packet.pipeline      != nullptr);
+        Expects(packet.vertex_buffer != nullptr);
+        Expects(packet.index_buffer  != nullptr);
+
+        const auto pipeline    = state_id(_pipeline_ids, static_cast<VkPipeline>(packet.pipeline->pipeline()));
+        const auto descriptors = state_id<const void*>(_descriptor_ids   , packet.pipeline->descriptors().data());
+        const auto vertices    = state_id<const void*>(_vertex_buffer_ids, packet.vertex_buffer);
+        const auto indices     = state_id<const void*>(_index_buffer_ids , packet.index_buffer);
+        const auto state       = ((pipeline    & k_pipeline_mask)      << k_pipeline_shift)
+                               | ((descriptors & k_descriptors_mask)   << k_descriptors_shift)
+                               | ((vertices    & k_vertex_buffer_mask) << k_vertex_buffer_shift)
+                               |  (indices     & k_index_buffer_mask);
+        const auto order       = std::min<std::uint64_t>(packet.draw_order, k_draw_order_mask) << k_draw_order_shift;
+
+        auto queued = packet;
+
+        queued.key = order | (packet.translucent ? (k_translucent_bit | state) : (state << k_depth_bits));
+        queued.key = with_depth(queued.key, depth);
+
+        _packets.push_back(queued);
+    }
+
+    void render_queue::depth(std::size_t index, float depth) noexcept
+    {
+        Expects(index < _packets.size());
+
+        _packets[index].key = with_depth(_packets[index].key, depth);
+    }
+
+    bool render_queue::visible(std::size_t index, bool visible) noexcept
+    {
+        Expects(index < _packets.size());
+
+        const auto changed = (_packets[index].visible != visible);
+
+        _packets[index].visible = visible;
+
+        return changed;
+    }
+
+    bool render_queue::cull(const frustum_culler&                         culler
+                          , const gsl::span<const std::size_t>&           indices
+                          , const gsl::span<const math::bounding_sphere>& bounds) noexcept
+    {
+        Expects(indices.size() == bounds.size());
+
+        _visibility.resize(static_cast<std::size_t>(bounds.size()));
+
+        culler.cull(bounds, _visibility);
+
+        bool changed = false;
+
+        for (std::size_t i = 0; i < _visibility.size(); ++i)
+        {
+            changed = visible(indices[i], _visibility[i] != 0) || changed;
+        }
+
+        return changed;
+    }
+
+    bool render_queue::sort() noexcept
+    {
+        const auto by_key = [](const draw_packet& a, const draw_packet& b) -> bool
+        {
+            return (a.key < b.key);
+        };
+
+        if (std::is_sorted(_packets.begin(), _packets.end(), by_key))
+        {
+            return false;
+        }
+
+        std::stable_sort(_packets.begin(), _packets.end(), by_key);
+
+        return true;
+    }
+
+    std::uint64_t render_queue::depth_bits(float depth) noexcept
+    {
+        // The bit pattern of a non negative IEEE-754 float grows monotonically with its value, so its top
+        // bits (sign, exponent and the leading mantissa bits) give a logarithmic depth bucket.
+        const auto    distance = std::max(depth, 0.0f);
+        std::uint32_t bits     = 0;
+
+        std::memcpy(&bits, &distance, sizeof bits);
+
+        return (bits >> 20) & k_depth_mask;
+    }
+
+    std::uint64_t render_queue::with_depth(std::uint64_t key, float depth) noexcept
+    {
+        const auto bits = depth_bits(depth);
+
+        if ((key & k_translucent_bit) != 0)
+        {
+            return (key & ~(k_depth_mask << k_state_bits)) | ((k_depth_mask - bits) << k_state_bits);
+        }
+
+        return (key & ~k_depth_mask) | bits;
+    }
+
+    template <typename T>
+    std::uint64_t render_queue::state_id(std::unordered_map<T, std::uint64_t>& ids, T state) noexcept
+    {
+        const auto result = ids.emplace(state, static_cast<std::uint64_t>(ids.size()));
+
+        return result.first->second;
+    }
+}
@@ -0,0 +1,138 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_RENDER_QUEUE_HPP
+#define SCENER_GRAPHICS_RENDER_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "scener/graphics/vulkan/graphics_pipeline.hpp"
+#include "scener/math/bounding_sphere.hpp"
+
+namespace scener::graphics
+{
+    class effect_technique;
+    class frustum_culler;
+    class index_buffer;
+    class instance_buffer;
+    class vertex_buffer;
+
+    /// Describes a single indexed draw call and the state it requires.
+    struct draw_packet final
+    {
+    public:
+        /// The sort key, built from the draw order, translucency, pipeline, descriptor sets, vertex/index buffers and
+        /// depth.
+        std::uint64_t key { 0 };
+
+        /// The draw order of the component that queued the draw; lower values are drawn first.
+        std::uint32_t draw_order { 0 };
+
+        /// Offset to add to each vertex index in the index buffer.
+        std::uint32_t base_vertex { 0 };
+
+        /// Location in the index array at which to start reading vertices.
+        std::uint32_t start_index { 0 };
+
+        /// The graphics pipeline (and its descriptor sets) used by the draw; draws are grouped by the pipeline
+        /// object, which is shared by mesh parts with the same shaders, vertex declaration and states.
+        const vulkan::graphics_pipeline* pipeline { nullptr };
+
+        /// The vertex buffer bound at binding 0.
+        const graphics::vertex_buffer* vertex_buffer { nullptr };
+
+        /// The per-instance stream bound at binding 1.
+        const graphics::instance_buffer* instance_buffer { nullptr };
+
+        /// The index buffer.
+        const graphics::index_buffer* index_buffer { nullptr };
+
+        /// The technique whose texture table indices are pushed when the pipeline uses the bindless texture table.
+        const effect_technique* technique { nullptr };
+
+        /// The object space bounds of the draw, transformed by the technique world matrix every frame; the draw is
+        /// never culled when nullptr.
+        const math::bounding_sphere* bounds { nullptr };
+
+        /// Indicates whether the draw is inside the view frustum; culled draws are not recorded.
+        bool visible { true };
+
+        /// Indicates whether the draw blends with the render target; translucent draws go after the opaque draws
+        /// of the same draw order, back to front.
+        bool translucent { false };
+    };
+
+    /// Collects draw packets and orders them by draw order, then opaque draws grouped by state to minimize pipeline,
+    /// descriptor set and buffer state changes, then translucent draws back to front.
+    class render_queue final
+    {
+    public:
+        /// Initializes a new instance of the render_queue class.
+        render_queue() noexcept;
+
+    public:
+        /// Gets the queued draw packets.
+        /// \returns the queued draw packets, sorted after a call to sort.
+        const std::vector<draw_packet>& packets() const noexcept;
+
+        /// Gets the number of queued draw packets.
+        /// \returns the number of queued draw packets.
+        std::size_t size() const noexcept;
+
+        /// Removes all queued draw packets.
+        void clear() noexcept;
+
+        /// Queues a draw packet, computing its sort key.
+        /// \param packet the draw packet to queue.
+        /// \param depth the view space distance of the draw, used to order opaque draws sharing the same state front
+        ///              to back, and translucent draws back to front.
+        void submit(const draw_packet& packet, float depth) noexcept;
+
+        /// Updates the depth of a queued draw packet; the packets are not reordered until the next call to sort.
+        /// \param index the index of the draw packet.
+        /// \param depth the view space distance of the draw.
+        void depth(std::size_t index, float depth) noexcept;
+
+        /// Sets the visibility of a queued draw packet.
+        /// \param index the index of the draw packet.
+        /// \param visible true if the draw packet is inside the view frustum; false otherwise.
+        /// \returns true if the visibility of the draw packet has changed; false otherwise.
+        bool visible(std::size_t index, bool visible) noexcept;
+
+        /// Updates the visibility of the given draw packets by testing their world space bounds against a view frustum.
+        /// \param culler the view frustum to test against.
+        /// \param indices the indices of the draw packets to test.
+        /// \param bounds the world space bounds of each draw packet, in the same order as indices.
+        /// \returns true if the visibility of any of the draw packets has changed; false otherwise.
+        bool cull(const frustum_culler&                         culler
+                , const gsl::span<const std::size_t>&           indices
+                , const gsl::span<const math::bounding_sphere>& bounds) noexcept;
+
+        /// Sorts the queued draw packets by key; draws with equal keys keep their relative order.
+        /// \returns true if the order of the draw packets has changed; false otherwise.
+        bool sort() noexcept;
+
+    private:
+        static std::uint64_t depth_bits(float depth) noexcept;
+
+        static std::uint64_t with_depth(std::uint64_t key, float depth) noexcept;
+
+        template <typename T>
+        std::uint64_t state_id(std::unordered_map<T, std::uint64_t>& ids, T state) noexcept;
+
+    private:
+        std::vector<draw_packet>                        _packets;
+        std::unordered_map<VkPipeline, std::uint64_t>   _pipeline_ids;
+        std::unordered_map<const void*, std::uint64_t>  _descriptor_ids;
+        std::unordered_map<const void*, std::uint64_t>  _vertex_buffer_ids;
+        std::unordered_map<const void*, std::uint64_t>  _index_buffer_ids;
+        std::vector<std::uint8_t>                       _visibility;
+    };
+}
+
+#endif // SCENER_GRAPHICS_RENDER_QUEUE_HPP
@@ -3,9 +3,7 @@
 
 #include "scener/graphics/renderer.hpp"
 
-#include <iostream>
-#include <thread>
-
+#include "scener/diagnostics/profiler.hpp"
 #include "scener/graphics/graphics_device.hpp"
 #include "scener/graphics/graphics_device_manager.hpp"
 #include "scener/graphics/window.hpp"
@@ -18,6 +16,8 @@ namespace scener::graphics
 {
     using scener::timespan;
     using scener::content::content_manager;
+    using scener::diagnostics::profile_zone;
+    using scener::diagnostics::profiler;
     using scener::graphics::graphics_device;
     using scener::input::keyboard;
     using scener::input::keyboard_state;
@@ -133,14 +133,27 @@ namespace scener::graphics
     {
         _timer.reset();
 
+        _time        = steptime();
+        _accumulator = step_accumulator();
+
         _window->show();
 
         _device_manager->begin_prepare();
 
-        std::for_each(_drawable_components.begin(), _drawable_components.end(), [&](const auto& component) -> void
+        // Components are sorted by draw order, the device gets the rank of each distinct draw order
+        std::uint32_t draw_order = 0;
+
+        for (std::size_t i = 0; i < _drawable_components.size(); ++i)
         {
-            component->draw();
-        });
+            if (i > 0 && _drawable_components[i]->draw_order() != _drawable_components[i - 1]->draw_order())
+            {
+                draw_order++;
+            }
+
+            device()->draw_order(draw_order);
+
+            _drawable_components[i]->draw();
+        }
 
         _device_manager->end_prepare();
 
@@ -160,6 +173,8 @@ namespace scener::graphics
     */
     void renderer::time_step() noexcept
     {
+        profiler::begin_frame();
+
         if (is_fixed_time_step)
         {
             fixed_time_step();
@@ -168,6 +183,8 @@ namespace scener::graphics
         {
             variable_time_step();
         }
+
+        profiler::end_frame();
     }
 
     void renderer::post_process_components() noexcept
@@ -220,32 +237,67 @@ namespace scener::graphics
 
     void renderer::fixed_time_step() noexcept
     {
-        _time.elapsed_render_time = _timer.elapsed_time_step_time();
-        _time.total_render_time   = _timer.elapsed_time();
-        _time.is_running_slowly   = _is_running_slowly;
+        const auto capped = _accumulator.accumulate(_timer.elapsed_time_step_time(), target_elapsed_time, max_update_steps);
 
         _timer.update_time_step();
 
-        update(_time);
+        if (capped)
+        {
+            profiler::mark("running_slowly", "renderer");
+        }
 
-        _is_running_slowly = (_timer.elapsed_time_step_time() > target_elapsed_time);
+        _is_running_slowly = (_accumulator.accumulated_time() >= target_elapsed_time + target_elapsed_time);
 
-        if (!_is_running_slowly)
-        {           
-            _device_manager->draw();
+        {
+            profile_zone zone { "update", "renderer" };
 
-            auto interval = (target_elapsed_time - _timer.elapsed_time_step_time());
+            while (_accumulator.take_step(target_elapsed_time))
+            {
+                _time.elapsed_render_time = target_elapsed_time;
+                _time.total_render_time  += target_elapsed_time;
+                _time.is_running_slowly   = _is_running_slowly;
 
-            std::this_thread::sleep_for(interval.to_duration<std::chrono::milliseconds>());
+                update(_time);
+            }
         }
-        else
+
+        // Fraction of the next step already elapsed, to interpolate between the last two updates when drawing
+        _time.interpolation_alpha = _accumulator.interpolation_alpha(target_elapsed_time);
+
         {
-            std::cout << "running slowly" << std::endl;
+            profile_zone zone { "draw", "renderer" };
+
+            _device_manager->draw();
         }
+
+        // Wait for the next step to be due
+        _timer.wait_for_time_step(target_elapsed_time - _accumulator.accumulated_time());
     }
 
     void renderer::variable_time_step() noexcept
     {
+        const auto max_elapsed_time = timespan::from_ticks(target_elapsed_time.ticks() * max_update_steps);
+        const auto elapsed_time     = _timer.elapsed_time_step_time();
+
+        _timer.update_time_step();
+
+        // A long stall (debugger break, window drag) is clamped instead of producing a huge time step
+        _time.elapsed_render_time = (elapsed_time > max_elapsed_time) ? max_elapsed_time : elapsed_time;
+        _time.total_render_time  += _time.elapsed_render_time;
+        _time.is_running_slowly   = (elapsed_time > target_elapsed_time);
+        _time.interpolation_alpha = 1.0f;
+
+        {
+            profile_zone zone { "update", "renderer" };
+
+            update(_time);
+        }
+
+        {
+            profile_zone zone { "draw", "renderer" };
+
+            _device_manager->draw();
+        }
     }
 
     graphics_device_manager* renderer::device_manager() const
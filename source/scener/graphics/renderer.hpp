@@ -4,6 +4,7 @@
 #ifndef SCENER_GRAPHICS_RENDERER_HPP
 #define SCENER_GRAPHICS_RENDERER_HPP
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,6 +15,7 @@
 #include "scener/graphics/idrawable.hpp"
 #include "scener/graphics/iupdateable.hpp"
 #include "scener/graphics/service_container.hpp"
+#include "scener/graphics/step_accumulator.hpp"
 #include "scener/graphics/steptime.hpp"
 #include "scener/graphics/steptimer.hpp"
 
@@ -108,6 +110,10 @@ namespace scener::graphics
         /// Gets or sets the target time between calls to update when is_fixed_time_step is true.
         scener::timespan target_elapsed_time { 10000000L / 60L };
 
+        /// Gets or sets the maximum number of update calls per frame used to catch up when is_fixed_time_step is true.
+        /// Any time beyond it is dropped, so a slow frame can't trigger an ever growing number of updates.
+        std::uint32_t max_update_steps { 5 };
+
     protected:
         graphics_device_manager* device_manager() const;
         void add_component(std::shared_ptr<icomponent> component);
@@ -122,7 +128,7 @@ namespace scener::graphics
         std::unique_ptr<service_container>        _services              { nullptr };
         steptimer                                 _timer                 { };
         steptime                                  _time                  { };
-        scener::timespan                          _total_tender_time     { timespan::zero() };
+        step_accumulator                          _accumulator           { };
         bool                                      _is_running_slowly     { false };
         std::string                               _root_directory        { };
 
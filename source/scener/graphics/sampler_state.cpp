@@ -24,4 +24,44 @@ namespace scener::graphics
         address_v  = address_mode;
         address_w  = address_mode;
     }
+
+    bool sampler_state::operator==(const sampler_state& state) const noexcept
+    {
+        return address_u                    == state.address_u
+            && address_v                    == state.address_v
+            && address_w                    == state.address_w
+            && mag_filter                   == state.mag_filter
+            && min_filter                   == state.min_filter
+            && max_anisotropy               == state.max_anisotropy
+            && max_mip_level                == state.max_mip_level
+            && mip_map_level_of_detail_bias == state.mip_map_level_of_detail_bias;
+    }
+
+    bool sampler_state::operator!=(const sampler_state& state) const noexcept
+    {
+        return !(*this == state);
+    }
+}
+
+namespace std
+{
+    std::size_t hash<scener::graphics::sampler_state>::operator()(const scener::graphics::sampler_state& state) const noexcept
+    {
+        std::size_t seed = 0;
+
+        const auto combine = [&seed] (std::size_t value) -> void {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+
+        combine(static_cast<std::size_t>(state.address_u));
+        combine(static_cast<std::size_t>(state.address_v));
+        combine(static_cast<std::size_t>(state.address_w));
+        combine(static_cast<std::size_t>(state.mag_filter));
+        combine(static_cast<std::size_t>(state.min_filter));
+        combine(std::hash<std::int32_t>()(state.max_anisotropy));
+        combine(std::hash<std::size_t>()(state.max_mip_level));
+        combine(std::hash<float>()(state.mip_map_level_of_detail_bias));
+
+        return seed;
+    }
 }
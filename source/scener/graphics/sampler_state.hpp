@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 
 #include "scener/graphics/texture_filter.hpp"
 #include "scener/graphics/texture_address_mode.hpp"
@@ -57,8 +58,29 @@ namespace scener::graphics
         /// Gets or sets the mipmap LOD bias, which ranges from -1.0 to +1.0. The default value is 0.
         float mip_map_level_of_detail_bias { 0 };
 
+    public:
+        /// Checks whether the given sampler state describes the same sampler as this one.
+        /// \param state the sampler state to compare with.
+        /// \returns true when every sampling setting is equal; otherwise false.
+        bool operator==(const sampler_state& state) const noexcept;
+
+        /// Checks whether the given sampler state describes a different sampler than this one.
+        /// \param state the sampler state to compare with.
+        /// \returns true when any sampling setting differs; otherwise false.
+        bool operator!=(const sampler_state& state) const noexcept;
+
         template <typename T> friend class scener::content::readers::content_type_reader;
     };
 }
 
+namespace std
+{
+    /// Hashes sampler states, so devices can share a single sampler object between identical states.
+    template <>
+    struct hash<scener::graphics::sampler_state>
+    {
+        std::size_t operator()(const scener::graphics::sampler_state& state) const noexcept;
+    };
+}
+
 #endif // SCENER_GRAPHICS_SAMPLER_STATE_HPP
@@ -0,0 +1,209 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/scene_graph.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include <gsl/gsl>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+namespace scener::graphics
+{
+    using scener::math::matrix4;
+
+    namespace
+    {
+        static_assert(sizeof(matrix4) == sizeof(float) * 16, "matrix4 is expected to be 16 packed floats");
+
+        // result = lhs * rhs (row vectors), each result row is a linear combination of the rhs rows.
+        inline void multiply(const matrix4& lhs, const matrix4& rhs, matrix4& result) noexcept
+        {
+#if defined(__SSE__)
+            alignas(16) float a[16];
+            alignas(16) float b[16];
+            alignas(16) float r[16];
+
+            std::memcpy(a, &lhs, sizeof a);
+            std::memcpy(b, &rhs, sizeof b);
+
+            const auto b0 = _mm_load_ps(b);
+            const auto b1 = _mm_load_ps(b + 4);
+            const auto b2 = _mm_load_ps(b + 8);
+            const auto b3 = _mm_load_ps(b + 12);
+
+            for (std::size_t row = 0; row < 16; row += 4)
+            {
+                auto value = _mm_mul_ps(_mm_set1_ps(a[row]), b0);
+
+                value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(a[row + 1]), b1));
+                value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(a[row + 2]), b2));
+                value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(a[row + 3]), b3));
+
+                _mm_store_ps(r + row, value);
+            }
+
+            std::memcpy(&result, r, sizeof r);
+#else
+            result = lhs * rhs;
+#endif
+        }
+    }
+
+    scene_graph::scene_graph() noexcept
+        : _names        { }
+        , _parents      { }
+        , _subtree_ends { }
+        , _local        { }
+        , _world        { }
+        , _dirty        { }
+        , _dirty_nodes  { }
+    {
+    }
+
+    std::size_t scene_graph::size() const noexcept
+    {
+        return _parents.size();
+    }
+
+    void scene_graph::reserve(std::size_t count) noexcept
+    {
+        _names.reserve(count);
+        _parents.reserve(count);
+        _subtree_ends.reserve(count);
+        _local.reserve(count);
+        _world.reserve(count);
+        _dirty.reserve(count);
+    }
+
+    void scene_graph::clear() noexcept
+    {
+        _names.clear();
+        _parents.clear();
+        _subtree_ends.clear();
+        _local.clear();
+        _world.clear();
+        _dirty.clear();
+        _dirty_nodes.clear();
+    }
+
+    std::int32_t scene_graph::add_node(const std::string& name, std::int32_t parent, const matrix4& local) noexcept
+    {
+        const auto index = static_cast<std::int32_t>(_parents.size());
+
+        // Depth-first order: the parent subtree must still be open, i.e. end at the current node count
+        Expects(parent == no_parent || (parent >= 0 && parent < index && _subtree_ends[parent] == index));
+
+        _names.push_back(name);
+        _parents.push_back(parent);
+        _subtree_ends.push_back(index + 1);
+        _local.push_back(local);
+        _world.push_back(local);
+        _dirty.push_back(1);
+        _dirty_nodes.push_back(index);
+
+        for (auto ancestor = parent; ancestor != no_parent; ancestor = _parents[ancestor])
+        {
+            _subtree_ends[ancestor] = index + 1;
+        }
+
+        return index;
+    }
+
+    std::int32_t scene_graph::find(const std::string& name) const noexcept
+    {
+        const auto it = std::find(_names.begin(), _names.end(), name);
+
+        return (it == _names.end()) ? no_parent : static_cast<std::int32_t>(std::distance(_names.begin(), it));
+    }
+
+    const std::string& scene_graph::name(std::int32_t node) const noexcept
+    {
+        return _names[node];
+    }
+
+    std::int32_t scene_graph::parent(std::int32_t node) const noexcept
+    {
+        return _parents[node];
+    }
+
+    const matrix4& scene_graph::local_transform(std::int32_t node) const noexcept
+    {
+        return _local[node];
+    }
+
+    void scene_graph::local_transform(std::int32_t node, const matrix4& transform) noexcept
+    {
+        Expects(node >= 0 && node < static_cast<std::int32_t>(_parents.size()));
+
+        _local[node] = transform;
+
+        if (_dirty[node] == 0)
+        {
+            _dirty[node] = 1;
+            _dirty_nodes.push_back(node);
+        }
+    }
+
+    const matrix4& scene_graph::world_transform(std::int32_t node) const noexcept
+    {
+        return _world[node];
+    }
+
+    const std::vector<matrix4>& scene_graph::world_transforms() const noexcept
+    {
+        return _world;
+    }
+
+    std::size_t scene_graph::update() noexcept
+    {
+        if (_dirty_nodes.empty())
+        {
+            return 0;
+        }
+
+        // Subtrees are either nested or disjoint, so once sorted a dirty node either starts a new subtree
+        // or lies inside the one that has just been recomputed.
+        std::sort(_dirty_nodes.begin(), _dirty_nodes.end());
+
+        std::size_t  updated = 0;
+        std::int32_t end     = 0;
+
+        for (const auto root : _dirty_nodes)
+        {
+            if (root < end)
+            {
+                continue;
+            }
+
+            end = _subtree_ends[root];
+
+            for (auto node = root; node < end; ++node)
+            {
+                const auto parent = _parents[node];
+
+                if (parent == no_parent)
+                {
+                    _world[node] = _local[node];
+                }
+                else
+                {
+                    multiply(_local[node], _world[parent], _world[node]);
+                }
+
+                _dirty[node] = 0;
+            }
+
+            updated += static_cast<std::size_t>(end - root);
+        }
+
+        _dirty_nodes.clear();
+
+        return updated;
+    }
+}
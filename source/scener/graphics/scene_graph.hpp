@@ -0,0 +1,99 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_SCENE_GRAPH_HPP
+#define SCENER_GRAPHICS_SCENE_GRAPH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "scener/math/basic_matrix.hpp"
+
+namespace scener::graphics
+{
+    /// Flattened node hierarchy. Nodes are stored in depth-first (pre-order) order as parallel arrays, so every
+    /// parent precedes its children and the descendants of a node occupy a contiguous range right after it.
+    /// Changing a local transform only marks the node as dirty; world transforms of the dirty subtrees are
+    /// recomputed in a single batched pass on update.
+    class scene_graph final
+    {
+    public:
+        /// Index value used for nodes without parent.
+        static constexpr std::int32_t no_parent = -1;
+
+    public:
+        /// Initializes a new instance of the scene_graph class.
+        scene_graph() noexcept;
+
+    public:
+        /// Gets the number of nodes in the graph.
+        /// \returns the number of nodes in the graph.
+        std::size_t size() const noexcept;
+
+        /// Reserves storage for the given number of nodes.
+        /// \param count the number of nodes to reserve storage for.
+        void reserve(std::size_t count) noexcept;
+
+        /// Removes all the nodes from the graph.
+        void clear() noexcept;
+
+        /// Appends a new node to the graph. Nodes must be added in depth-first order, so the parent must be
+        /// either the last added node or one of its ancestors.
+        /// \param name the node name.
+        /// \param parent the index of the parent node, or no_parent for root nodes.
+        /// \param local the node transform relative to its parent.
+        /// \returns the index of the new node.
+        std::int32_t add_node(const std::string& name, std::int32_t parent, const scener::math::matrix4& local) noexcept;
+
+        /// Finds a node by name.
+        /// \param name the node name.
+        /// \returns the node index; or no_parent when no node has the given name.
+        std::int32_t find(const std::string& name) const noexcept;
+
+        /// Gets the name of the given node.
+        /// \param node the node index.
+        /// \returns the node name.
+        const std::string& name(std::int32_t node) const noexcept;
+
+        /// Gets the parent of the given node.
+        /// \param node the node index.
+        /// \returns the parent node index; or no_parent for root nodes.
+        std::int32_t parent(std::int32_t node) const noexcept;
+
+        /// Gets the transform of the given node relative to its parent.
+        /// \param node the node index.
+        /// \returns the node local transform.
+        const scener::math::matrix4& local_transform(std::int32_t node) const noexcept;
+
+        /// Sets the transform of the given node relative to its parent and marks its subtree as dirty.
+        /// \param node the node index.
+        /// \param transform the node local transform.
+        void local_transform(std::int32_t node, const scener::math::matrix4& transform) noexcept;
+
+        /// Gets the world transform of the given node as computed by the last call to update.
+        /// \param node the node index.
+        /// \returns the node world transform.
+        const scener::math::matrix4& world_transform(std::int32_t node) const noexcept;
+
+        /// Gets the world transforms of all the nodes, indexed by node.
+        /// \returns the world transforms of all the nodes.
+        const std::vector<scener::math::matrix4>& world_transforms() const noexcept;
+
+        /// Recomputes the world transforms of the dirty subtrees.
+        /// \returns the number of world transforms that have been recomputed.
+        std::size_t update() noexcept;
+
+    private:
+        std::vector<std::string>           _names;
+        std::vector<std::int32_t>          _parents;
+        std::vector<std::int32_t>          _subtree_ends;
+        std::vector<scener::math::matrix4> _local;
+        std::vector<scener::math::matrix4> _world;
+        std::vector<std::uint8_t>          _dirty;
+        std::vector<std::int32_t>          _dirty_nodes;
+    };
+}
+
+#endif // SCENER_GRAPHICS_SCENE_GRAPH_HPP
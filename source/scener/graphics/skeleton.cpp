@@ -3,6 +3,8 @@
 
 #include "scener/graphics/skeleton.hpp"
 
+#include <gsl/gsl>
+
 #include "scener/graphics/animation.hpp"
 #include "scener/graphics/bone.hpp"
 
@@ -11,6 +13,27 @@ namespace scener::graphics
     using scener::timespan;
     using scener::math::matrix4;
 
+    skeleton::skeleton(const std::string&                        name
+                     , const std::vector<std::shared_ptr<bone>>& bones
+                     , const std::vector<matrix4>&               inverse_bind_matrices) noexcept
+        : _bind_shape_matrix     { matrix4::identity() }
+        , _inverse_bind_matrices { inverse_bind_matrices }
+        , _bones                 { bones }
+        , _bone_transforms       { }
+        , _world_transforms      (bones.size())
+        , _skin_transforms       (bones.size())
+        , _name                  { name }
+    {
+        Expects(_inverse_bind_matrices.size() == _bones.size());
+
+        _bone_transforms.reserve(_bones.size());
+
+        for (const auto& bone : _bones)
+        {
+            _bone_transforms.push_back(bone->transform());
+        }
+    }
+
     const matrix4& skeleton::bind_shape_matrix() const noexcept
     {
         return _bind_shape_matrix;
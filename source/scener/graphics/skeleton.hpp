@@ -21,6 +21,18 @@ namespace scener::graphics
     /// Represents a hierarchical collection of bones.
     class skeleton final
     {
+    public:
+        /// Initializes a new instance of the skeleton class.
+        skeleton() = default;
+
+        /// Initializes a new instance of the skeleton class.
+        /// \param name the skeleton name.
+        /// \param bones the bones used to animate the skin, parents first.
+        /// \param inverse_bind_matrices the inverse-bind matrices of each bone.
+        skeleton(const std::string&                        name
+               , const std::vector<std::shared_ptr<bone>>& bones
+               , const std::vector<math::matrix4>&         inverse_bind_matrices) noexcept;
+
     public:
         /// Describes how to pose the skin's geometry for use with the bones.
         /// \returns a matrix describing how to pose the skin's geometry for use with the bones.
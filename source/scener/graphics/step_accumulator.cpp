@@ -0,0 +1,48 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/step_accumulator.hpp"
+
+namespace scener::graphics
+{
+    using scener::timespan;
+
+    bool step_accumulator::accumulate(const timespan& elapsed_time, const timespan& step, std::uint32_t max_steps) noexcept
+    {
+        const auto max_accumulated_time = timespan::from_ticks(step.ticks() * max_steps);
+
+        _accumulated_time += elapsed_time;
+
+        // Cap the catch-up work, otherwise slow updates would require even more updates on the next frame
+        if (_accumulated_time > max_accumulated_time)
+        {
+            _accumulated_time = max_accumulated_time;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    bool step_accumulator::take_step(const timespan& step) noexcept
+    {
+        if (_accumulated_time < step)
+        {
+            return false;
+        }
+
+        _accumulated_time -= step;
+
+        return true;
+    }
+
+    const timespan& step_accumulator::accumulated_time() const noexcept
+    {
+        return _accumulated_time;
+    }
+
+    float step_accumulator::interpolation_alpha(const timespan& step) const noexcept
+    {
+        return static_cast<float>(_accumulated_time.ticks()) / static_cast<float>(step.ticks());
+    }
+}
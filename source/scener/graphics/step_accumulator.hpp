@@ -0,0 +1,41 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_STEP_ACCUMULATOR_HPP
+#define SCENER_GRAPHICS_STEP_ACCUMULATOR_HPP
+
+#include <cstdint>
+
+#include "scener/timespan.hpp"
+
+namespace scener::graphics
+{
+    /// Accumulates elapsed time and hands it out as fixed update steps.
+    class step_accumulator final
+    {
+    public:
+        /// Adds the time elapsed since the last time step, dropping any time beyond max_steps update steps.
+        /// \param elapsed_time the time elapsed since the last time step.
+        /// \param step the fixed update step.
+        /// \param max_steps the maximum number of update steps that can be accumulated.
+        /// \returns true when time has been dropped; otherwise false.
+        bool accumulate(const timespan& elapsed_time, const timespan& step, std::uint32_t max_steps) noexcept;
+
+        /// Takes an update step from the accumulated time when there is enough time for it.
+        /// \param step the fixed update step.
+        /// \returns true when an update is due; otherwise false.
+        bool take_step(const timespan& step) noexcept;
+
+        /// Gets the accumulated time not yet taken by update steps.
+        const timespan& accumulated_time() const noexcept;
+
+        /// Gets the fraction of the next update step already accumulated, in the [0, 1) range.
+        /// \param step the fixed update step.
+        float interpolation_alpha(const timespan& step) const noexcept;
+
+    private:
+        timespan _accumulated_time { timespan::zero() };
+    };
+}
+
+#endif // SCENER_GRAPHICS_STEP_ACCUMULATOR_HPP
@@ -21,6 +21,7 @@ namespace scener::graphics
         : total_render_time   { total_time }
         , elapsed_render_time { elapsed_time }
         , is_running_slowly   { running_slowly }
+        , interpolation_alpha { 1.0f }
     {
     }
 }
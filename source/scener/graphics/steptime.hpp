@@ -35,6 +35,10 @@ namespace scener::graphics
 
         /// Gets or sets the amount of render time since the start of the renderer.
         bool is_running_slowly;
+
+        /// Gets or sets the blending factor, in the [0, 1) range, between the last two fixed time step updates
+        /// to be used when rendering; always 1 with variable time steps.
+        float interpolation_alpha;
     };
 }
 
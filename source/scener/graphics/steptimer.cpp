@@ -3,6 +3,8 @@
 
 #include "scener/graphics/steptimer.hpp"
 
+#include <thread>
+
 namespace scener::graphics
 {
     using scener::timespan;
@@ -28,6 +30,25 @@ namespace scener::graphics
         return timespan::from_duration(current_time() - _last_time_step);
     }
     
+    void steptimer::wait_for_time_step(const timespan& interval) const noexcept
+    {
+        const auto deadline = _last_time_step + std::chrono::duration_cast<timespan::clock::duration>(
+            timespan::ticks_duration(interval.ticks()));
+
+        // Coarse sleeps, leaving the spin threshold as margin for the scheduler wake-up latency
+        for (auto remaining = deadline - current_time();
+             remaining > spin_threshold.to_duration<timespan::clock::duration>();
+             remaining = deadline - current_time())
+        {
+            std::this_thread::sleep_for(remaining - spin_threshold.to_duration<timespan::clock::duration>());
+        }
+
+        while (current_time() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
     timespan::clock::time_point steptimer::current_time() const noexcept
     {
         return timespan::clock::now();
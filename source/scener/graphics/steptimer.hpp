@@ -24,6 +24,16 @@ namespace scener::graphics
         /// Gets the time elapsed since the last time step update.
         timespan elapsed_time_step_time() const noexcept;
 
+        /// Blocks the calling thread until the given time has elapsed since the last time step update.
+        /// Sleeps while far from the deadline and spins for the last stretch, as sleeps overshoot by up to
+        /// the scheduler granularity.
+        /// \param interval the time, since the last time step update, to wait for.
+        void wait_for_time_step(const timespan& interval) const noexcept;
+
+    public:
+        /// The remaining time below which wait_for_time_step spins instead of sleeping.
+        constexpr static const timespan spin_threshold { 2 * timespan::ticks_per_millisecond };
+
     private:
         timespan::clock::time_point current_time() const noexcept;
 
@@ -13,6 +13,8 @@ namespace scener::graphics
     {
         color            = 0x8058   ///< (Unsigned format) 32-bit ARGB pixel format with alpha,
                                     ///< using 8 bits per channel.
+      , color_srgb       = 0x8C43   ///< (Unsigned format) 32-bit ARGB pixel format with alpha, using 8 bits per
+                                    ///< channel, with sRGB encoded color channels.
       , bgr565           = 0x8D62   ///< (Unsigned format) 16-bit BGR pixel format with 5 bits for blue,
                                     ///< 6 bits for green, and 5 bits for red.
       , bgra5551         = 0x8057   ///< (Unsigned format) 16-bit BGRA pixel format where 5 bits are
@@ -22,11 +24,25 @@ namespace scener::graphics
       , dxt1             = 0x83F1   ///< DXT1 compression texture format.
       , dxt3             = 0x83F2   ///< DXT3 compression texture format.
       , dxt5             = 0x83F3   ///< DXT5 compression texture format.
+      , dxt1_srgb        = 0x8C4D   ///< DXT1 compression texture format with sRGB encoded color channels.
+      , dxt3_srgb        = 0x8C4E   ///< DXT3 compression texture format with sRGB encoded color channels.
+      , dxt5_srgb        = 0x8C4F   ///< DXT5 compression texture format with sRGB encoded color channels.
       , normalized_byte2 = 0x8F95   ///< (Signed format) 16-bit bump-map format using 8 bits each for u and v data.
       , normalized_byte4 = 0x8F97   ///< (Signed format) 32-bit bump-map format using 8 bits for each channel.
       , rgba1010102      = 0x8059   ///< 32-bit RGBA pixel format using 10 bits for each color and 2 bits for alpha.
       , rg32             = 0x822C   ///< 32-bit pixel format using 16 bits each for red and green.
       , rgba64           = 0x805B   ///< 64-bit RGBA pixel format using 16 bits for each component.
+      , bgra32           = 0x80E1   ///< (Unsigned format) 32-bit BGRA pixel format with alpha,
+                                    ///< using 8 bits per channel.
+      , bgra32_srgb      = 0x8C44   ///< (Unsigned format) 32-bit BGRA pixel format with alpha, using 8 bits per
+                                    ///< channel, with sRGB encoded color channels.
+      , half_vector4     = 0x881A   ///< 64-bit RGBA pixel format using 16-bit floating-point values for each channel.
+      , bc4              = 0x8DBB   ///< BC4 single channel compression texture format.
+      , bc5              = 0x8DBD   ///< BC5 two channel compression texture format.
+      , bc6h             = 0x8E8F   ///< BC6H unsigned half floating-point compression texture format.
+      , bc6h_signed      = 0x8E8E   ///< BC6H signed half floating-point compression texture format.
+      , bc7              = 0x8E8C   ///< BC7 compression texture format.
+      , bc7_srgb         = 0x8E8D   ///< BC7 compression texture format with sRGB encoded color channels.
     };
 }
 
@@ -5,11 +5,12 @@
 
 #include "scener/graphics/graphics_device.hpp"
 #include "scener/graphics/sampler_state.hpp"
+#include "scener/graphics/texture_table.hpp"
 
 namespace scener::graphics
 {
     texture2d::texture2d(gsl::not_null<graphics_device*> device, std::uint32_t width, std::uint32_t height) noexcept
-        : texture2d(device, width, height, surface_format::color)
+        : texture2d(device, width, height, surface_format::color_srgb)
     {
     }
 
@@ -23,6 +24,9 @@ namespace scener::graphics
         , _height         { height }
         , _width          { width }
         , _texture_object { }
+        , _surface        { nullptr }
+        , _sampler_state  { }
+        , _table_index    { texture_table::invalid_index }
     {
     }
 
@@ -30,6 +34,11 @@ namespace scener::graphics
     {
         if (_graphics_device != nullptr)
         {
+            if (_table_index != texture_table::invalid_index)
+            {
+                _graphics_device->texture_table()->remove(_table_index);
+            }
+
             _graphics_device->destroy(_texture_object);
         }
 
@@ -61,6 +70,11 @@ namespace scener::graphics
         return _height;
     }
 
+    std::uint32_t texture2d::table_index() const noexcept
+    {
+        return _table_index;
+    }
+
     const vk::Sampler& texture2d::sampler() const noexcept
     {
         return _texture_object.sampler;
@@ -11,6 +11,8 @@
 #include <gsl/gsl>
 #include <vulkan/vulkan.hpp>
 
+#include "scener/content/dds/surface.hpp"
+#include "scener/graphics/sampler_state.hpp"
 #include "scener/graphics/surface_format.hpp"
 #include "scener/graphics/texture.hpp"
 #include "scener/graphics/vulkan/texture_object.hpp"
@@ -20,7 +22,8 @@ namespace scener::content::readers { template <typename T> class content_type_re
 namespace scener::graphics
 {
     class graphics_device;
-    class sampler_state;
+    class texture_streamer;
+    class texture_table;
 
     /// Represents a 2D texture.
     class texture2d final : public texture
@@ -65,17 +68,27 @@ namespace scener::graphics
         /// \returns the texture height, in pixels.
         std::uint32_t height() const noexcept;
 
+        /// Gets the index of the texture in the bindless texture table.
+        /// \returns the index of the texture in the bindless texture table; texture_table::invalid_index when the
+        ///          device does not use one.
+        std::uint32_t table_index() const noexcept;
+
         const vk::Sampler& sampler() const noexcept override;
         const vk::ImageView& view() const noexcept override;
 
     private:
-        surface_format         _format;
-        std::uint32_t          _mipmap_levels;
-        std::uint32_t          _height;
-        std::uint32_t          _width;
-        vulkan::texture_object _texture_object;
+        surface_format                         _format;
+        std::uint32_t                          _mipmap_levels;
+        std::uint32_t                          _height;
+        std::uint32_t                          _width;
+        vulkan::texture_object                 _texture_object;
+        std::shared_ptr<content::dds::surface> _surface;
+        sampler_state                          _sampler_state;
+        std::uint32_t                          _table_index;
 
         template <typename T> friend class scener::content::readers::content_type_reader;
+        friend class scener::graphics::texture_streamer;
+        friend class scener::graphics::texture_table;
     };
 }
 
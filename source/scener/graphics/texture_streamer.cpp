@@ -0,0 +1,419 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/texture_streamer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "scener/graphics/effect_pass.hpp"
+#include "scener/graphics/effect_technique.hpp"
+#include "scener/graphics/frustum_culler.hpp"
+#include "scener/graphics/graphics_device.hpp"
+#include "scener/graphics/texture2d.hpp"
+#include "scener/graphics/texture_table.hpp"
+
+namespace scener::graphics
+{
+    using scener::content::dds::surface;
+    using scener::math::bounding_sphere;
+    using scener::math::matrix4;
+
+    texture_streamer::texture_streamer(gsl::not_null<graphics_device*> device
+                                     , std::uint64_t                   budget
+                                     , std::uint32_t                   initial_size) noexcept
+        : _device            { device }
+        , _budget            { budget }
+        , _initial_size      { initial_size }
+        , _frame             { 0 }
+        , _entries           { }
+        , _jobs              { }
+        , _completed         { }
+        , _retired           { }
+        , _stale_descriptors { }
+        , _mutex             { }
+        , _condition         { }
+        , _stop              { false }
+        , _worker            { }
+    {
+        _worker = std::thread(&texture_streamer::run, this);
+    }
+
+    texture_streamer::~texture_streamer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            _stop = true;
+        }
+
+        _condition.notify_all();
+        _worker.join();
+
+        std::for_each(_completed.begin(), _completed.end(), [&] (const auto& done) -> void {
+            _device->_logical_device->destroy(done.staging);
+        });
+
+        // Replaced images may still be referenced by the last submissions
+        if (!_retired.empty())
+        {
+            _device->_logical_device->wait_idle();
+
+            std::for_each(_retired.begin(), _retired.end(), [&] (const auto& retired) -> void {
+                _device->_logical_device->destroy(retired.texture);
+            });
+        }
+    }
+
+    std::uint32_t texture_streamer::initial_level(const surface& surface) const noexcept
+    {
+        return initial_level(surface, _initial_size);
+    }
+
+    std::uint32_t texture_streamer::initial_level(const surface& surface, std::uint32_t initial_size) noexcept
+    {
+        const auto& mipmaps = surface.mipmaps();
+
+        for (std::uint32_t level = 0; level < mipmaps.size(); ++level)
+        {
+            if (std::max(mipmaps[level].width(), mipmaps[level].height()) <= initial_size)
+            {
+                return level;
+            }
+        }
+
+        return static_cast<std::uint32_t>(mipmaps.size()) - 1;
+    }
+
+    void texture_streamer::track(const std::shared_ptr<effect_technique>& technique) noexcept
+    {
+        for (const auto& texture : technique->textures())
+        {
+            if (texture->_surface == nullptr)
+            {
+                continue;
+            }
+
+            auto& entry = _entries[texture.get()];
+
+            if (entry.texture.expired())
+            {
+                entry = { texture, { }, initial_level(*texture->_surface), texture->level_count(), 0, false };
+            }
+
+            entry.techniques.push_back(technique);
+        }
+    }
+
+    void texture_streamer::request(const effect_technique& technique, const bounding_sphere& bounds) noexcept
+    {
+        for (const auto& texture : technique.textures())
+        {
+            auto it = _entries.find(texture.get());
+
+            if (it == _entries.end())
+            {
+                continue;
+            }
+
+            auto&      entry = it->second;
+            const auto level = required_level(std::max(texture->width(), texture->height())
+                                            , texture->level_count()
+                                            , bounds
+                                            , technique.world()
+                                            , technique.view()
+                                            , technique.projection()
+                                            , static_cast<float>(_device->viewport().rect.height()));
+
+            // Textures shared by several draws keep the most detailed level requested during the frame
+            entry.requested_level = (entry.last_used_frame == _frame) ? std::min(entry.requested_level, level) : level;
+            entry.last_used_frame = _frame;
+        }
+    }
+
+    bool texture_streamer::update(std::uint32_t image) noexcept
+    {
+        const auto image_count = _device->_logical_device->image_count();
+
+        Expects(image < image_count);
+
+        std::vector<completed_job> completed;
+
+        _stale_descriptors.resize(image_count);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            completed.swap(_completed);
+        }
+
+        // Swap in the staged mipmap chains
+        for (auto& done : completed)
+        {
+            const auto texture = done.texture.lock();
+
+            if (texture == nullptr)
+            {
+                _device->_logical_device->destroy(done.staging);
+                continue;
+            }
+
+            auto& entry  = _entries[texture.get()];
+            auto  sstate = texture->_sampler_state;
+
+            sstate.max_mip_level = done.staging.level_count - 1;
+            entry.in_flight      = false;
+
+            // Every swap chain image may have a submission, or a descriptor set, referencing the replaced image
+            _retired.push_back({ texture->_texture_object, std::vector<bool>(image_count, true) });
+
+            texture->_texture_object = _device->_logical_device->create_texture_object(
+                done.staging
+              , &sstate
+              , vk::ImageTiling::eOptimal
+              , vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst
+              , vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
+
+            // Textures registered in the texture table are rebound by rewriting their table entry, the table
+            // descriptors can be updated while pending submissions reference them
+            if (texture->_table_index != texture_table::invalid_index)
+            {
+                _device->_texture_table->update(texture->_table_index, *texture);
+                continue;
+            }
+
+            // The descriptor sets of each swap chain image are rewritten once the image is acquired
+            for (auto& stale : _stale_descriptors)
+            {
+                stale.insert(stale.end(), entry.techniques.begin(), entry.techniques.end());
+            }
+        }
+
+        // Forget the released textures
+        for (auto it = _entries.begin(); it != _entries.end();)
+        {
+            it = (it->second.texture.expired()) ? _entries.erase(it) : std::next(it);
+        }
+
+        const auto budget = effective_budget();
+        auto       usage  = _device->_logical_device->memory_usage();
+
+        // Drop the least recently used textures back to their initial resolution while over budget
+        if (usage > budget)
+        {
+            std::vector<std::pair<entry*, std::shared_ptr<texture2d>>> candidates;
+
+            for (auto& [key, entry] : _entries)
+            {
+                auto texture = entry.texture.lock();
+
+                if (!entry.in_flight
+                 && entry.last_used_frame < _frame
+                 && texture->_texture_object.base_level < entry.initial_level)
+                {
+                    candidates.push_back({ &entry, texture });
+                }
+            }
+
+            std::sort(candidates.begin(), candidates.end(), [] (const auto& a, const auto& b) -> bool {
+                return a.first->last_used_frame < b.first->last_used_frame;
+            });
+
+            for (auto& [entry, texture] : candidates)
+            {
+                if (usage <= budget)
+                {
+                    break;
+                }
+
+                const auto resident = chain_size(*texture->_surface, texture->_texture_object.base_level);
+                const auto initial  = chain_size(*texture->_surface, entry->initial_level);
+
+                schedule(*entry, texture, entry->initial_level);
+
+                usage -= std::min(usage, resident - initial);
+            }
+        }
+
+        // Stream in the mipmaps requested this frame that fit in the budget
+        for (auto& [key, entry] : _entries)
+        {
+            auto texture = entry.texture.lock();
+
+            if (entry.in_flight
+             || entry.last_used_frame != _frame
+             || entry.requested_level >= texture->_texture_object.base_level)
+            {
+                continue;
+            }
+
+            const auto resident = chain_size(*texture->_surface, texture->_texture_object.base_level);
+            const auto growth   = chain_size(*texture->_surface, entry.requested_level) - resident;
+
+            if (usage + growth <= budget)
+            {
+                schedule(entry, texture, entry.requested_level);
+
+                usage += growth;
+            }
+        }
+
+        _frame++;
+
+        // The previous submission of the acquired image has completed, so its descriptor sets can be rewritten
+        auto& stale = _stale_descriptors[image];
+
+        std::vector<std::shared_ptr<effect_technique>> dirty;
+
+        dirty.reserve(stale.size());
+
+        for (const auto& user : stale)
+        {
+            if (auto technique = user.lock())
+            {
+                dirty.push_back(technique);
+            }
+        }
+
+        stale.clear();
+
+        std::sort(dirty.begin(), dirty.end());
+        dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+        for (const auto& technique : dirty)
+        {
+            for (const auto& pass : technique->passes())
+            {
+                _device->_logical_device->update_texture_descriptors(image, pass->pipeline(), *technique);
+            }
+        }
+
+        retire(image);
+
+        // The command buffer of the image only needs to be recorded again when its descriptor sets were rewritten
+        return !dirty.empty();
+    }
+
+    std::uint32_t texture_streamer::required_level(std::uint32_t          size
+                                                 , std::uint32_t          level_count
+                                                 , const bounding_sphere& bounds
+                                                 , const matrix4&         world
+                                                 , const matrix4&         view
+                                                 , const matrix4&         projection
+                                                 , float                  viewport_height) noexcept
+    {
+        const auto sphere = frustum_culler::transform(bounds, world);
+
+        if (level_count <= 1 || sphere.radius <= 0.0f)
+        {
+            return 0;
+        }
+
+        // Row vector convention, the view looks down the negative z axis
+        const auto& c        = sphere.center;
+        const auto  distance = -(c.x * view[0][2] + c.y * view[1][2] + c.z * view[2][2] + view[3][2]);
+
+        if (distance <= sphere.radius)
+        {
+            return 0;
+        }
+
+        // Projected diameter, in pixels, of the bounds; the texture is assumed to span it once
+        const auto diameter = sphere.radius * projection[1][1] * viewport_height / distance;
+        const auto extent   = static_cast<float>(size);
+
+        if (diameter >= extent)
+        {
+            return 0;
+        }
+
+        const auto level = static_cast<std::uint32_t>(std::floor(std::log2(extent / std::max(diameter, 1.0f))));
+
+        return std::min(level, level_count - 1);
+    }
+
+    void texture_streamer::retire(std::uint32_t image) noexcept
+    {
+        // Once every swap chain image has been acquired again, no submission or descriptor set uses the replaced image
+        auto it = std::remove_if(_retired.begin(), _retired.end(), [&] (auto& retired) -> bool
+        {
+            retired.referenced[image] = false;
+
+            if (std::find(retired.referenced.begin(), retired.referenced.end(), true) != retired.referenced.end())
+            {
+                return false;
+            }
+
+            _device->_logical_device->destroy(retired.texture);
+
+            return true;
+        });
+
+        _retired.erase(it, _retired.end());
+    }
+
+    std::uint64_t texture_streamer::effective_budget() const noexcept
+    {
+        const auto budget = _device->_logical_device->memory_budget();
+
+        return (_budget != 0) ? std::min(_budget, budget) : budget;
+    }
+
+    void texture_streamer::schedule(entry& entry, const std::shared_ptr<texture2d>& texture, std::uint32_t level) noexcept
+    {
+        entry.in_flight = true;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            _jobs.push_back({ texture, texture->_surface, level });
+        }
+
+        _condition.notify_one();
+    }
+
+    void texture_streamer::run() noexcept
+    {
+        for (;;)
+        {
+            job next;
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+
+                _condition.wait(lock, [&] { return _stop || !_jobs.empty(); });
+
+                if (_stop)
+                {
+                    return;
+                }
+
+                next = std::move(_jobs.front());
+
+                _jobs.pop_front();
+            }
+
+            // Decoded mipmaps are copied into host visible memory off the render thread
+            auto staging = _device->_logical_device->create_staging_texture(next.surface.get(), next.level);
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                _completed.push_back({ next.texture, std::move(staging) });
+            }
+        }
+    }
+
+    std::uint64_t texture_streamer::chain_size(const surface& surface, std::uint32_t level) noexcept
+    {
+        const auto& mipmaps = surface.mipmaps();
+        std::uint64_t size  = 0;
+
+        for (auto i = level; i < mipmaps.size(); ++i)
+        {
+            size += mipmaps[i].view().size();
+        }
+
+        return size * surface.layer_count();
+    }
+}
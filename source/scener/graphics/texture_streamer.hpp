@@ -0,0 +1,152 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_TEXTURE_STREAMER_HPP
+#define SCENER_GRAPHICS_TEXTURE_STREAMER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "scener/content/dds/surface.hpp"
+#include "scener/graphics/vulkan/staging_texture.hpp"
+#include "scener/graphics/vulkan/texture_object.hpp"
+#include "scener/math/bounding_sphere.hpp"
+#include "scener/math/matrix.hpp"
+
+namespace scener::graphics
+{
+    class effect_technique;
+    class graphics_device;
+    class texture2d;
+
+    /// Streams texture mipmaps in and out of device memory. Textures are loaded with their low resolution mipmaps
+    /// only; higher resolution ones are staged on a background thread as the textures grow on screen, and the least
+    /// recently used textures are dropped back to their initial resolution when the device memory budget is exceeded.
+    /// Swapped textures are rebound one swap chain image at a time, once the image is acquired, and the replaced
+    /// images are destroyed when no swap chain image references them anymore.
+    class texture_streamer final
+    {
+    public:
+        /// Initializes a new instance of the texture_streamer class.
+        /// \param device the graphics device associated with this streamer.
+        /// \param budget the amount, in bytes, of device local memory textures can use; zero to use the driver budget.
+        /// \param initial_size the size, in pixels, of the largest mipmap uploaded when a texture is loaded.
+        texture_streamer(gsl::not_null<graphics_device*> device, std::uint64_t budget, std::uint32_t initial_size) noexcept;
+
+        /// Releases all resources being used by this texture_streamer.
+        ~texture_streamer();
+
+    public:
+        /// Gets the index of the first mipmap uploaded when a texture is loaded.
+        /// \param surface the texture data.
+        /// \returns the index of the largest mipmap not bigger than the initial streaming size.
+        std::uint32_t initial_level(const content::dds::surface& surface) const noexcept;
+
+        /// Gets the index of the first mipmap uploaded when a texture is loaded.
+        /// \param surface the texture data.
+        /// \param initial_size the size, in pixels, of the largest mipmap uploaded when a texture is loaded.
+        /// \returns the index of the largest mipmap not bigger than the given size; the smallest mipmap when none is.
+        static std::uint32_t initial_level(const content::dds::surface& surface, std::uint32_t initial_size) noexcept;
+
+        /// Gets the most detailed mipmap a texture needs, from the size the given bounds span on screen.
+        /// \param size the size, in pixels, of the largest texture dimension.
+        /// \param level_count the number of mipmaps of the texture.
+        /// \param bounds the object space bounds of the geometry drawn with the texture.
+        /// \param world the world matrix of the geometry.
+        /// \param view the view matrix.
+        /// \param projection the projection matrix.
+        /// \param viewport_height the height, in pixels, of the viewport.
+        /// \returns the index of the mipmap whose size matches the projected diameter of the bounds.
+        static std::uint32_t required_level(std::uint32_t                size
+                                          , std::uint32_t                level_count
+                                          , const math::bounding_sphere& bounds
+                                          , const math::matrix4&         world
+                                          , const math::matrix4&         view
+                                          , const math::matrix4&         projection
+                                          , float                        viewport_height) noexcept;
+
+        /// Starts streaming the textures of the given technique.
+        /// \param technique the effect technique whose descriptors reference the textures.
+        void track(const std::shared_ptr<effect_technique>& technique) noexcept;
+
+        /// Requests the mipmaps the technique textures need to be drawn with the given bounds, from the technique
+        /// world, view and projection matrices.
+        /// \param technique the effect technique.
+        /// \param bounds the object space bounds of the geometry drawn with the technique.
+        void request(const effect_technique& technique, const math::bounding_sphere& bounds) noexcept;
+
+        /// Applies the uploads staged by the background thread, evicts textures over budget and schedules the
+        /// requested mipmaps. Called once per frame, before drawing, with the acquired swap chain image.
+        /// \param image the index of the acquired swap chain image, whose previous submission has completed.
+        /// \returns true if the descriptor sets of the given image have been rewritten and its command buffer needs to
+        ///          be recorded again; textures in the texture table are swapped without recording.
+        bool update(std::uint32_t image) noexcept;
+
+    private:
+        struct entry
+        {
+            std::weak_ptr<texture2d>                     texture;
+            std::vector<std::weak_ptr<effect_technique>> techniques;
+            std::uint32_t                                initial_level;
+            std::uint32_t                                requested_level;
+            std::uint64_t                                last_used_frame;
+            bool                                         in_flight;
+        };
+
+        struct job
+        {
+            std::weak_ptr<texture2d>               texture;
+            std::shared_ptr<content::dds::surface> surface;
+            std::uint32_t                          level;
+        };
+
+        struct completed_job
+        {
+            std::weak_ptr<texture2d> texture;
+            vulkan::staging_texture  staging;
+        };
+
+        struct retired_texture
+        {
+            vulkan::texture_object texture;
+            std::vector<bool>      referenced;
+        };
+
+    private:
+        void retire(std::uint32_t image) noexcept;
+
+        std::uint64_t effective_budget() const noexcept;
+
+        void schedule(entry& entry, const std::shared_ptr<texture2d>& texture, std::uint32_t level) noexcept;
+
+        void run() noexcept;
+
+        static std::uint64_t chain_size(const content::dds::surface& surface, std::uint32_t level) noexcept;
+
+    private:
+        graphics_device*                                          _device;
+        std::uint64_t                                             _budget;
+        std::uint32_t                                             _initial_size;
+        std::uint64_t                                             _frame;
+        std::unordered_map<texture2d*, entry>                     _entries;
+        std::deque<job>                                           _jobs;
+        std::vector<completed_job>                                _completed;
+        std::vector<retired_texture>                              _retired;
+        std::vector<std::vector<std::weak_ptr<effect_technique>>> _stale_descriptors;
+        std::mutex                                                _mutex;
+        std::condition_variable                                   _condition;
+        bool                                                      _stop;
+        std::thread                                               _worker;
+    };
+}
+
+#endif // SCENER_GRAPHICS_TEXTURE_STREAMER_HPP
@@ -0,0 +1,81 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/texture_table.hpp"
+
+#include "scener/graphics/graphics_device.hpp"
+#include "scener/graphics/texture2d.hpp"
+
+namespace scener::graphics
+{
+    texture_table::texture_table(gsl::not_null<graphics_device*> device, std::uint32_t capacity) noexcept
+        : graphics_resource { device }
+        , _count            { 0 }
+        , _next             { 0 }
+        , _free             { }
+        , _table            { device->_logical_device->create_texture_descriptor_table(capacity) }
+    {
+        Expects(capacity > 0);
+    }
+
+    texture_table::~texture_table()
+    {
+        if (_graphics_device != nullptr)
+        {
+            _graphics_device->_logical_device->destroy(_table);
+        }
+
+        _graphics_device = nullptr;
+    }
+
+    std::uint32_t texture_table::capacity() const noexcept
+    {
+        return _table.capacity;
+    }
+
+    std::uint32_t texture_table::count() const noexcept
+    {
+        return _count;
+    }
+
+    std::uint32_t texture_table::add(const texture2d& texture) noexcept
+    {
+        auto index = _next;
+
+        if (!_free.empty())
+        {
+            index = _free.back();
+
+            _free.pop_back();
+        }
+        else
+        {
+            Expects(_next < _table.capacity);
+
+            _next++;
+        }
+
+        _count++;
+
+        update(index, texture);
+
+        return index;
+    }
+
+    void texture_table::update(std::uint32_t index, const texture2d& texture) noexcept
+    {
+        Expects(index < _next);
+
+        // The table is update after bind, unused entries can be rewritten while recorded command buffers are pending
+        _graphics_device->_logical_device->write_texture_descriptor(_table, index, texture._texture_object);
+    }
+
+    void texture_table::remove(std::uint32_t index) noexcept
+    {
+        Expects(index < _next && _count > 0);
+
+        // The stale descriptor is left in place, the table is partially bound
+        _free.push_back(index);
+        _count--;
+    }
+}
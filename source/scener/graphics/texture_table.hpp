@@ -0,0 +1,79 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_TEXTURE_TABLE_HPP
+#define SCENER_GRAPHICS_TEXTURE_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "scener/graphics/graphics_resource.hpp"
+#include "scener/graphics/vulkan/texture_descriptor_table.hpp"
+
+namespace scener::graphics::vulkan { class logical_device; }
+
+namespace scener::graphics
+{
+    class graphics_device;
+    class texture2d;
+
+    /// Represents the bindless texture table, a single descriptor array holding every loaded texture. Pipelines
+    /// compiled for the table bind it once, and materials reference their textures by table index instead of owning
+    /// a combined image sampler binding per texture; draws with different materials then share the same descriptor
+    /// state. Requires descriptor indexing support.
+    class texture_table final : public graphics_resource
+    {
+    public:
+        /// The maximum number of textures a single material can reference through the table.
+        static constexpr std::uint32_t max_material_textures = 8;
+
+        /// The index of a texture not registered in the table.
+        static constexpr std::uint32_t invalid_index = std::numeric_limits<std::uint32_t>::max();
+
+    public:
+        /// Initializes a new instance of the texture_table class.
+        /// \param device the graphics device associated with this texture table.
+        /// \param capacity the maximum number of textures the table can hold.
+        texture_table(gsl::not_null<graphics_device*> device, std::uint32_t capacity) noexcept;
+
+        /// Releases all resources being used by this texture_table.
+        ~texture_table() override;
+
+    public:
+        /// Gets the maximum number of textures the table can hold.
+        /// \returns the maximum number of textures the table can hold.
+        std::uint32_t capacity() const noexcept;
+
+        /// Gets the number of textures registered in the table.
+        /// \returns the number of textures registered in the table.
+        std::uint32_t count() const noexcept;
+
+        /// Registers a texture in the table.
+        /// \param texture the texture to register.
+        /// \returns the index of the texture in the table.
+        std::uint32_t add(const texture2d& texture) noexcept;
+
+        /// Rewrites the descriptor of a registered texture, after its image has been replaced.
+        /// \param index the index of the texture, as returned by add.
+        /// \param texture the texture.
+        void update(std::uint32_t index, const texture2d& texture) noexcept;
+
+        /// Releases the table entry of a texture; the index is reused by the next registered texture.
+        /// \param index the index of the texture, as returned by add.
+        void remove(std::uint32_t index) noexcept;
+
+    private:
+        std::uint32_t                    _count;
+        std::uint32_t                    _next;
+        std::vector<std::uint32_t>       _free;
+        vulkan::texture_descriptor_table _table;
+
+        friend class scener::graphics::vulkan::logical_device;
+    };
+}
+
+#endif // SCENER_GRAPHICS_TEXTURE_TABLE_HPP
@@ -3,11 +3,42 @@
 
 #include "scener/graphics/vertex_declaration.hpp"
 
+#include "scener/math/matrix.hpp"
+
 namespace scener::graphics
 {
+    using scener::math::matrix4;
+    using scener::math::vector4;
+
+    const vertex_declaration& vertex_declaration::instance_transform() noexcept
+    {
+        constexpr auto usage    = vertex_element_usage::instance_transform;
+        constexpr auto location = instance_transform_location;
+
+        // A matrix4 attribute is fed to the vertex shader as four consecutive vector4 locations.
+        static const vertex_declaration declaration {
+            sizeof(matrix4)
+          , { { 0                  , vertex_element_format::vector4, usage, location     }
+            , { sizeof(vector4)    , vertex_element_format::vector4, usage, location + 1 }
+            , { sizeof(vector4) * 2, vertex_element_format::vector4, usage, location + 2 }
+            , { sizeof(vector4) * 3, vertex_element_format::vector4, usage, location + 3 } }
+          , vertex_input_rate::instance
+        };
+
+        return declaration;
+    }
+
     vertex_declaration::vertex_declaration(std::uint32_t stride, const std::vector<vertex_element>& elements) noexcept
+        : vertex_declaration { stride, elements, vertex_input_rate::vertex }
+    {
+    }
+
+    vertex_declaration::vertex_declaration(std::uint32_t                      stride
+                                         , const std::vector<vertex_element>& elements
+                                         , vertex_input_rate                  input_rate) noexcept
         : _vertex_stride   { stride }
         , _vertex_elements { elements }
+        , _input_rate      { input_rate }
     {
     }
 
@@ -20,4 +51,9 @@ namespace scener::graphics
     {
         return _vertex_elements;
     }
+
+    vertex_input_rate vertex_declaration::input_rate() const noexcept
+    {
+        return _input_rate;
+    }
 }
@@ -8,18 +8,37 @@
 #include <vector>
 
 #include "scener/graphics/vertex_element.hpp"
+#include "scener/graphics/vertex_input_rate.hpp"
 
 namespace scener::graphics
 {
-    /// A vertex declaration, which defines per-vertex data.
+    /// A vertex declaration, which defines per-vertex or per-instance data.
     struct vertex_declaration final
     {
+    public:
+        /// The first of the four consecutive shader locations holding the per-instance world transform; the
+        /// transform fills the last four of the sixteen vertex attribute locations every device supports.
+        static constexpr std::uint32_t instance_transform_location = 12;
+
+    public:
+        /// Gets the declaration of the per-instance world transform stream used for instanced drawing.
+        /// \returns the declaration of the per-instance world transform stream.
+        static const vertex_declaration& instance_transform() noexcept;
+
     public:
         /// Initializes a new instance of the VertexDeclaration class.
         /// \param stride The number of bytes per element.
         /// \param elements vertex elements.
         vertex_declaration(std::uint32_t stride, const std::vector<vertex_element>& elements) noexcept;
 
+        /// Initializes a new instance of the VertexDeclaration class.
+        /// \param stride The number of bytes per element.
+        /// \param elements vertex elements.
+        /// \param input_rate the rate at which the elements are pulled from the stream.
+        vertex_declaration(std::uint32_t                      stride
+                         , const std::vector<vertex_element>& elements
+                         , vertex_input_rate                  input_rate) noexcept;
+
     public:
         /// Gets the number of bytes from one vertex to the next.
         /// \returns the stride (in bytes).
@@ -29,9 +48,14 @@ namespace scener::graphics
         /// \returns the vertex elements that make up the vertex shader declaration.
         const std::vector<vertex_element>& vertex_elements() const noexcept;
 
+        /// Gets the rate at which the vertex elements are pulled from the stream.
+        /// \returns the rate at which the vertex elements are pulled from the stream.
+        vertex_input_rate input_rate() const noexcept;
+
     private:
         std::uint32_t               _vertex_stride;
         std::vector<vertex_element> _vertex_elements;
+        vertex_input_rate           _input_rate;
     };
 }
 
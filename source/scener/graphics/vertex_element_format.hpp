@@ -24,6 +24,9 @@ namespace scener::graphics
       , normalized_short4 = 9   ///< Normalized, four-component, signed short, expanded to (first short/32767.0, second short/32767.0, third short/32767.0, fourth short/32767.0).
       , half_vector2      = 10  ///< Two-component, 16-bit floating point expanded to (value, value, value, value).
       , half_vector4      = 11  ///< Four-component, 16-bit floating-point expanded to (value, value, value, value).
+      , normalized_byte4  = 12  ///< Normalized, four-component, signed byte, expanded to (first byte/127.0, second byte/127.0, third byte/127.0, fourth byte/127.0).
+      , normalized_packed = 13  ///< Normalized, packed 10-10-10-2 bits signed components, expanded to (x/511.0, y/511.0, z/511.0, w).
+      , ushort4           = 14  ///< Four-component, unsigned short expanded to (value, value, value, value).
     };
 }
 
@@ -24,6 +24,7 @@ namespace scener::graphics
       , point_size         = 10 ///< Point size data.
       , sample             = 11 ///< Vertex data contains sampler data.
       , tessellate_factor  = 12 ///< Single, positive floating-point value.
+      , instance_transform = 13 ///< Per-instance world transform data (consumes four locations, starting at location 12).
     };
 }
 
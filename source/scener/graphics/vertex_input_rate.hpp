@@ -0,0 +1,19 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_VERTEX_INPUT_RATE_HPP
+#define SCENER_GRAPHICS_VERTEX_INPUT_RATE_HPP
+
+#include <cstdint>
+
+namespace scener::graphics
+{
+    /// Defines the rate at which vertex attributes are pulled from a vertex stream.
+    enum class vertex_input_rate : std::uint32_t
+    {
+        vertex   = 0 ///< Vertex attribute addressing is a function of the vertex index.
+      , instance = 1 ///< Vertex attribute addressing is a function of the instance index.
+    };
+}
+
+#endif // SCENER_GRAPHICS_VERTEX_INPUT_RATE_HPP
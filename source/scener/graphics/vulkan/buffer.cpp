@@ -7,15 +7,28 @@
 #include <any>
 #include <algorithm>
 
+#include "scener/diagnostics/profiler.hpp"
+
 namespace scener::graphics::vulkan
 {
     buffer::buffer(buffer_usage usage, vk::SharingMode sharing_mode, std::uint64_t count, VmaAllocator* allocator) noexcept
+        : buffer { usage, sharing_mode, count, 1, allocator }
+    {
+    }
+
+    buffer::buffer(buffer_usage    usage
+                 , vk::SharingMode sharing_mode
+                 , std::uint64_t   count
+                 , std::uint32_t   copies
+                 , VmaAllocator*   allocator) noexcept
         : _usage     { usage }
         , _size      { count }
         , _buffers   { }
         , _allocator { allocator }
     {
-        std::uint32_t buffer_count = 1;
+        Expects(copies > 0);
+
+        const std::uint32_t buffer_count = copies;
 
         VkBufferCreateInfo buffer_create_info = { };
 
@@ -33,14 +46,29 @@ namespace scener::graphics::vulkan
         }
         else if ((usage & buffer_usage::vertex_buffer) == buffer_usage::vertex_buffer)
         {
-            allocation_create_info.usage         = VMA_MEMORY_USAGE_GPU_ONLY;
-            allocation_create_info.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            if ((usage & buffer_usage::transfer_destination) == buffer_usage::transfer_destination)
+            {
+                allocation_create_info.usage         = VMA_MEMORY_USAGE_GPU_ONLY;
+                allocation_create_info.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            }
+            else
+            {
+                // Dynamic vertex streams (per-instance data) are written by the host every frame
+                allocation_create_info.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+                allocation_create_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+            }
         }
         else if ((usage & buffer_usage::uniform_buffer) == buffer_usage::uniform_buffer)
         {
             allocation_create_info.usage = VMA_MEMORY_USAGE_CPU_ONLY;
             allocation_create_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
         }
+        else if ((usage & buffer_usage::storage_buffer) == buffer_usage::storage_buffer)
+        {
+            // Bone palettes are written by the host every frame
+            allocation_create_info.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+            allocation_create_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        }
 
         _buffers.resize(buffer_count);
 
@@ -79,6 +107,11 @@ namespace scener::graphics::vulkan
         return _size;
     }
 
+    std::uint32_t buffer::copies() const noexcept
+    {
+        return static_cast<std::uint32_t>(_buffers.size());
+    }
+
     /// Gets the buffer usage.
     buffer_usage buffer::usage() const noexcept
     {
@@ -109,6 +142,25 @@ namespace scener::graphics::vulkan
 
              // Buffer is already mapped (VMA_ALLOCATION_CREATE_MAPPED_BIT)
              memcpy(mapped_data, data, count);
+
+             // CPU_TO_GPU memory is not guaranteed to be host coherent; a no-op when it is
+             vmaFlushAllocation(*_allocator, _buffers[i].memory_buffer_allocation, offset, count);
         }
+
+        diagnostics::profiler::add_uploaded_bytes(count * _buffers.size());
+    }
+
+    void buffer::set_data(std::uint32_t copy, std::uint64_t offset, std::uint64_t count, gsl::not_null<const void*> data) const noexcept
+    {
+        Ensures(copy < _buffers.size());
+        Ensures(offset + count <= _size);
+
+        auto mapped_data = reinterpret_cast<char*>(_buffers[copy].memory_buffer_allocation_info.pMappedData) + offset;
+
+        memcpy(mapped_data, data, count);
+
+        vmaFlushAllocation(*_allocator, _buffers[copy].memory_buffer_allocation, offset, count);
+
+        diagnostics::profiler::add_uploaded_bytes(count);
     }
 }
@@ -30,6 +30,17 @@ namespace scener::graphics::vulkan
         /// \param buffer the vulkan buffer.
         buffer(buffer_usage usage, vk::SharingMode sharing_mode, std::uint64_t count, VmaAllocator* allocator) noexcept;
 
+        /// Initializes a new instance of the Buffer class with several copies of the data store, so the host can
+        /// write one copy while the device still reads the others.
+        /// \param usage the buffer usage.
+        /// \param size the buffer size.
+        /// \param copies the number of copies of the data store.
+        buffer(buffer_usage       usage
+             , vk::SharingMode    sharing_mode
+             , std::uint64_t      count
+             , std::uint32_t      copies
+             , VmaAllocator*      allocator) noexcept;
+
         ~buffer();
 
     public:
@@ -37,6 +48,9 @@ namespace scener::graphics::vulkan
 
         std::uint64_t size() const noexcept;
 
+        /// Gets the number of copies of the data store.
+        std::uint32_t copies() const noexcept;
+
         /// Gets the buffer usage.
         buffer_usage usage() const noexcept;
 
@@ -51,6 +65,13 @@ namespace scener::graphics::vulkan
                     , [[maybe_unused]] std::uint64_t count
                     , [[maybe_unused]] gsl::not_null<const void*> data) const noexcept;
 
+        /// Replaces the data of a single copy of the data store.
+        /// \param copy the copy of the data store to write.
+        /// \param offset specifies the offset into the copy where data replacement will begin, measured in bytes.
+        /// \param count specifies the size in bytes of the data being replaced.
+        /// \param data specifies a pointer to the new data.
+        void set_data(std::uint32_t copy, std::uint64_t offset, std::uint64_t count, gsl::not_null<const void*> data) const noexcept;
+
     private:
         buffer_usage                  _usage;
         std::uint64_t                 _size;
@@ -0,0 +1,25 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_VULKAN_CACHED_PIPELINE_HPP
+#define SCENER_GRAPHICS_VULKAN_CACHED_PIPELINE_HPP
+
+#include <vulkan/vulkan.hpp>
+
+namespace scener::graphics::vulkan
+{
+    /// A pipeline shared by every mesh part created with the same pipeline key; each mesh part keeps its own
+    /// descriptor sets, allocated with the shared descriptor set layout.
+    struct cached_pipeline
+    {
+    public:
+        /// The pipeline object.
+        vk::Pipeline            pipeline              { };
+        /// The pipeline layout.
+        vk::PipelineLayout      pipeline_layout       { };
+        /// The layout of the per mesh part descriptor sets.
+        vk::DescriptorSetLayout descriptor_set_layout { };
+    };
+}
+
+#endif // SCENER_GRAPHICS_VULKAN_CACHED_PIPELINE_HPP
@@ -0,0 +1,24 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_VULKAN_CACHED_SAMPLER_HPP
+#define SCENER_GRAPHICS_VULKAN_CACHED_SAMPLER_HPP
+
+#include <cstdint>
+
+#include <vulkan/vulkan.hpp>
+
+namespace scener::graphics::vulkan
+{
+    /// A sampler shared by every texture created with the same sampler state.
+    struct cached_sampler
+    {
+    public:
+        /// The sampler object.
+        vk::Sampler   sampler    { };
+        /// The number of textures using the sampler, it is destroyed when it drops to zero.
+        std::uint32_t references { 0 };
+    };
+}
+
+#endif // SCENER_GRAPHICS_VULKAN_CACHED_SAMPLER_HPP
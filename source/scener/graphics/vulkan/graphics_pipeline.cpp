@@ -8,6 +8,8 @@ namespace scener::graphics::vulkan
         , _descriptor_pool       { }
         , _descriptor_set_layout { }
         , _descriptors           { }
+        , _texture_table         { }
+        , _blended               { false }
     {
     }
 
@@ -15,12 +17,16 @@ namespace scener::graphics::vulkan
                                        , const vk::PipelineLayout&             pipeline_layout
                                        , const vk::DescriptorPool&             descriptor_pool
                                        , const vk::DescriptorSetLayout&        descriptor_set_layout
-                                       , const std::vector<vk::DescriptorSet>& descriptors) noexcept
+                                       , const std::vector<vk::DescriptorSet>& descriptors
+                                       , const vk::DescriptorSet&              texture_table
+                                       , bool                                  blended) noexcept
         : _pipeline              { pipeline }
         , _pipeline_layout       { pipeline_layout }
         , _descriptor_pool       { descriptor_pool }
         , _descriptor_set_layout { descriptor_set_layout }
         , _descriptors           { descriptors }
+        , _texture_table         { texture_table }
+        , _blended               { blended }
     {
     }
 
@@ -38,4 +44,14 @@ namespace scener::graphics::vulkan
     {
         return _descriptors;
     }
+
+    bool graphics_pipeline::uses_texture_table() const noexcept
+    {
+        return static_cast<bool>(_texture_table);
+    }
+
+    bool graphics_pipeline::blended() const noexcept
+    {
+        return _blended;
+    }
 }
@@ -20,19 +20,30 @@ namespace scener::graphics::vulkan
                         , const vk::PipelineLayout&             pipeline_layout
                         , const vk::DescriptorPool&             descriptor_pool
                         , const vk::DescriptorSetLayout&        descriptor_set_layout
-                        , const std::vector<vk::DescriptorSet>& descriptors) noexcept;
+                        , const std::vector<vk::DescriptorSet>& descriptors
+                        , const vk::DescriptorSet&              texture_table
+                        , bool                                  blended) noexcept;
 
     public:
         const vk::Pipeline& pipeline() const noexcept;
         const vk::PipelineLayout& pipeline_layout() const noexcept;
         const std::vector<vk::DescriptorSet>& descriptors() const noexcept;
 
+        /// Gets a value indicating whether the pipeline samples its textures from the bindless texture table,
+        /// bound as set 1, using the texture indices pushed per draw.
+        bool uses_texture_table() const noexcept;
+
+        /// Gets a value indicating whether the pipeline blends its output with the render target contents.
+        bool blended() const noexcept;
+
     private:        
         vk::Pipeline                   _pipeline;
         vk::PipelineLayout             _pipeline_layout;
         vk::DescriptorPool             _descriptor_pool;
         vk::DescriptorSetLayout        _descriptor_set_layout;
         std::vector<vk::DescriptorSet> _descriptors;
+        vk::DescriptorSet              _texture_table;
+        bool                           _blended;
 
         friend class scener::graphics::vulkan::logical_device;
     };
@@ -4,15 +4,21 @@
 
 #include "scener/graphics/vulkan/logical_device.hpp"
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <gsl/gsl>
 
+#include "scener/diagnostics/profiler.hpp"
+#include "scener/graphics/bone_palette.hpp"
 #include "scener/graphics/constant_buffer.hpp"
 #include "scener/graphics/effect_pass.hpp"
 #include "scener/graphics/effect_technique.hpp"
 #include "scener/graphics/index_buffer.hpp"
 #include "scener/graphics/texture2d.hpp"
+#include "scener/graphics/texture_table.hpp"
 #include "scener/graphics/vertex_buffer.hpp"
+#include "scener/graphics/vertex_declaration.hpp"
 #include "scener/graphics/vulkan/shader.hpp"
 #include "scener/graphics/vulkan/shader_module.hpp"
 #include "scener/graphics/vulkan/shader_stage.hpp"
@@ -21,6 +27,7 @@
 
 namespace scener::graphics::vulkan
 {
+    using scener::diagnostics::profiler;
     using scener::graphics::vertex_element_format;
     using scener::graphics::viewport;
     using scener::math::basic_color;
@@ -64,13 +71,13 @@ namespace scener::graphics::vulkan
         case scener::graphics::vertex_element_format::vector4:
             return vk::Format::eR32G32B32A32Sfloat;
         case scener::graphics::vertex_element_format::color:
-            return vk::Format::eR32G32B32A32Sfloat;
+            return vk::Format::eR8G8B8A8Unorm;
         case scener::graphics::vertex_element_format::byte4:
-            return vk::Format::eR8Srgb;
+            return vk::Format::eR8G8B8A8Uscaled;
         case scener::graphics::vertex_element_format::short2:
-            return vk::Format::eR16G16Sint;
+            return vk::Format::eR16G16Sscaled;
         case scener::graphics::vertex_element_format::short4:
-            return vk::Format::eR16G16B16A16Sint;
+            return vk::Format::eR16G16B16A16Sscaled;
         case scener::graphics::vertex_element_format::normalized_short2:
             return vk::Format::eR16G16Snorm;
         case scener::graphics::vertex_element_format::normalized_short4:
@@ -79,6 +86,12 @@ namespace scener::graphics::vulkan
             return vk::Format::eR16G16Sfloat;
         case scener::graphics::vertex_element_format::half_vector4:
             return vk::Format::eR16G16B16A16Sfloat;
+        case scener::graphics::vertex_element_format::normalized_byte4:
+            return vk::Format::eR8G8B8A8Snorm;
+        case scener::graphics::vertex_element_format::normalized_packed:
+            return vk::Format::eA2B10G10R10SnormPack32;
+        case scener::graphics::vertex_element_format::ushort4:
+            return vk::Format::eR16G16B16A16Uscaled;
         }
     }
 
@@ -87,7 +100,9 @@ namespace scener::graphics::vulkan
         switch (format)
         {
         case scener::graphics::surface_format::color:
-            return vk::Format::eR8Srgb;
+            return vk::Format::eR8G8B8A8Unorm;
+        case scener::graphics::surface_format::color_srgb:
+            return vk::Format::eR8G8B8A8Srgb;
         case scener::graphics::surface_format::bgr565:
             return vk::Format::eR5G6B5UnormPack16;
         case scener::graphics::surface_format::bgra5551:
@@ -95,10 +110,16 @@ namespace scener::graphics::vulkan
         case scener::graphics::surface_format::bgra4444:
             return vk::Format::eR4G4B4A4UnormPack16;
         case scener::graphics::surface_format::dxt1:
-            return vk::Format::eBc1RgbaSrgbBlock;
+            return vk::Format::eBc1RgbaUnormBlock;
         case scener::graphics::surface_format::dxt3:
-            return vk::Format::eBc3SrgbBlock;
+            return vk::Format::eBc2UnormBlock;
         case scener::graphics::surface_format::dxt5:
+            return vk::Format::eBc3UnormBlock;
+        case scener::graphics::surface_format::dxt1_srgb:
+            return vk::Format::eBc1RgbaSrgbBlock;
+        case scener::graphics::surface_format::dxt3_srgb:
+            return vk::Format::eBc2SrgbBlock;
+        case scener::graphics::surface_format::dxt5_srgb:
             return vk::Format::eBc3SrgbBlock;
         case scener::graphics::surface_format::normalized_byte2:
             return vk::Format::eR8G8Snorm;
@@ -110,6 +131,24 @@ namespace scener::graphics::vulkan
             return vk::Format::eR16G16B16A16Uint;
         case scener::graphics::surface_format::rgba1010102:
             return vk::Format::eA2R10G10B10UnormPack32;
+        case scener::graphics::surface_format::bgra32:
+            return vk::Format::eB8G8R8A8Unorm;
+        case scener::graphics::surface_format::bgra32_srgb:
+            return vk::Format::eB8G8R8A8Srgb;
+        case scener::graphics::surface_format::half_vector4:
+            return vk::Format::eR16G16B16A16Sfloat;
+        case scener::graphics::surface_format::bc4:
+            return vk::Format::eBc4UnormBlock;
+        case scener::graphics::surface_format::bc5:
+            return vk::Format::eBc5UnormBlock;
+        case scener::graphics::surface_format::bc6h:
+            return vk::Format::eBc6HUfloatBlock;
+        case scener::graphics::surface_format::bc6h_signed:
+            return vk::Format::eBc6HSfloatBlock;
+        case scener::graphics::surface_format::bc7:
+            return vk::Format::eBc7UnormBlock;
+        case scener::graphics::surface_format::bc7_srgb:
+            return vk::Format::eBc7SrgbBlock;
         }
     }
 
@@ -140,32 +179,38 @@ namespace scener::graphics::vulkan
                                  , const viewport&                   viewport
                                  , std::uint32_t                     graphics_queue_family_index
                                  , std::uint32_t                     present_queue_family_index
+                                 , std::uint32_t                     transfer_queue_family_index
                                  , const vk::SurfaceCapabilitiesKHR& surface_capabilities
                                  , const vk::SurfaceFormatKHR&       surface_format
                                  , const vk::Format&                 depth_format
                                  , const vk::PresentModeKHR&         present_mode
-                                 , const vk::FormatProperties&       format_properties) noexcept
-        : _logical_device                   { logical_device }
+                                 , const vk::FormatProperties&       format_properties
+                                 , bool                              descriptor_indexing) noexcept
+        : _physical_device                  { physical_device }
+        , _logical_device                   { logical_device }
         , _viewport                         { }
         , _graphics_queue_family_index      { graphics_queue_family_index }
         , _graphics_queue                   { }
         , _present_queue_family_index       { present_queue_family_index }
         , _present_queue                    { }
+        , _transfer_queue_family_index      { transfer_queue_family_index }
+        , _transfer_queue                   { }
         , _surface_capabilities             { surface_capabilities }
         , _surface_format                   { surface_format }
         , _present_mode                     { present_mode }
         , _format_properties                { format_properties }
         , _command_pool                     { }
         , _single_time_command_pool         { }
+        , _transfer_command_pool            { }
         , _swap_chain                       { }
         , _render_pass                      { }
         , _swap_chain_images                { }
         , _swap_chain_image_views           { }
         , _frame_buffers                    { }
         , _command_buffers                  { }
-        , _single_time_command_buffer       { }
+        , _pending_uploads                  { }
         , _fences                           { }
-        , _single_time_command_fence        { }
+        , _image_fences                     { }
         , _image_acquired_semaphores        { }
         , _draw_complete_semaphores         { }
         , _image_ownership_semaphores       { }
@@ -174,6 +219,16 @@ namespace scener::graphics::vulkan
         , _depth_buffer                     { }
         , _pipeline_cache                   { }
         , _allocator                        { }
+        , _timestamp_query_pool             { }
+        , _timestamp_period                 { physical_device.getProperties().limits.timestampPeriod }
+        , _timestamps_supported             { physical_device.getProperties().limits.timestampComputeAndGraphics == VK_TRUE }
+        , _submit_times                     { }
+        , _descriptor_indexing              { descriptor_indexing }
+        , _sampler_mutex                    { }
+        , _samplers                         { }
+        , _sampler_states                   { }
+        , _pipeline_mutex                   { }
+        , _pipelines                        { }
     {
         create_viewport(viewport);
         create_allocator(instance, physical_device, logical_device);
@@ -185,6 +240,9 @@ namespace scener::graphics::vulkan
 
     logical_device::~logical_device() noexcept
     {
+        // Uploads still in flight
+        retire_uploads(true);
+
         // Command buffers
         destroy_command_buffers();
 
@@ -194,6 +252,12 @@ namespace scener::graphics::vulkan
         // Swapchain
         destroy_swap_chain();
 
+        // Samplers
+        destroy_samplers();
+
+        // Pipelines
+        destroy_pipelines();
+
         // Memory allocators
         vmaDestroyAllocator(_allocator);
 
@@ -211,7 +275,22 @@ namespace scener::graphics::vulkan
         return _present_queue;
     }
 
-    void logical_device::draw(const render_surface& surface) noexcept
+    const vk::Queue& logical_device::transfer_queue() const noexcept
+    {
+        return _transfer_queue;
+    }
+
+    bool logical_device::supports_descriptor_indexing() const noexcept
+    {
+        return _descriptor_indexing;
+    }
+
+    std::uint32_t logical_device::image_count() const noexcept
+    {
+        return static_cast<std::uint32_t>(_swap_chain_images.size());
+    }
+
+    std::uint32_t logical_device::acquire_next_image(const render_surface& surface) noexcept
     {
         std::uint32_t current_buffer = 0;
 
@@ -235,6 +314,30 @@ namespace scener::graphics::vulkan
             }
         } while (result != vk::Result::eSuccess);
 
+        // An image can be acquired before the previous submission rendering to it has completed; its command buffer
+        // and per image resources are only reused once that submission has finished
+        const auto image_fence = _image_fences[current_buffer];
+
+        if (image_fence && image_fence != _fences[_frame_index])
+        {
+            check_result(_logical_device.waitForFences(1, &image_fence, VK_TRUE, std::numeric_limits<std::uint64_t>().max()));
+        }
+
+        _image_fences[current_buffer] = _fences[_frame_index];
+
+        // Render pass timings of the previous submission of this command buffer
+        read_timestamp_queries(current_buffer);
+
+        // Release the staging memory of the uploads already completed
+        retire_uploads(false);
+
+        return current_buffer;
+    }
+
+    void logical_device::submit(std::uint32_t current_buffer) noexcept
+    {
+        Expects(current_buffer < _command_buffers.size());
+
         // Submit command buffer
         static const vk::PipelineStageFlags pipe_stage_flags = vk::PipelineStageFlagBits::eColorAttachmentOutput;
 
@@ -247,7 +350,9 @@ namespace scener::graphics::vulkan
             .setSignalSemaphoreCount(1)
             .setPSignalSemaphores(&_draw_complete_semaphores[_frame_index]);
 
-        result = _graphics_queue.submit(1, &submit_info, _fences[_frame_index]);
+        _submit_times[current_buffer] = profiler::now();
+
+        auto result = _graphics_queue.submit(1, &submit_info, _fences[_frame_index]);
 
         check_result(result);
 
@@ -273,116 +378,154 @@ namespace scener::graphics::vulkan
     {
     }
 
-    void logical_device::begin_prepare() noexcept
+    void logical_device::begin_prepare(std::uint32_t image) noexcept
     {
-        for (std::uint32_t current_buffer = 0; current_buffer < _swap_chain_images.size(); ++current_buffer)
-        {
-            // TODO : Check usage
-            // auto image_subresource_range = vk::ImageSubresourceRange()
-            //      .setAspectMask(vk::ImageAspectFlagBits::eColor)
-            //      .setBaseMipLevel(0)
-            //      .setLevelCount(1)
-            //      .setBaseArrayLayer(0)
-            //      .setLayerCount(1);
+        Expects(image < _command_buffers.size());
 
-            const auto& command_buffer           = _command_buffers[current_buffer];
-            const auto command_buffer_begin_info = vk::CommandBufferBeginInfo()
-                .setFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse);
+        // TODO : Check usage
+        // auto image_subresource_range = vk::ImageSubresourceRange()
+        //      .setAspectMask(vk::ImageAspectFlagBits::eColor)
+        //      .setBaseMipLevel(0)
+        //      .setLevelCount(1)
+        //      .setBaseArrayLayer(0)
+        //      .setLayerCount(1);
 
-            // Begin main command buffer
-            auto result = command_buffer.begin(&command_buffer_begin_info);
+        const auto& command_buffer           = _command_buffers[image];
+        const auto command_buffer_begin_info = vk::CommandBufferBeginInfo()
+            .setFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse);
 
-            check_result(result);
+        // Begin main command buffer, implicitly resetting its previous recording
+        auto result = command_buffer.begin(&command_buffer_begin_info);
 
-            static const vk::ClearValue clear_values[2] =
-            {
-                vk::ClearColorValue(std::array<float, 4>({ { 0, 0, 0, 1.0f } })),
-                vk::ClearDepthStencilValue(1.0f, 0u)
-            };
-
-            // Begin render pass
-            const auto render_area = vk::Rect2D()
-                .setOffset({ static_cast<std::int32_t>(_viewport.x)
-                           , static_cast<std::int32_t>(_viewport.y) })
-                .setExtent({ static_cast<std::uint32_t>(_viewport.width)
-                           , static_cast<std::uint32_t>(_viewport.height) });
-
-            const auto render_pass_begin_info = vk::RenderPassBeginInfo()
-                .setRenderPass(_render_pass)
-                .setFramebuffer(_frame_buffers[current_buffer])
-                .setRenderArea(render_area)
-                .setClearValueCount(2)
-                .setPClearValues(clear_values);
-
-            command_buffer.beginRenderPass(&render_pass_begin_info, vk::SubpassContents::eInline);
-
-            // Set the viewport
-            command_buffer.setViewport(0, 1, &_viewport);
-
-            // Set scissor
-            vk::Rect2D const scissor(vk::Offset2D(static_cast<std::int32_t>(_viewport.x)     , static_cast<std::int32_t>(_viewport.y))
-                                   , vk::Extent2D(static_cast<std::uint32_t>(_viewport.width), static_cast<std::uint32_t>(_viewport.height)));
-
-            command_buffer.setScissor(0, 1, &scissor);
+        check_result(result);
+
+        static const vk::ClearValue clear_values[2] =
+        {
+            vk::ClearColorValue(std::array<float, 4>({ { 0, 0, 0, 1.0f } })),
+            vk::ClearDepthStencilValue(1.0f, 0u)
+        };
+
+        // Begin render pass
+        const auto render_area = vk::Rect2D()
+            .setOffset({ static_cast<std::int32_t>(_viewport.x)
+                       , static_cast<std::int32_t>(_viewport.y) })
+            .setExtent({ static_cast<std::uint32_t>(_viewport.width)
+                       , static_cast<std::uint32_t>(_viewport.height) });
+
+        const auto render_pass_begin_info = vk::RenderPassBeginInfo()
+            .setRenderPass(_render_pass)
+            .setFramebuffer(_frame_buffers[image])
+            .setRenderArea(render_area)
+            .setClearValueCount(2)
+            .setPClearValues(clear_values);
+
+        // Render pass timestamps, read back on the next submission of this command buffer
+        if (_timestamps_supported)
+        {
+            command_buffer.resetQueryPool(_timestamp_query_pool, image * 2, 2);
+            command_buffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, _timestamp_query_pool, image * 2);
         }
+
+        command_buffer.beginRenderPass(&render_pass_begin_info, vk::SubpassContents::eInline);
+
+        // Set the viewport
+        command_buffer.setViewport(0, 1, &_viewport);
+
+        // Set scissor
+        vk::Rect2D const scissor(vk::Offset2D(static_cast<std::int32_t>(_viewport.x)     , static_cast<std::int32_t>(_viewport.y))
+                               , vk::Extent2D(static_cast<std::uint32_t>(_viewport.width), static_cast<std::uint32_t>(_viewport.height)));
+
+        command_buffer.setScissor(0, 1, &scissor);
+    }
+
+    void logical_device::bind_graphics_pipeline(std::uint32_t image, const graphics_pipeline& pipeline) const noexcept
+    {
+        _command_buffers[image].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline.pipeline());
     }
 
-    void logical_device::bind_graphics_pipeline(const graphics_pipeline& pipeline) const noexcept
+    void logical_device::bind_descriptor_sets(std::uint32_t image, const graphics_pipeline& pipeline) const noexcept
     {
-        for (std::uint32_t current_buffer = 0; current_buffer < _swap_chain_images.size(); ++current_buffer)
+        _command_buffers[image].bindDescriptorSets(
+            vk::PipelineBindPoint::eGraphics
+          , pipeline.pipeline_layout()
+          , 0
+          , 1
+          , &pipeline.descriptors()[image]
+          , 0
+          , nullptr);
+
+        if (pipeline.uses_texture_table())
         {
-            _command_buffers[current_buffer].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline.pipeline());
-            _command_buffers[current_buffer].bindDescriptorSets(
+            _command_buffers[image].bindDescriptorSets(
                 vk::PipelineBindPoint::eGraphics
               , pipeline.pipeline_layout()
-              , 0
               , 1
-              , &pipeline.descriptors()[current_buffer]
+              , 1
+              , &pipeline._texture_table
               , 0
               , nullptr);
         }
     }
 
-    void logical_device::draw_indexed(std::uint32_t                  base_vertex
-                                    , std::uint32_t                  min_vertex_index
-                                    , std::uint32_t                  num_vertices
-                                    , std::uint32_t                  start_index
-                                    , std::uint32_t                  primitive_count
-                                    , const graphics::vertex_buffer* vertex_buffer
-                                    , const graphics::index_buffer*  index_buffer) noexcept
+    void logical_device::push_texture_indices(std::uint32_t                         image
+                                            , const graphics_pipeline&              pipeline
+                                            , const gsl::span<const std::uint32_t>& indices) const noexcept
     {
-        static const vk::DeviceSize offsets[] = { 0 };
+        Expects(pipeline.uses_texture_table());
+
+        _command_buffers[image].pushConstants(
+            pipeline.pipeline_layout()
+          , vk::ShaderStageFlagBits::eFragment
+          , 0
+          , static_cast<std::uint32_t>(indices.size_bytes())
+          , indices.data());
+    }
 
-        const auto index_element_type = static_cast<vk::IndexType>(index_buffer->index_element_type());
-        const auto offset             = start_index * index_buffer->element_size_in_bytes();
+    void logical_device::bind_vertex_buffers(std::uint32_t                    image
+                                           , const graphics::vertex_buffer*   vertex_buffer
+                                           , const graphics::instance_buffer* instance_buffer) const noexcept
+    {
+        static const vk::DeviceSize offsets[] = { 0, 0 };
 
-        for (std::uint32_t current_buffer = 0; current_buffer < _swap_chain_images.size(); ++current_buffer)
-        {
-            const auto& command_buffer = _command_buffers[current_buffer];
+        const vk::Buffer buffers[] = { vertex_buffer->_buffer.resources(0).memory_buffer
+                                     , instance_buffer->_buffer.resources(image).memory_buffer };
 
-            // Vertex buffer binding
-            command_buffer.bindVertexBuffers(0, 1, &vertex_buffer->_buffer.resources(0).memory_buffer, offsets);
+        _command_buffers[image].bindVertexBuffers(0, 2, buffers, offsets);
+    }
 
-            // Index buffer binding
-            command_buffer.bindIndexBuffer(index_buffer->_buffer.resources(0).memory_buffer, 0, index_element_type);
+    void logical_device::bind_index_buffer(std::uint32_t image, const graphics::index_buffer* index_buffer) const noexcept
+    {
+        const auto index_element_type = static_cast<vk::IndexType>(index_buffer->index_element_type());
 
-            // Draw call
-            command_buffer.drawIndexed(
-                index_buffer->index_count()
-              , 1
-              , start_index
-              , offset
-              , base_vertex);
-        }
+        _command_buffers[image].bindIndexBuffer(index_buffer->_buffer.resources(0).memory_buffer, 0, index_element_type);
+    }
+
+    void logical_device::draw_indexed(std::uint32_t image
+                                    , std::uint32_t index_count
+                                    , std::uint32_t instance_count
+                                    , std::uint32_t start_index
+                                    , std::uint32_t base_vertex) const noexcept
+    {
+        _command_buffers[image].drawIndexed(
+            index_count
+          , instance_count
+          , start_index
+          , static_cast<std::int32_t>(base_vertex)
+          , 0);
     }
 
-    void logical_device::end_prepare() noexcept
+    void logical_device::end_prepare(std::uint32_t image) noexcept
     {
-        for (std::uint32_t current_buffer = 0; current_buffer < _swap_chain_images.size(); ++current_buffer)
+        _command_buffers[image].endRenderPass();
+
+        if (_timestamps_supported)
         {
-            _command_buffers[current_buffer].endRenderPass();
-            _command_buffers[current_buffer].end();
+            _command_buffers[image].writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe
+                                                 , _timestamp_query_pool
+                                                 , image * 2 + 1);
         }
+
+        _command_buffers[image].end();
     }
 
     buffer logical_device::create_index_buffer(const gsl::span<const std::uint8_t>& data) noexcept
@@ -407,6 +550,25 @@ namespace scener::graphics::vulkan
         return buffer_instance;
     }
 
+    buffer logical_device::create_storage_buffer(std::uint64_t count) noexcept
+    {
+        buffer buffer_instance { buffer_usage::storage_buffer, vk::SharingMode::eExclusive, count, &_allocator };
+
+        return buffer_instance;
+    }
+
+    buffer logical_device::create_instance_buffer(std::uint64_t count) noexcept
+    {
+        // One copy per swap chain image, each command buffer binds its own copy
+        buffer buffer_instance { buffer_usage::vertex_buffer
+                               , vk::SharingMode::eExclusive
+                               , count
+                               , static_cast<std::uint32_t>(_swap_chain_images.size())
+                               , &_allocator };
+
+        return buffer_instance;
+    }
+
     buffer logical_device::create_buffer(buffer_usage usage, vk::SharingMode sharing_mode, const gsl::span<const std::uint8_t>& data) noexcept
     {
         buffer buffer_instance { usage, sharing_mode, static_cast<std::uint64_t>(data.size()), &_allocator };
@@ -446,21 +608,35 @@ namespace scener::graphics::vulkan
 
                 std::copy_n(data.data(), data.size(), reinterpret_cast<char*>(staging_buffer_alloc_info.pMappedData));
 
+                profiler::add_uploaded_bytes(data.size());
+
                 // Copy buffer contents from the staging buffer to the real buffer
                 auto buffer_copy_region = vk::BufferCopy()
                     .setSrcOffset(0)
                     .setDstOffset(0)
                     .setSize(buffer_create_info.size);
 
-                // Copy buffer contents from the staging buffer to the real buffer
-                begin_single_time_commands();
-
-                _single_time_command_buffer.copyBuffer(staging_buffer, buffer_instance.resources(0).memory_buffer, 1, &buffer_copy_region);
-
-                end_single_time_commands();
-
-                // Destroy the staging buffer
-                vmaDestroyBuffer(_allocator, staging_buffer, staging_buffer_allocation);
+                // Copy buffer contents from the staging buffer to the real buffer, the staging buffer is
+                // released once the copy completes
+                auto upload = begin_upload(staging_buffer, staging_buffer_allocation);
+
+                upload.transfer_commands.copyBuffer(staging_buffer, buffer_instance.resources(0).memory_buffer, 1, &buffer_copy_region);
+
+                const auto barrier = vk::BufferMemoryBarrier()
+                    .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                    .setDstAccessMask(vk::AccessFlagBits::eVertexAttributeRead
+                                    | vk::AccessFlagBits::eIndexRead
+                                    | vk::AccessFlagBits::eUniformRead)
+                    .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setBuffer(buffer_instance.resources(0).memory_buffer)
+                    .setOffset(0)
+                    .setSize(VK_WHOLE_SIZE);
+
+                end_upload(upload
+                         , vk::PipelineStageFlagBits::eVertexInput | vk::PipelineStageFlagBits::eVertexShader
+                         , &barrier
+                         , nullptr);
             }
             else
             {
@@ -560,12 +736,18 @@ namespace scener::graphics::vulkan
 
         check_result(result);
 
+        // No image has been submitted yet
+        _image_fences.assign(num_images, vk::Fence());
+
         // Image Views
         create_image_views();
 
         // Command buffers
         create_command_buffers();
 
+        // Render pass timestamps
+        create_timestamp_queries();
+
         // Render pass
         create_render_pass();
 
@@ -587,7 +769,178 @@ namespace scener::graphics::vulkan
           const graphics::blend_state&         color_blend_state
         , const graphics::depth_stencil_state& depth_stencil_state
         , const graphics::rasterizer_state&    rasterization_state
+        , const graphics::bone_palette&        bone_palette
+        , const graphics::texture_table*       texture_table
         , const graphics::model_mesh_part&     model_mesh_part) const noexcept
+    {
+        // Color blend, depth stencil and rasterier states
+        auto color_blend_attachment = vk::PipelineColorBlendAttachmentState();
+
+        const auto color_blend_state_info   = vk_color_blend_state(color_blend_state, color_blend_attachment);
+        const auto depth_stencil_state_info = vk_depth_stencil_state(depth_stencil_state);
+        const auto rasterizer_state_info    = vk_rasterizer_state(rasterization_state);
+
+        // Shader stages
+        const auto  effect_pass = model_mesh_part.effect_technique()->passes().at(0);
+        const auto  skinned     = model_mesh_part.effect_technique()->skinned();
+        const auto& shaders     = effect_pass->shader_module()->shaders();
+        const auto  bindless    = std::any_of(shaders.begin(), shaders.end(), [] (const auto& shader) -> bool {
+            return shader->uses_texture_table();
+        });
+
+        // Vertex buffer (binding 0) and per-instance transforms (binding 1)
+        const std::array<const vertex_declaration*, 2> declarations = {
+            { &model_mesh_part.vertex_buffer()->vertex_declaration()
+            , &vertex_declaration::instance_transform() }
+        };
+
+        std::vector<vk::VertexInputBindingDescription>   vertexInputBindings;
+        std::vector<vk::VertexInputAttributeDescription> vertexAttributes;
+
+        vertexInputBindings.reserve(declarations.size());
+
+        for (std::uint32_t binding = 0; binding < declarations.size(); ++binding)
+        {
+            const auto& declaration = *declarations[binding];
+
+            vertexInputBindings.push_back(vk::VertexInputBindingDescription()
+                .setBinding(binding)
+                .setStride(declaration.vertex_stride())
+                .setInputRate(static_cast<vk::VertexInputRate>(declaration.input_rate())));
+
+            std::for_each(declaration.vertex_elements().begin()
+                        , declaration.vertex_elements().end()
+                        , [&] (const auto& element) {
+                            auto attr = vk::VertexInputAttributeDescription()
+                                .setBinding(binding)
+                                .setLocation(element.usage_index())
+                                .setOffset(static_cast<std::uint32_t>(element.offset()))
+                                .setFormat(vkFormat(element.format()));
+
+                            vertexAttributes.push_back(attr);
+                          });
+        }
+
+        // Shaders compiled for the texture table sample from set 1 instead of binding 1
+        const auto  table         = (bindless && texture_table != nullptr) ? &texture_table->_table : nullptr;
+        const auto& textures      = model_mesh_part.effect_technique()->textures();
+        const auto  texture_count = (table != nullptr) ? 0 : static_cast<std::uint32_t>(textures.size());
+
+        // Pipelines are shared by every mesh part with the same shaders, vertex declaration and states
+        pipeline_key key;
+
+        key.shaders         = shaders;
+        key.bindings        = vertexInputBindings;
+        key.attributes      = vertexAttributes;
+        key.topology        = vkPrimitiveTopology(model_mesh_part.primitive_type());
+        key.color_blend     = color_blend_attachment;
+        key.depth_stencil   = depth_stencil_state_info;
+        key.rasterizer      = rasterizer_state_info;
+        key.sample_shading  = rasterization_state.multi_sample_anti_alias;
+        key.affine_palette  = skinned && (bone_palette.format() == bone_palette_format::matrix3x4);
+        key.skinned         = skinned;
+        key.texture_table   = (table != nullptr);
+        key.texture_count   = texture_count;
+
+        std::copy(std::begin(color_blend_state_info.blendConstants)
+                , std::end(color_blend_state_info.blendConstants)
+                , key.blend_constants.begin());
+
+        cached_pipeline shared;
+
+        {
+            std::lock_guard<std::mutex> lock(_pipeline_mutex);
+
+            auto cached = _pipelines.find(key);
+
+            if (cached == _pipelines.end())
+            {
+                cached = _pipelines.emplace(key, create_pipeline(key, table)).first;
+            }
+
+            shared = cached->second;
+        }
+
+        // Descriptors, each mesh part has its own descriptor sets
+        const auto descriptor_pool = create_descriptor_pool(texture_count, skinned);
+        const auto constant_buffer = effect_pass->constant_buffer();
+        auto buffer_info           = vk::DescriptorBufferInfo()
+            .setOffset(0)
+            .setRange(constant_buffer->size())
+            .setBuffer(constant_buffer->memory_buffer().resources(0).memory_buffer);
+
+        std::vector<vk::DescriptorImageInfo> tex_descs(texture_count);
+
+        for (std::uint32_t i = 0; i < texture_count; i++)
+        {
+            tex_descs[i].setSampler(textures[i]->sampler());
+            tex_descs[i].setImageView(textures[i]->view());
+            tex_descs[i].setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+        }
+
+        const auto palette_info = vk::DescriptorBufferInfo()
+            .setOffset(0)
+            .setRange(VK_WHOLE_SIZE)
+            .setBuffer(bone_palette._buffer.resources(0).memory_buffer);
+
+        std::vector<vk::WriteDescriptorSet> writes;
+
+        writes.push_back(vk::WriteDescriptorSet()
+            .setDstBinding(0)
+            .setDescriptorCount(1)
+            .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+            .setPBufferInfo(&buffer_info));
+
+        if (texture_count > 0)
+        {
+            writes.push_back(vk::WriteDescriptorSet()
+                .setDstBinding(1)
+                .setDescriptorCount(texture_count)
+                .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+                .setPImageInfo(tex_descs.data()));
+        }
+
+        if (skinned)
+        {
+            writes.push_back(vk::WriteDescriptorSet()
+                .setDstBinding(2)
+                .setDescriptorCount(1)
+                .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                .setPBufferInfo(&palette_info));
+        }
+
+        const auto descriptor_set_alloc_info = vk::DescriptorSetAllocateInfo()
+            .setDescriptorPool(descriptor_pool)
+            .setDescriptorSetCount(1)
+            .setPSetLayouts(&shared.descriptor_set_layout);
+
+        std::vector<vk::DescriptorSet> descriptors(_swap_chain_images.size());
+
+        for (std::uint32_t i = 0; i < _swap_chain_images.size(); ++i)
+        {
+            auto result = _logical_device.allocateDescriptorSets(&descriptor_set_alloc_info, &descriptors[i]);
+
+            check_result(result);
+
+            for (auto& write : writes)
+            {
+                write.setDstSet(descriptors[i]);
+            }
+
+            _logical_device.updateDescriptorSets(static_cast<std::uint32_t>(writes.size()), writes.data(), 0, nullptr);
+        }
+
+        return { shared.pipeline
+               , shared.pipeline_layout
+               , descriptor_pool
+               , shared.descriptor_set_layout
+               , descriptors
+               , (table != nullptr) ? table->descriptor_set : vk::DescriptorSet()
+               , color_blend_attachment.blendEnable == VK_TRUE };
+    }
+
+    cached_pipeline logical_device::create_pipeline(const pipeline_key&             key
+                                                  , const texture_descriptor_table* texture_table) const noexcept
     {
         const auto scissor = vk::Rect2D()
             .setOffset({ static_cast<std::int32_t>(_viewport.x)
@@ -601,16 +954,17 @@ namespace scener::graphics::vulkan
             .setScissorCount(1)
             .setPScissors(&scissor);
 
-        // Color blend, depth stencil and rasterier states
-        auto color_blend_attachment = vk::PipelineColorBlendAttachmentState();
-
-        const auto color_blend_state_info   = vk_color_blend_state(color_blend_state, color_blend_attachment);
-        const auto depth_stencil_state_info = vk_depth_stencil_state(depth_stencil_state);
-        const auto rasterizer_state_info    = vk_rasterizer_state(rasterization_state);
+        // Color blend state
+        const auto color_blend_state_info = vk::PipelineColorBlendStateCreateInfo()
+            .setLogicOpEnable(VK_FALSE)
+            .setLogicOp(vk::LogicOp::eCopy)
+            .setAttachmentCount(1)
+            .setPAttachments(&key.color_blend)
+            .setBlendConstants(key.blend_constants);
 
         // Multisampling state
         const auto multisampling_state_info = vk::PipelineMultisampleStateCreateInfo()
-            .setSampleShadingEnable(rasterization_state.multi_sample_anti_alias)
+            .setSampleShadingEnable(key.sample_shading)
             .setRasterizationSamples(vk::SampleCountFlagBits::e1)
             .setMinSampleShading(1.0f)
             .setPSampleMask(nullptr)
@@ -626,15 +980,27 @@ namespace scener::graphics::vulkan
 
         // Assembly state
         const auto input_assembly_state = vk::PipelineInputAssemblyStateCreateInfo()
-            .setTopology(vkPrimitiveTopology(model_mesh_part.primitive_type()));
+            .setTopology(key.topology);
 
-        // Shader stages
-        const auto effect_pass = model_mesh_part.effect_technique()->passes().at(0);
+        // Specialization constant 0 selects the bone palette layout in the skinning shaders
+        const vk::Bool32 affine_palette = key.affine_palette ? VK_TRUE : VK_FALSE;
+
+        const auto specialization_entry = vk::SpecializationMapEntry()
+            .setConstantID(0)
+            .setOffset(0)
+            .setSize(sizeof(vk::Bool32));
+
+        const auto specialization_info = vk::SpecializationInfo()
+            .setMapEntryCount(1)
+            .setPMapEntries(&specialization_entry)
+            .setDataSize(sizeof(vk::Bool32))
+            .setPData(&affine_palette);
 
+        // Shader stages
         std::vector<vk::ShaderModule>                  shader_modules;
         std::vector<vk::PipelineShaderStageCreateInfo> shader_stages_create_infos;
 
-        for (const auto& shader : effect_pass->shader_module()->shaders())
+        for (const auto& shader : key.shaders)
         {
             auto create_info = vk::ShaderModuleCreateInfo()
                 .setCodeSize(shader->buffer().size())
@@ -649,46 +1015,23 @@ namespace scener::graphics::vulkan
             auto stage = vk::PipelineShaderStageCreateInfo()
                 .setModule(shader_module)
                 .setStage(stageFlags)
-                .setPName(shader->entry_point().c_str());
+                .setPName(shader->entry_point().c_str())
+                .setPSpecializationInfo(key.skinned ? &specialization_info : nullptr);
 
             shader_stages_create_infos.push_back(stage);
         }
 
-        // Vertex buffer
-        const auto& vertex_declaration = model_mesh_part.vertex_buffer()->vertex_declaration();
-        const auto vertexInputBinding  = vk::VertexInputBindingDescription()
-            .setBinding(0)
-            .setStride(vertex_declaration.vertex_stride())
-            .setInputRate(vk::VertexInputRate::eVertex);
-
-        std::vector<vk::VertexInputAttributeDescription> vertexAttributes;
-
-        vertexAttributes.reserve(vertex_declaration.vertex_elements().size());
-
-        std::for_each(vertex_declaration.vertex_elements().begin()
-                    , vertex_declaration.vertex_elements().end()
-                    , [&] (const auto& element) {
-                        auto attr = vk::VertexInputAttributeDescription()
-                            .setBinding(0)
-                            .setLocation(element.usage_index())
-                            .setOffset(element.offset())
-                            .setFormat(vkFormat(element.format()));
-
-                        vertexAttributes.push_back(attr);
-                      });
-
         const auto vertex_input_state = vk::PipelineVertexInputStateCreateInfo()
-            .setPVertexBindingDescriptions(&vertexInputBinding)
-            .setVertexBindingDescriptionCount(1)
-            .setPVertexAttributeDescriptions(vertexAttributes.data())
-            .setVertexAttributeDescriptionCount(static_cast<std::uint32_t>(vertexAttributes.size()));
+            .setPVertexBindingDescriptions(key.bindings.data())
+            .setVertexBindingDescriptionCount(static_cast<std::uint32_t>(key.bindings.size()))
+            .setPVertexAttributeDescriptions(key.attributes.data())
+            .setVertexAttributeDescriptionCount(static_cast<std::uint32_t>(key.attributes.size()));
 
-        // Descriptor pool
-        const auto& textures          = model_mesh_part.effect_technique()->textures();
-        const auto  texture_count     = static_cast<std::uint32_t>(textures.size());
-        const auto  descriptor_pool   = create_descriptor_pool(texture_count);
-        const auto  descriptor_layout = create_descriptor_layout(texture_count);
-        const auto  pipeline_layout   = create_pipeline_layout(descriptor_layout);
+        // Layouts
+        cached_pipeline result;
+
+        result.descriptor_set_layout = create_descriptor_layout(key.texture_count, key.skinned);
+        result.pipeline_layout       = create_pipeline_layout(result.descriptor_set_layout, texture_table);
 
         // Graphics pipeline
         const auto pipeline_create_info = vk::GraphicsPipelineCreateInfo()
@@ -697,82 +1040,44 @@ namespace scener::graphics::vulkan
             .setPVertexInputState(&vertex_input_state)
             .setPInputAssemblyState(&input_assembly_state)
             .setPViewportState(&viewport_state)
-            .setPRasterizationState(&rasterizer_state_info)
+            .setPRasterizationState(&key.rasterizer)
             .setPMultisampleState(&multisampling_state_info)
-            .setPDepthStencilState(&depth_stencil_state_info)
+            .setPDepthStencilState(&key.depth_stencil)
             .setPColorBlendState(&color_blend_state_info)
             .setPDynamicState(&dynamic_states_info)
-            .setLayout(pipeline_layout)
+            .setLayout(result.pipeline_layout)
             .setRenderPass(_render_pass);
 
         // Graphics pipeline initialization
-        vk::Pipeline pipeline;
+        auto pipeline_result = _logical_device.createGraphicsPipelines(_pipeline_cache, 1, &pipeline_create_info, nullptr, &result.pipeline);
 
-        auto result = _logical_device.createGraphicsPipelines(_pipeline_cache, 1, &pipeline_create_info, nullptr, &pipeline);
-
-        check_result(result);
+        check_result(pipeline_result);
 
         // Destroy the shader modules
         std::for_each(shader_modules.begin(), shader_modules.end(), [&] (auto& module) {
             _logical_device.destroyShaderModule(module, nullptr);
         });
 
-        // Descriptors
-        const auto constant_buffer = effect_pass->constant_buffer();
-        auto buffer_info           = vk::DescriptorBufferInfo()
-            .setOffset(0)
-            .setRange(constant_buffer->size())
-            .setBuffer(constant_buffer->memory_buffer().resources(0).memory_buffer);
-
-        vk::DescriptorImageInfo tex_descs[texture_count];
-
-        for (std::uint32_t i = 0; i < texture_count; i++)
-        {
-            tex_descs[i].setSampler(textures[i]->sampler());
-            tex_descs[i].setImageView(textures[i]->view());
-            tex_descs[i].setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
-        }
-
-        vk::WriteDescriptorSet writes[2];
-
-        writes[0].setDstBinding(0);
-        writes[0].setDescriptorCount(1);
-        writes[0].setDescriptorType(vk::DescriptorType::eUniformBuffer);
-        writes[0].setPBufferInfo(&buffer_info);
-
-        writes[1].setDstBinding(1);
-        writes[1].setDescriptorCount(texture_count);
-        writes[1].setDescriptorType(vk::DescriptorType::eCombinedImageSampler);
-        writes[1].setPImageInfo(tex_descs);
+        return result;
+    }
 
-        const auto descriptor_set_alloc_info = vk::DescriptorSetAllocateInfo()
-            .setDescriptorPool(descriptor_pool)
-            .setDescriptorSetCount(1)
-            .setPSetLayouts(&descriptor_layout);
+    vk::Sampler logical_device::create_sampler(gsl::not_null<const sampler_state*> sampler_state) const noexcept
+    {
+        std::lock_guard<std::mutex> lock(_sampler_mutex);
 
-        std::vector<vk::DescriptorSet> descriptors(_swap_chain_images.size());
+        const auto it = _samplers.find(*sampler_state);
 
-        for (std::uint32_t i = 0; i < _swap_chain_images.size(); ++i)
+        if (it != _samplers.end())
         {
-            auto result = _logical_device.allocateDescriptorSets(&descriptor_set_alloc_info, &descriptors[i]);
-
-            check_result(result);
-
-            writes[0].setDstSet(descriptors[i]);
-            writes[1].setDstSet(descriptors[i]);
+            it->second.references++;
 
-            _logical_device.updateDescriptorSets(2, writes, 0, nullptr);
+            return it->second.sampler;
         }
 
-        return { pipeline, pipeline_layout, descriptor_pool, descriptor_layout, descriptors };
-    }
-
-    vk::Sampler logical_device::create_sampler(gsl::not_null<const sampler_state*> sampler_state) const noexcept
-    {
         auto create_info = vk::SamplerCreateInfo()
             .setMipmapMode(vk::SamplerMipmapMode::eLinear)
             .setMinLod(0)
-            .setMaxLod(1)
+            .setMaxLod(static_cast<float>(sampler_state->max_mip_level))
             .setMipLodBias(sampler_state->mip_map_level_of_detail_bias)
             .setAddressModeU(vkSamplerAddressMode(sampler_state->address_u))
             .setAddressModeV(vkSamplerAddressMode(sampler_state->address_v))
@@ -788,67 +1093,84 @@ namespace scener::graphics::vulkan
 
         vk::Sampler sampler;
 
-        auto result = _logical_device.createSampler(&create_info, nullptr, &sampler);
+        check_result(_logical_device.createSampler(&create_info, nullptr, &sampler));
 
-        check_result(result);
+        // Cached only once created, with the handle as the reverse lookup used to release it
+        _samplers.emplace(*sampler_state, cached_sampler { sampler, 1 });
+        _sampler_states.emplace(static_cast<VkSampler>(sampler), *sampler_state);
 
         return sampler;
     }
 
-    texture_object logical_device::create_texture_object(gsl::not_null<const scener::content::dds::surface*>   source
-                                                       , gsl::not_null<const scener::graphics::sampler_state*> sampler_state
-                                                       , vk::ImageTiling                                       tiling
-                                                       , vk::ImageUsageFlags                                   usage
-                                                       , vk::MemoryPropertyFlags                               required_props) noexcept
+    void logical_device::destroy(const vk::Sampler& sampler) const noexcept
     {
-        texture_object texture;
+        std::lock_guard<std::mutex> lock(_sampler_mutex);
 
-        texture.width  = source->width();
-        texture.height = source->height();
+        const auto state = _sampler_states.find(static_cast<VkSampler>(sampler));
 
-        // A single mipmap for now
-        const auto& mipmap      = source->mipmap(0).view();
-        const auto  mipmap_size = static_cast<std::uint32_t>(mipmap.size());
+        Expects(state != _sampler_states.end());
 
-        // Create & allocate the image
-        const auto format = vkFormat(source->format());
-        const auto image_create_info = vk::ImageCreateInfo()
-            .setImageType(vk::ImageType::e2D)
-            .setFormat(format)
-            .setExtent({ texture.width, texture.height, 1})
-            // .setMipLevels(static_cast<std::uint32_t>(source.mipmaps().size()))
-            .setMipLevels(1)
-            .setArrayLayers(1)
-            .setSamples(vk::SampleCountFlagBits::e1)
-            .setTiling(tiling)
-            .setUsage(usage)
-            .setSharingMode(vk::SharingMode::eExclusive)
-            .setQueueFamilyIndexCount(0)
-            .setPQueueFamilyIndices(nullptr)
-            .setInitialLayout(vk::ImageLayout::eUndefined);
+        const auto it = _samplers.find(state->second);
 
-        VmaAllocationCreateInfo create_info = { };
+        Expects(it != _samplers.end() && it->second.references > 0);
 
-        create_info.usage         = VMA_MEMORY_USAGE_GPU_ONLY;
-        create_info.requiredFlags = static_cast<VkMemoryPropertyFlags>(required_props);
+        if (--it->second.references == 0)
+        {
+            _logical_device.destroySampler(it->second.sampler, nullptr);
+            _samplers.erase(it);
+            _sampler_states.erase(state);
+        }
+    }
 
-        auto create_image_result = vmaCreateImage(
-            _allocator
-          , reinterpret_cast<const VkImageCreateInfo*>(&image_create_info)
-          , &create_info
-          , reinterpret_cast<VkImage*>(&texture.image)
-          , &texture.allocation
-          , &texture.allocation_info);
+    staging_texture logical_device::create_staging_texture(gsl::not_null<const scener::content::dds::surface*> source
+                                                         , std::uint32_t                                       base_level) noexcept
+    {
+        const auto& mipmaps = source->mipmaps();
 
-        Ensures(create_image_result == VK_SUCCESS);
-        Ensures(static_cast<std::uint32_t>(texture.allocation_info.size) == mipmap_size);
+        Expects(base_level < mipmaps.size());
 
-        // Copy the image contents to a staging buffer
-        VkBufferCreateInfo buffer_create_info = {
-            VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO    // VkStructureType
+        staging_texture staging;
+
+        staging.format      = vkFormat(source->format());
+        staging.width       = mipmaps[base_level].width();
+        staging.height      = mipmaps[base_level].height();
+        staging.base_level  = base_level;
+        staging.level_count = static_cast<std::uint32_t>(mipmaps.size()) - base_level;
+        staging.layer_count = source->layer_count();
+        staging.cubemap     = source->is_cubemap();
+
+        staging.regions.reserve(staging.layer_count * staging.level_count);
+
+        // One region per layer and mipmap, offsets are kept aligned to the largest texel block size
+        for (std::uint32_t layer = 0; layer < staging.layer_count; ++layer)
+        {
+            const auto& chain = source->mipmaps(layer);
+
+            for (std::uint32_t level = 0; level < staging.level_count; ++level)
+            {
+                const auto& mipmap = chain[base_level + level];
+
+                const auto subresource_layers = vk::ImageSubresourceLayers()
+                    .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                    .setMipLevel(level)
+                    .setBaseArrayLayer(layer)
+                    .setLayerCount(1);
+
+                staging.regions.push_back(vk::BufferImageCopy()
+                    .setBufferOffset(staging.size)
+                    .setImageExtent({ mipmap.width(), mipmap.height(), 1 })
+                    .setImageSubresource(subresource_layers));
+
+                staging.size += (mipmap.view().size() + 15) & ~static_cast<vk::DeviceSize>(15);
+            }
+        }
+
+        // Copy the image contents to a staging buffer
+        VkBufferCreateInfo buffer_create_info = {
+            VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO    // VkStructureType
           , nullptr                                 // pNext
           , 0                                       // flags
-          , mipmap_size                             // size
+          , staging.size                            // size
           , VK_BUFFER_USAGE_TRANSFER_SRC_BIT        // usage
           , VK_SHARING_MODE_EXCLUSIVE               // sharingMode
           , 0                                       // queueFamilyIndexCount
@@ -860,30 +1182,105 @@ namespace scener::graphics::vulkan
         allocation_create_info.usage = VMA_MEMORY_USAGE_CPU_ONLY;
         allocation_create_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
 
-        vk::Buffer        staging_buffer            = { };
-        VmaAllocation     staging_buffer_allocation;
-        VmaAllocationInfo staging_buffer_alloc_info = { };
+        VmaAllocationInfo staging_alloc_info = { };
+
         auto result = vmaCreateBuffer(
             _allocator
           , &buffer_create_info
           , &allocation_create_info
-          , reinterpret_cast<VkBuffer*>(&staging_buffer)
-          , &staging_buffer_allocation
-          , &staging_buffer_alloc_info);
+          , reinterpret_cast<VkBuffer*>(&staging.buffer)
+          , &staging.allocation
+          , &staging_alloc_info);
 
         Ensures(result == VK_SUCCESS);
 
-        std::copy_n(mipmap.data(), mipmap_size, reinterpret_cast<char*>(staging_buffer_alloc_info.pMappedData));
+        for (std::uint32_t layer = 0; layer < staging.layer_count; ++layer)
+        {
+            const auto& chain = source->mipmaps(layer);
+
+            for (std::uint32_t level = 0; level < staging.level_count; ++level)
+            {
+                const auto& mipmap = chain[base_level + level].view();
+                const auto  region = staging.regions[layer * staging.level_count + level];
+                const auto  target = reinterpret_cast<char*>(staging_alloc_info.pMappedData) + region.bufferOffset;
+
+                std::copy_n(mipmap.data(), mipmap.size(), target);
+            }
+        }
+
+        profiler::add_uploaded_bytes(staging.size);
+
+        return staging;
+    }
+
+    void logical_device::destroy(const staging_texture& staging) const noexcept
+    {
+        vmaDestroyBuffer(_allocator, staging.buffer, staging.allocation);
+    }
+
+    texture_object logical_device::create_texture_object(gsl::not_null<const scener::content::dds::surface*>   source
+                                                       , std::uint32_t                                         base_level
+                                                       , gsl::not_null<const scener::graphics::sampler_state*> sampler_state
+                                                       , vk::ImageTiling                                       tiling
+                                                       , vk::ImageUsageFlags                                   usage
+                                                       , vk::MemoryPropertyFlags                               required_props) noexcept
+    {
+        return create_texture_object(create_staging_texture(source, base_level), sampler_state, tiling, usage, required_props);
+    }
+
+    texture_object logical_device::create_texture_object(const staging_texture&                                staging
+                                                       , gsl::not_null<const scener::graphics::sampler_state*> sampler_state
+                                                       , vk::ImageTiling                                       tiling
+                                                       , vk::ImageUsageFlags                                   usage
+                                                       , vk::MemoryPropertyFlags                               required_props) noexcept
+    {
+        texture_object texture;
+
+        texture.width       = staging.width;
+        texture.height      = staging.height;
+        texture.base_level  = staging.base_level;
+        texture.level_count = staging.level_count;
+
+        // Create & allocate the image
+        const auto image_create_info = vk::ImageCreateInfo()
+            .setFlags(staging.cubemap ? vk::ImageCreateFlagBits::eCubeCompatible : vk::ImageCreateFlags())
+            .setImageType(vk::ImageType::e2D)
+            .setFormat(staging.format)
+            .setExtent({ texture.width, texture.height, 1})
+            .setMipLevels(staging.level_count)
+            .setArrayLayers(staging.layer_count)
+            .setSamples(vk::SampleCountFlagBits::e1)
+            .setTiling(tiling)
+            .setUsage(usage)
+            .setSharingMode(vk::SharingMode::eExclusive)
+            .setQueueFamilyIndexCount(0)
+            .setPQueueFamilyIndices(nullptr)
+            .setInitialLayout(vk::ImageLayout::eUndefined);
+
+        VmaAllocationCreateInfo create_info = { };
 
-        // Layout transitions using barriers
-        begin_single_time_commands();
+        create_info.usage         = VMA_MEMORY_USAGE_GPU_ONLY;
+        create_info.requiredFlags = static_cast<VkMemoryPropertyFlags>(required_props);
+
+        auto create_image_result = vmaCreateImage(
+            _allocator
+          , reinterpret_cast<const VkImageCreateInfo*>(&image_create_info)
+          , &create_info
+          , reinterpret_cast<VkImage*>(&texture.image)
+          , &texture.allocation
+          , &texture.allocation_info);
+
+        Ensures(create_image_result == VK_SUCCESS);
+
+        // Layout transitions using barriers, the staging buffer is released once the upload completes
+        auto upload = begin_upload(staging.buffer, staging.allocation);
 
         const auto subresource_range = vk::ImageSubresourceRange()
             .setAspectMask(vk::ImageAspectFlagBits::eColor)
             .setBaseMipLevel(0)
-            .setLevelCount(1)
+            .setLevelCount(staging.level_count)
             .setBaseArrayLayer(0)
-            .setLayerCount(1);
+            .setLayerCount(staging.layer_count);
 
         auto barrier = vk::ImageMemoryBarrier()
             .setOldLayout(vk::ImageLayout::eUndefined)
@@ -895,7 +1292,7 @@ namespace scener::graphics::vulkan
             .setSrcAccessMask(vk::AccessFlagBits())
             .setDstAccessMask(vk::AccessFlagBits::eTransferWrite);
 
-        _single_time_command_buffer.pipelineBarrier(
+        upload.transfer_commands.pipelineBarrier(
             vk::PipelineStageFlagBits::eTopOfPipe
           , vk::PipelineStageFlagBits::eTransfer
           , vk::DependencyFlagBits()
@@ -904,19 +1301,12 @@ namespace scener::graphics::vulkan
           , 1, &barrier);
 
         // Copy the texture data using the staging buffer
-        const auto subresource_layers = vk::ImageSubresourceLayers()
-            .setAspectMask(vk::ImageAspectFlagBits::eColor)
-            .setLayerCount(1);
-
-        const auto region = vk::BufferImageCopy()
-            .setImageExtent({ texture.width, texture.height, 1 })
-            .setImageSubresource(subresource_layers);
-
-        _single_time_command_buffer.copyBufferToImage(
-            staging_buffer
+        upload.transfer_commands.copyBufferToImage(
+            staging.buffer
           , texture.image
           , vk::ImageLayout::eTransferDstOptimal
-          , 1, &region);
+          , static_cast<std::uint32_t>(staging.regions.size())
+          , staging.regions.data());
 
         barrier
             .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
@@ -925,24 +1315,24 @@ namespace scener::graphics::vulkan
             .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
             .setDstAccessMask(vk::AccessFlagBits::eShaderRead);
 
-        _single_time_command_buffer.pipelineBarrier(
-            vk::PipelineStageFlagBits::eTransfer
-          , vk::PipelineStageFlagBits::eFragmentShader
-          , vk::DependencyFlagBits()
-          , 0, nullptr
-          , 0, nullptr
-          , 1, &barrier);
+        end_upload(upload, vk::PipelineStageFlagBits::eFragmentShader, nullptr, &barrier);
 
-        end_single_time_commands();
+        // Create Image View
+        auto view_type = vk::ImageViewType::e2D;
 
-        // Destroy the staging buffer
-        vmaDestroyBuffer(_allocator, staging_buffer, staging_buffer_allocation);
+        if (staging.cubemap)
+        {
+            view_type = (staging.layer_count > 6) ? vk::ImageViewType::eCubeArray : vk::ImageViewType::eCube;
+        }
+        else if (staging.layer_count > 1)
+        {
+            view_type = vk::ImageViewType::e2DArray;
+        }
 
-        // Create Image View
         auto view_create_info = vk::ImageViewCreateInfo()
             .setImage(texture.image)
-            .setViewType(vk::ImageViewType::e2D)
-            .setFormat(format)
+            .setViewType(view_type)
+            .setFormat(staging.format)
             .setSubresourceRange(subresource_range);
 
         check_result(_logical_device.createImageView(&view_create_info, nullptr, &texture.view));
@@ -954,12 +1344,191 @@ namespace scener::graphics::vulkan
         return texture;
     }
 
+    void logical_device::update_texture_descriptors(std::uint32_t                             image
+                                                  , const graphics_pipeline&                  pipeline
+                                                  , const scener::graphics::effect_technique& technique) const noexcept
+    {
+        Expects(image < pipeline.descriptors().size());
+
+        const auto& textures      = technique.textures();
+        const auto  texture_count = static_cast<std::uint32_t>(textures.size());
+
+        // Texture table pipelines are updated through the table
+        if (texture_count == 0 || pipeline.uses_texture_table())
+        {
+            return;
+        }
+
+        std::vector<vk::DescriptorImageInfo> tex_descs(texture_count);
+
+        for (std::uint32_t i = 0; i < texture_count; i++)
+        {
+            tex_descs[i].setSampler(textures[i]->sampler());
+            tex_descs[i].setImageView(textures[i]->view());
+            tex_descs[i].setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+        }
+
+        const auto write = vk::WriteDescriptorSet()
+            .setDstSet(pipeline.descriptors()[image])
+            .setDstBinding(1)
+            .setDescriptorCount(texture_count)
+            .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+            .setPImageInfo(tex_descs.data());
+
+        _logical_device.updateDescriptorSets(1, &write, 0, nullptr);
+    }
+
     void logical_device::destroy(const texture_object& texture) const noexcept
     {
-        _logical_device.destroySampler(texture.sampler, nullptr);
+        _logical_device.destroyImageView(texture.view, nullptr);
+        destroy(texture.sampler);
         vmaDestroyImage(_allocator, texture.image, texture.allocation);
     }
 
+    texture_descriptor_table logical_device::create_texture_descriptor_table(std::uint32_t capacity) const noexcept
+    {
+        Expects(_descriptor_indexing);
+
+        texture_descriptor_table table;
+
+        table.capacity = capacity;
+
+        // Descriptor pool
+        const auto pool_size = vk::DescriptorPoolSize()
+            .setType(vk::DescriptorType::eCombinedImageSampler)
+            .setDescriptorCount(capacity);
+
+        const auto pool_create_info = vk::DescriptorPoolCreateInfo()
+            .setFlags(vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind)
+            .setMaxSets(1)
+            .setPoolSizeCount(1)
+            .setPPoolSizes(&pool_size);
+
+        check_result(_logical_device.createDescriptorPool(&pool_create_info, nullptr, &table.descriptor_pool));
+
+        // Descriptor set layout, entries can be written while command buffers referencing the set are pending and
+        // unused entries are allowed to hold stale descriptors
+        const auto binding = vk::DescriptorSetLayoutBinding()
+            .setBinding(0)
+            .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+            .setDescriptorCount(capacity)
+            .setStageFlags(vk::ShaderStageFlagBits::eFragment)
+            .setPImmutableSamplers(nullptr);
+
+        const vk::DescriptorBindingFlags binding_flags = vk::DescriptorBindingFlagBits::ePartiallyBound
+                                                       | vk::DescriptorBindingFlagBits::eUpdateAfterBind
+                                                       | vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+
+        const auto binding_flags_info = vk::DescriptorSetLayoutBindingFlagsCreateInfo()
+            .setBindingCount(1)
+            .setPBindingFlags(&binding_flags);
+
+        const auto layout_create_info = vk::DescriptorSetLayoutCreateInfo()
+            .setPNext(&binding_flags_info)
+            .setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
+            .setBindingCount(1)
+            .setPBindings(&binding);
+
+        check_result(_logical_device.createDescriptorSetLayout(&layout_create_info, nullptr, &table.descriptor_set_layout));
+
+        // Descriptor set
+        const auto alloc_info = vk::DescriptorSetAllocateInfo()
+            .setDescriptorPool(table.descriptor_pool)
+            .setDescriptorSetCount(1)
+            .setPSetLayouts(&table.descriptor_set_layout);
+
+        check_result(_logical_device.allocateDescriptorSets(&alloc_info, &table.descriptor_set));
+
+        return table;
+    }
+
+    void logical_device::write_texture_descriptor(const texture_descriptor_table& table
+                                                , std::uint32_t                   index
+                                                , const texture_object&           texture) const noexcept
+    {
+        Expects(index < table.capacity);
+
+        const auto image_info = vk::DescriptorImageInfo()
+            .setSampler(texture.sampler)
+            .setImageView(texture.view)
+            .setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+
+        const auto write = vk::WriteDescriptorSet()
+            .setDstSet(table.descriptor_set)
+            .setDstBinding(0)
+            .setDstArrayElement(index)
+            .setDescriptorCount(1)
+            .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+            .setPImageInfo(&image_info);
+
+        _logical_device.updateDescriptorSets(1, &write, 0, nullptr);
+    }
+
+    void logical_device::destroy(const texture_descriptor_table& table) const noexcept
+    {
+        _logical_device.destroyDescriptorPool(table.descriptor_pool, nullptr);
+        _logical_device.destroyDescriptorSetLayout(table.descriptor_set_layout, nullptr);
+    }
+
+    std::uint64_t logical_device::memory_usage() const noexcept
+    {
+        const VkPhysicalDeviceMemoryProperties* memory_properties = nullptr;
+        VmaBudget                               budgets[VK_MAX_MEMORY_HEAPS];
+        std::uint64_t                           usage = 0;
+
+        vmaGetMemoryProperties(_allocator, &memory_properties);
+        vmaGetHeapBudgets(_allocator, budgets);
+
+        for (std::uint32_t i = 0; i < memory_properties->memoryHeapCount; ++i)
+        {
+            if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            {
+                usage += budgets[i].usage;
+            }
+        }
+
+        return usage;
+    }
+
+    std::uint64_t logical_device::memory_budget() const noexcept
+    {
+        const VkPhysicalDeviceMemoryProperties* memory_properties = nullptr;
+        VmaBudget                               budgets[VK_MAX_MEMORY_HEAPS];
+        std::uint64_t                           budget = 0;
+
+        vmaGetMemoryProperties(_allocator, &memory_properties);
+        vmaGetHeapBudgets(_allocator, budgets);
+
+        for (std::uint32_t i = 0; i < memory_properties->memoryHeapCount; ++i)
+        {
+            if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            {
+                budget += budgets[i].budget;
+            }
+        }
+
+        return budget;
+    }
+
+    void logical_device::wait_idle() const noexcept
+    {
+        _logical_device.waitIdle();
+    }
+
+    bool logical_device::is_sampled_format_supported(scener::graphics::surface_format format) const noexcept
+    {
+        const auto properties = _physical_device.getFormatProperties(vkFormat(format));
+
+        return (properties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImage) == vk::FormatFeatureFlagBits::eSampledImage;
+    }
+
+    bool logical_device::is_vertex_format_supported(scener::graphics::vertex_element_format format) const noexcept
+    {
+        const auto properties = _physical_device.getFormatProperties(vkFormat(format));
+
+        return (properties.bufferFeatures & vk::FormatFeatureFlagBits::eVertexBuffer) == vk::FormatFeatureFlagBits::eVertexBuffer;
+    }
+
     void logical_device::create_viewport(const viewport& viewport)
     {
         _viewport
@@ -990,33 +1559,188 @@ namespace scener::graphics::vulkan
     {
         _logical_device.getQueue(_graphics_queue_family_index, 0, &_graphics_queue);
         _logical_device.getQueue(_present_queue_family_index, 0, &_present_queue);
+        _logical_device.getQueue(_transfer_queue_family_index, 0, &_transfer_queue);
     }
 
-    void logical_device::begin_single_time_commands() noexcept
+    pending_upload logical_device::begin_upload(const vk::Buffer& staging_buffer, const VmaAllocation& staging_allocation) noexcept
     {
-        auto begin_info = vk::CommandBufferBeginInfo()
+        pending_upload upload;
+
+        upload.staging_buffer     = staging_buffer;
+        upload.staging_allocation = staging_allocation;
+
+        const auto allocate_info = vk::CommandBufferAllocateInfo()
+            .setCommandPool(_transfer_command_pool)
+            .setCommandBufferCount(1)
+            .setLevel(vk::CommandBufferLevel::ePrimary);
+
+        auto result = _logical_device.allocateCommandBuffers(&allocate_info, &upload.transfer_commands);
+
+        check_result(result);
+
+        const auto begin_info = vk::CommandBufferBeginInfo()
             .setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
 
-        reset_fence(_single_time_command_fence);
+        result = upload.transfer_commands.begin(&begin_info);
+
+        check_result(result);
+
+        return upload;
+    }
+
+    void logical_device::end_upload(pending_upload&                upload
+                                  , vk::PipelineStageFlags         dst_stages
+                                  , const vk::BufferMemoryBarrier* buffer_barrier
+                                  , const vk::ImageMemoryBarrier*  image_barrier) noexcept
+    {
+        const auto fence_create_info = vk::FenceCreateInfo();
+        const auto buffer_count      = (buffer_barrier != nullptr) ? 1u : 0u;
+        const auto image_count       = (image_barrier != nullptr) ? 1u : 0u;
 
-        auto result = _single_time_command_buffer.begin(&begin_info);
+        auto result = _logical_device.createFence(&fence_create_info, nullptr, &upload.fence);
 
         check_result(result);
+
+        if (_transfer_queue_family_index == _graphics_queue_family_index)
+        {
+            // Same queue family, a plain barrier makes the copy visible to the consumer stages
+            upload.transfer_commands.pipelineBarrier(
+                vk::PipelineStageFlagBits::eTransfer
+              , dst_stages
+              , vk::DependencyFlagBits()
+              , 0, nullptr
+              , buffer_count, buffer_barrier
+              , image_count, image_barrier);
+
+            upload.transfer_commands.end();
+
+            const auto submit_info = vk::SubmitInfo()
+                .setCommandBufferCount(1)
+                .setPCommandBuffers(&upload.transfer_commands);
+
+            result = _transfer_queue.submit(1, &submit_info, upload.fence);
+
+            check_result(result);
+        }
+        else
+        {
+            // Queue family ownership transfer, the transfer queue releases the resource and the graphics
+            // queue acquires it, both barriers must describe the same layout transition
+            auto release_buffer = (buffer_barrier != nullptr) ? *buffer_barrier : vk::BufferMemoryBarrier();
+            auto release_image  = (image_barrier != nullptr)  ? *image_barrier  : vk::ImageMemoryBarrier();
+            auto acquire_buffer = release_buffer;
+            auto acquire_image  = release_image;
+
+            release_buffer.setSrcQueueFamilyIndex(_transfer_queue_family_index)
+                          .setDstQueueFamilyIndex(_graphics_queue_family_index)
+                          .setDstAccessMask(vk::AccessFlags());
+            release_image.setSrcQueueFamilyIndex(_transfer_queue_family_index)
+                         .setDstQueueFamilyIndex(_graphics_queue_family_index)
+                         .setDstAccessMask(vk::AccessFlags());
+            acquire_buffer.setSrcQueueFamilyIndex(_transfer_queue_family_index)
+                          .setDstQueueFamilyIndex(_graphics_queue_family_index)
+                          .setSrcAccessMask(vk::AccessFlags());
+            acquire_image.setSrcQueueFamilyIndex(_transfer_queue_family_index)
+                         .setDstQueueFamilyIndex(_graphics_queue_family_index)
+                         .setSrcAccessMask(vk::AccessFlags());
+
+            upload.transfer_commands.pipelineBarrier(
+                vk::PipelineStageFlagBits::eTransfer
+              , vk::PipelineStageFlagBits::eBottomOfPipe
+              , vk::DependencyFlagBits()
+              , 0, nullptr
+              , buffer_count, &release_buffer
+              , image_count, &release_image);
+
+            upload.transfer_commands.end();
+
+            const auto allocate_info = vk::CommandBufferAllocateInfo()
+                .setCommandPool(_single_time_command_pool)
+                .setCommandBufferCount(1)
+                .setLevel(vk::CommandBufferLevel::ePrimary);
+
+            result = _logical_device.allocateCommandBuffers(&allocate_info, &upload.acquire_commands);
+
+            check_result(result);
+
+            const auto begin_info = vk::CommandBufferBeginInfo()
+                .setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+
+            result = upload.acquire_commands.begin(&begin_info);
+
+            check_result(result);
+
+            upload.acquire_commands.pipelineBarrier(
+                dst_stages
+              , dst_stages
+              , vk::DependencyFlagBits()
+              , 0, nullptr
+              , buffer_count, &acquire_buffer
+              , image_count, &acquire_image);
+
+            upload.acquire_commands.end();
+
+            const auto semaphore_create_info = vk::SemaphoreCreateInfo();
+
+            result = _logical_device.createSemaphore(&semaphore_create_info, nullptr, &upload.transfer_complete);
+
+            check_result(result);
+
+            const auto transfer_submit_info = vk::SubmitInfo()
+                .setCommandBufferCount(1)
+                .setPCommandBuffers(&upload.transfer_commands)
+                .setSignalSemaphoreCount(1)
+                .setPSignalSemaphores(&upload.transfer_complete);
+
+            result = _transfer_queue.submit(1, &transfer_submit_info, vk::Fence());
+
+            check_result(result);
+
+            // Frames submitted afterwards are ordered after the acquire
+            const auto acquire_submit_info = vk::SubmitInfo()
+                .setWaitSemaphoreCount(1)
+                .setPWaitSemaphores(&upload.transfer_complete)
+                .setPWaitDstStageMask(&dst_stages)
+                .setCommandBufferCount(1)
+                .setPCommandBuffers(&upload.acquire_commands);
+
+            result = _graphics_queue.submit(1, &acquire_submit_info, upload.fence);
+
+            check_result(result);
+        }
+
+        _pending_uploads.push_back(upload);
     }
 
-    void logical_device::end_single_time_commands() noexcept
+    void logical_device::retire_uploads(bool wait) noexcept
     {
-        _single_time_command_buffer.end();
+        auto it = std::remove_if(_pending_uploads.begin(), _pending_uploads.end(), [&] (const auto& upload) -> bool
+        {
+            if (wait)
+            {
+                check_result(_logical_device.waitForFences(1, &upload.fence, VK_TRUE, std::numeric_limits<std::uint64_t>().max()));
+            }
+            else if (_logical_device.getFenceStatus(upload.fence) != vk::Result::eSuccess)
+            {
+                return false;
+            }
 
-        auto submit_info = vk::SubmitInfo()
-            .setCommandBufferCount(1)
-            .setPCommandBuffers(&_single_time_command_buffer);
+            _logical_device.freeCommandBuffers(_transfer_command_pool, 1, &upload.transfer_commands);
 
-        auto result = _graphics_queue.submit(1, &submit_info, _single_time_command_fence);
+            if (upload.acquire_commands)
+            {
+                _logical_device.freeCommandBuffers(_single_time_command_pool, 1, &upload.acquire_commands);
+                _logical_device.destroySemaphore(upload.transfer_complete, nullptr);
+            }
 
-        check_result(result);
+            _logical_device.destroyFence(upload.fence, nullptr);
+
+            vmaDestroyBuffer(_allocator, upload.staging_buffer, upload.staging_allocation);
 
-        _graphics_queue.waitIdle();
+            return true;
+        });
+
+        _pending_uploads.erase(it, _pending_uploads.end());
     }
 
     void logical_device::reset_fence(const vk::Fence& fence) const noexcept
@@ -1030,8 +1754,7 @@ namespace scener::graphics::vulkan
         const auto semaphore_create_info = vk::SemaphoreCreateInfo();
         const auto fence_create_info     = vk::FenceCreateInfo().setFlags(vk::FenceCreateFlagBits::eSignaled);
 
-        auto result = _logical_device.createFence(&fence_create_info, nullptr, &_single_time_command_fence);
-        check_result(result);
+        vk::Result result;
 
         _fences.resize(_surface_capabilities.minImageCount);
         _image_acquired_semaphores.resize(_surface_capabilities.minImageCount);
@@ -1060,15 +1783,24 @@ namespace scener::graphics::vulkan
 
     void logical_device::create_command_pools() noexcept
     {
-        // Command pool for single time commands
+        // Command pool for single time commands (upload ownership acquires)
         auto st_create_info = vk::CommandPoolCreateInfo()
             .setQueueFamilyIndex(_graphics_queue_family_index)
-            .setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
+            .setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer | vk::CommandPoolCreateFlagBits::eTransient);
 
         auto result = _logical_device.createCommandPool(&st_create_info, nullptr, &_single_time_command_pool);
 
         check_result(result);
 
+        // Command pool for uploads
+        auto transfer_create_info = vk::CommandPoolCreateInfo()
+            .setQueueFamilyIndex(_transfer_queue_family_index)
+            .setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer | vk::CommandPoolCreateFlagBits::eTransient);
+
+        result = _logical_device.createCommandPool(&transfer_create_info, nullptr, &_transfer_command_pool);
+
+        check_result(result);
+
         // Main command pool
         auto create_info = vk::CommandPoolCreateInfo()
             .setQueueFamilyIndex(_present_queue_family_index)
@@ -1081,16 +1813,6 @@ namespace scener::graphics::vulkan
 
     void logical_device::create_command_buffers() noexcept
     {
-        // Command buffers for single time commands
-        auto st_allocate_info = vk::CommandBufferAllocateInfo()
-            .setCommandPool(_single_time_command_pool)
-            .setCommandBufferCount(1)
-            .setLevel(vk::CommandBufferLevel::ePrimary);
-
-        auto result = _logical_device.allocateCommandBuffers(&st_allocate_info, &_single_time_command_buffer);
-
-        check_result(result);
-
         _command_buffers.resize(_swap_chain_images.size());
 
         // Main command buffers
@@ -1099,7 +1821,7 @@ namespace scener::graphics::vulkan
             .setCommandBufferCount(static_cast<std::uint32_t>(_swap_chain_images.size()))
             .setLevel(vk::CommandBufferLevel::ePrimary);
 
-        result = _logical_device.allocateCommandBuffers(&allocate_info, _command_buffers.data());
+        auto result = _logical_device.allocateCommandBuffers(&allocate_info, _command_buffers.data());
 
         check_result(result);
     }
@@ -1296,22 +2018,83 @@ namespace scener::graphics::vulkan
         check_result(result);
     }
 
-    vk::DescriptorPool logical_device::create_descriptor_pool(std::uint32_t texture_count) const noexcept
+    void logical_device::create_timestamp_queries() noexcept
+    {
+        // Two timestamps (render pass begin and end) per swap chain command buffer
+        _submit_times.assign(_swap_chain_images.size(), 0);
+
+        if (!_timestamps_supported)
+        {
+            return;
+        }
+
+        const auto query_pool_info = vk::QueryPoolCreateInfo()
+            .setQueryType(vk::QueryType::eTimestamp)
+            .setQueryCount(static_cast<std::uint32_t>(_swap_chain_images.size() * 2));
+
+        auto result = _logical_device.createQueryPool(&query_pool_info, nullptr, &_timestamp_query_pool);
+
+        check_result(result);
+    }
+
+    void logical_device::read_timestamp_queries(std::uint32_t current_buffer) noexcept
+    {
+        if (!_timestamps_supported || !profiler::enabled() || _submit_times[current_buffer] == 0)
+        {
+            return;
+        }
+
+        std::array<std::uint64_t, 2> timestamps = { };
+
+        // Non blocking, the timings are skipped if the previous submission has not completed yet
+        const auto result = _logical_device.getQueryPoolResults(_timestamp_query_pool
+                                                              , current_buffer * 2
+                                                              , 2
+                                                              , sizeof(timestamps)
+                                                              , timestamps.data()
+                                                              , sizeof(std::uint64_t)
+                                                              , vk::QueryResultFlagBits::e64);
+
+        if (result != vk::Result::eSuccess || timestamps[1] < timestamps[0])
+        {
+            return;
+        }
+
+        // Device timestamps are not calibrated against the CPU clock, the render pass is placed at its submission time
+        const auto duration = static_cast<double>(timestamps[1] - timestamps[0]) * _timestamp_period;
+
+        profiler::record_gpu("render_pass", _submit_times[current_buffer], static_cast<std::uint64_t>(duration));
+    }
+
+    vk::DescriptorPool logical_device::create_descriptor_pool(std::uint32_t texture_count, bool skinned) const noexcept
     {
-        vk::DescriptorPoolSize const poolSizes[2] =
+        const auto set_count = static_cast<std::uint32_t>(_swap_chain_images.size());
+
+        std::vector<vk::DescriptorPoolSize> pool_sizes;
+
+        pool_sizes.push_back(vk::DescriptorPoolSize()
+            .setType(vk::DescriptorType::eUniformBuffer)
+            .setDescriptorCount(set_count));
+
+        // Pipelines sampling from the texture table have no per pipeline texture binding
+        if (texture_count > 0)
         {
-            vk::DescriptorPoolSize()
-                .setType(vk::DescriptorType::eUniformBuffer)
-                .setDescriptorCount(static_cast<std::uint32_t>(_swap_chain_images.size())),
-            vk::DescriptorPoolSize()
+            pool_sizes.push_back(vk::DescriptorPoolSize()
                 .setType(vk::DescriptorType::eCombinedImageSampler)
-                .setDescriptorCount(static_cast<std::uint32_t>(_swap_chain_images.size() * texture_count))
-        };
+                .setDescriptorCount(set_count * texture_count));
+        }
+
+        if (skinned)
+        {
+            pool_sizes.push_back(vk::DescriptorPoolSize()
+                .setType(vk::DescriptorType::eStorageBuffer)
+                .setDescriptorCount(set_count));
+        }
 
         const auto descriptor_pool_create_info = vk::DescriptorPoolCreateInfo()
-            .setMaxSets(static_cast<std::uint32_t>(_swap_chain_images.size()))
-            .setPoolSizeCount(2)
-            .setPPoolSizes(poolSizes);
+            .setMaxSets(set_count)
+            .setPoolSizeCount(static_cast<std::uint32_t>(pool_sizes.size()))
+            .setPPoolSizes(pool_sizes.data());
 
         vk::DescriptorPool descriptor_pool;
 
@@ -1322,28 +2105,41 @@ namespace scener::graphics::vulkan
         return descriptor_pool;
     }
 
-    vk::DescriptorSetLayout logical_device::create_descriptor_layout(std::uint32_t texture_count) const noexcept
+    vk::DescriptorSetLayout logical_device::create_descriptor_layout(std::uint32_t texture_count, bool skinned) const noexcept
     {
         // Pipeline layout
-        const vk::DescriptorSetLayoutBinding layout_bindings[2] =
+        std::vector<vk::DescriptorSetLayoutBinding> layout_bindings;
+
+        layout_bindings.push_back(vk::DescriptorSetLayoutBinding()
+            .setBinding(0)
+            .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+            .setDescriptorCount(1)
+            .setStageFlags(vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment)
+            .setPImmutableSamplers(nullptr));
+
+        if (texture_count > 0)
         {
-            vk::DescriptorSetLayoutBinding()
-                .setBinding(0)
-                .setDescriptorType(vk::DescriptorType::eUniformBuffer)
-                .setDescriptorCount(1)
-                .setStageFlags(vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment)
-                .setPImmutableSamplers(nullptr),
-            vk::DescriptorSetLayoutBinding()
+            layout_bindings.push_back(vk::DescriptorSetLayoutBinding()
                 .setBinding(1)
                 .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
                 .setDescriptorCount(texture_count)
                 .setStageFlags(vk::ShaderStageFlagBits::eFragment)
-                .setPImmutableSamplers(nullptr)
-        };
+                .setPImmutableSamplers(nullptr));
+        }
+
+        if (skinned)
+        {
+            layout_bindings.push_back(vk::DescriptorSetLayoutBinding()
+                .setBinding(2)
+                .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                .setDescriptorCount(1)
+                .setStageFlags(vk::ShaderStageFlagBits::eVertex)
+                .setPImmutableSamplers(nullptr));
+        }
 
         const auto descriptor_set_layout_create_info = vk::DescriptorSetLayoutCreateInfo()
-            .setBindingCount(2)
-            .setPBindings(layout_bindings);
+            .setBindingCount(static_cast<std::uint32_t>(layout_bindings.size()))
+            .setPBindings(layout_bindings.data());
 
         vk::DescriptorSetLayout descriptor_set_layout;
 
@@ -1354,11 +2150,33 @@ namespace scener::graphics::vulkan
         return descriptor_set_layout;
     }
 
-    vk::PipelineLayout logical_device::create_pipeline_layout(const vk::DescriptorSetLayout& descriptor_set_layout) const noexcept
+    vk::PipelineLayout logical_device::create_pipeline_layout(const vk::DescriptorSetLayout&  descriptor_set_layout
+                                                            , const texture_descriptor_table* texture_table) const noexcept
     {
-        const auto pipeline_layout_create_info = vk::PipelineLayoutCreateInfo()
+        // Set 0 holds the pipeline descriptors, set 1 the texture table; the material texture indices are pushed
+        // per draw
+        const vk::DescriptorSetLayout set_layouts[2] =
+        {
+            descriptor_set_layout
+          , (texture_table != nullptr) ? texture_table->descriptor_set_layout : vk::DescriptorSetLayout()
+        };
+
+        const auto push_constant_range = vk::PushConstantRange()
+            .setStageFlags(vk::ShaderStageFlagBits::eFragment)
+            .setOffset(0)
+            .setSize(graphics::texture_table::max_material_textures * sizeof(std::uint32_t));
+
+        auto pipeline_layout_create_info = vk::PipelineLayoutCreateInfo()
             .setSetLayoutCount(1)
-            .setPSetLayouts(&descriptor_set_layout);
+            .setPSetLayouts(set_layouts);
+
+        if (texture_table != nullptr)
+        {
+            pipeline_layout_create_info
+                .setSetLayoutCount(2)
+                .setPushConstantRangeCount(1)
+                .setPPushConstantRanges(&push_constant_range);
+        }
 
         vk::PipelineLayout pipeline_layout;
 
@@ -1373,16 +2191,10 @@ namespace scener::graphics::vulkan
     {
         _logical_device.waitIdle();
 
-        auto waitResult = _logical_device.waitForFences(1, &_single_time_command_fence, VK_TRUE, std::numeric_limits<std::uint64_t>().max());
-
-        check_result(waitResult);
-
-        _logical_device.destroyFence(_single_time_command_fence, nullptr);
-
         // destroy fences
         for (std::uint32_t i = 0; i < _surface_capabilities.minImageCount; ++i)
         {
-            waitResult = _logical_device.waitForFences(1, &_fences[i], VK_TRUE, std::numeric_limits<std::uint64_t>().max());
+            auto waitResult = _logical_device.waitForFences(1, &_fences[i], VK_TRUE, std::numeric_limits<std::uint64_t>().max());
             
             check_result(waitResult);
 
@@ -1407,9 +2219,6 @@ namespace scener::graphics::vulkan
             _logical_device.freeCommandBuffers(_command_pool, _surface_capabilities.minImageCount, _command_buffers.data());
         }
         _command_buffers.clear();
-
-        // Single time command buffers
-        _logical_device.freeCommandBuffers(_single_time_command_pool, 1, &_single_time_command_buffer);
     }
 
     void logical_device::destroy_command_pools() noexcept
@@ -1419,6 +2228,9 @@ namespace scener::graphics::vulkan
 
         // Single time commands command pool
         _logical_device.destroyCommandPool(_single_time_command_pool, nullptr);
+
+        // Upload command pool
+        _logical_device.destroyCommandPool(_transfer_command_pool, nullptr);
     }
 
     void logical_device::destroy_depth_buffer() noexcept
@@ -1462,14 +2274,56 @@ namespace scener::graphics::vulkan
 
         // Swapchain images
         _swap_chain_images.clear(); // swap chain images are destroyed by the vulkan driver
+        _image_fences.clear();
 
         // Swapchain image views
         destroy_swapchain_views();
 
+        // Render pass timestamps
+        destroy_timestamp_queries();
+
         // Swapchains
         _logical_device.destroySwapchainKHR(_swap_chain, nullptr);
     }
 
+    void logical_device::destroy_timestamp_queries() noexcept
+    {
+        if (_timestamp_query_pool)
+        {
+            _logical_device.destroyQueryPool(_timestamp_query_pool, nullptr);
+        }
+
+        _timestamp_query_pool = nullptr;
+        _submit_times.clear();
+    }
+
+    void logical_device::destroy_samplers() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_sampler_mutex);
+
+        for (const auto& [state, cached] : _samplers)
+        {
+            _logical_device.destroySampler(cached.sampler, nullptr);
+        }
+
+        _samplers.clear();
+        _sampler_states.clear();
+    }
+
+    void logical_device::destroy_pipelines() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_pipeline_mutex);
+
+        for (const auto& [key, cached] : _pipelines)
+        {
+            _logical_device.destroyPipeline(cached.pipeline, nullptr);
+            _logical_device.destroyPipelineLayout(cached.pipeline_layout, nullptr);
+            _logical_device.destroyDescriptorSetLayout(cached.descriptor_set_layout, nullptr);
+        }
+
+        _pipelines.clear();
+    }
+
     vk::PipelineColorBlendStateCreateInfo logical_device::vk_color_blend_state(
             const graphics::blend_state&           state
           , vk::PipelineColorBlendAttachmentState& attachment) const noexcept
@@ -5,20 +5,31 @@
 #ifndef SCENER_GRAPHICS_VULKAN_DEVICE_HPP
 #define SCENER_GRAPHICS_VULKAN_DEVICE_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <gsl/gsl>
 
 #include "scener/content/dds/surface.hpp"
 #include "scener/graphics/blend_state.hpp"
 #include "scener/graphics/depth_stencil_state.hpp"
+#include "scener/graphics/instance_buffer.hpp"
 #include "scener/graphics/model_mesh_part.hpp"
 #include "scener/graphics/rasterizer_state.hpp"
 #include "scener/graphics/sampler_state.hpp"
 #include "scener/graphics/viewport.hpp"
+#include "scener/graphics/vulkan/cached_pipeline.hpp"
+#include "scener/graphics/vulkan/cached_sampler.hpp"
 #include "scener/graphics/vulkan/graphics_pipeline.hpp"
 #include "scener/graphics/vulkan/depth_buffer.hpp"
+#include "scener/graphics/vulkan/pending_upload.hpp"
+#include "scener/graphics/vulkan/pipeline_key.hpp"
+#include "scener/graphics/vulkan/staging_texture.hpp"
+#include "scener/graphics/vulkan/texture_descriptor_table.hpp"
 #include "scener/graphics/vulkan/texture_object.hpp"
 #include "scener/graphics/vulkan/shader.hpp"
 #include "scener/graphics/vulkan/vulkan_memory_allocator.hpp"
@@ -27,7 +38,10 @@
 
 namespace scener::graphics
 {
+    class  bone_palette;
     class  constant_buffer;
+    class  effect_technique;
+    class  texture_table;
 }
 
 namespace scener::graphics::vulkan
@@ -50,39 +64,70 @@ namespace scener::graphics::vulkan
                      , const graphics::viewport&         viewport
                      , std::uint32_t                     graphics_queue_family_index
                      , std::uint32_t                     present_queue_family_index
+                     , std::uint32_t                     transfer_queue_family_index
                      , const vk::SurfaceCapabilitiesKHR& surface_capabilities
                      , const vk::SurfaceFormatKHR&       surface_format
                      , const vk::Format&                 depth_format
                      , const vk::PresentModeKHR&         present_mode
-                     , const vk::FormatProperties&       format_properties) noexcept;
+                     , const vk::FormatProperties&       format_properties
+                     , bool                              descriptor_indexing) noexcept;
 
         ~logical_device() noexcept;
 
     public:
         const vk::Queue& graphics_queue() const noexcept;
         const vk::Queue& present_queue() const noexcept;
+        const vk::Queue& transfer_queue() const noexcept;
+
+        /// Gets a value indicating whether descriptor indexing has been enabled on the device.
+        bool supports_descriptor_indexing() const noexcept;
 
     public:
-        /// Starts the recording of the command buffers
-        void begin_prepare() noexcept;
+        /// Starts the recording of the command buffer of the given swap chain image; the image must not be in use
+        /// by a pending submission.
+        void begin_prepare(std::uint32_t image) noexcept;
 
         /// Binds the given graphics pipeline
-        void bind_graphics_pipeline(const graphics_pipeline& pipeline) const noexcept;
+        void bind_graphics_pipeline(std::uint32_t image, const graphics_pipeline& pipeline) const noexcept;
+
+        /// Binds the descriptor sets of the given graphics pipeline
+        void bind_descriptor_sets(std::uint32_t image, const graphics_pipeline& pipeline) const noexcept;
+
+        /// Pushes the texture table indices of the material being drawn with the given graphics pipeline
+        void push_texture_indices(std::uint32_t                         image
+                                , const graphics_pipeline&              pipeline
+                                , const gsl::span<const std::uint32_t>& indices) const noexcept;
+
+        /// Binds the vertex (binding 0) and per-instance (binding 1) streams.
+        void bind_vertex_buffers(std::uint32_t                    image
+                               , const graphics::vertex_buffer*   vertex_buffer
+                               , const graphics::instance_buffer* instance_buffer) const noexcept;
+
+        /// Binds the given index buffer.
+        void bind_index_buffer(std::uint32_t image, const graphics::index_buffer* index_buffer) const noexcept;
+
+        /// Renders instances of the specified geometric primitive, based on indexing into an array of vertices,
+        /// using the currently bound state.
+        void draw_indexed(std::uint32_t image
+                        , std::uint32_t index_count
+                        , std::uint32_t instance_count
+                        , std::uint32_t start_index
+                        , std::uint32_t base_vertex) const noexcept;
 
-        /// Renders the specified geometric primitive, based on indexing into an array of vertices.
-        void draw_indexed(std::uint32_t                  base_vertex
-                        , std::uint32_t                  min_vertex_index
-                        , std::uint32_t                  num_vertices
-                        , std::uint32_t                  start_index
-                        , std::uint32_t                  primitive_count
-                        , const graphics::vertex_buffer* vertex_buffer
-                        , const graphics::index_buffer*  index_buffer) noexcept;
+        /// Ends the recording of the command buffer of the given swap chain image
+        void end_prepare(std::uint32_t image) noexcept;
 
-        /// Ends the recording of command buffers
-        void end_prepare() noexcept;
+        /// Waits for a free frame and acquires the next swap chain image, waiting until the previous submission that
+        /// rendered to the image has completed, so its command buffer and per image resources can be updated.
+        /// \returns the index of the acquired swap chain image.
+        std::uint32_t acquire_next_image(const render_surface& surface) noexcept;
 
-        // Draws the current frame
-        void draw(const render_surface& surface) noexcept;
+        /// Submits the command buffer of the given swap chain image and presents it.
+        /// \param image the index of the swap chain image returned by acquire_next_image.
+        void submit(std::uint32_t image) noexcept;
+
+        /// Gets the number of swap chain images; each image has its own command buffer and descriptor sets.
+        std::uint32_t image_count() const noexcept;
 
         /// Presents the display with the contents of the next buffer in the sequence of back buffers owned by the
         /// graphics_device.
@@ -95,6 +140,10 @@ namespace scener::graphics::vulkan
 
         buffer create_uniform_buffer(std::uint64_t count) noexcept;
 
+        buffer create_storage_buffer(std::uint64_t count) noexcept;
+
+        buffer create_instance_buffer(std::uint64_t count) noexcept;
+
         buffer create_buffer(buffer_usage                         usage
                            , vk::SharingMode                      sharing_mode
                            , const gsl::span<const std::uint8_t>& data) noexcept;
@@ -104,27 +153,74 @@ namespace scener::graphics::vulkan
         void recreate_swap_chain(const render_surface& surface) noexcept;
 
     public:
+        /// Creates the descriptor sets of the given mesh part; mesh parts with the same shaders, vertex declaration
+        /// and states share a single pipeline object.
         graphics_pipeline create_graphics_pipeline(
               const graphics::blend_state&         color_blend_state
             , const graphics::depth_stencil_state& depth_stencil_state
             , const graphics::rasterizer_state&    rasterization_state
+            , const graphics::bone_palette&        bone_palette
+            , const graphics::texture_table*       texture_table
             , const graphics::model_mesh_part&     model_mesh_part) const noexcept;
 
     public:
+        /// Gets the sampler for the given sampler state; identical states share a single, reference counted, sampler.
         vk::Sampler create_sampler(gsl::not_null<const sampler_state*> sampler_state) const noexcept;
+
+        /// Releases a sampler returned by create_sampler, destroying it when no texture uses it anymore.
+        void destroy(const vk::Sampler& sampler) const noexcept;
+
+        staging_texture create_staging_texture(gsl::not_null<const scener::content::dds::surface*>, std::uint32_t) noexcept;
         texture_object create_texture_object(gsl::not_null<const scener::content::dds::surface*>
+                                           , std::uint32_t
                                            , gsl::not_null<const scener::graphics::sampler_state*>
                                            , vk::ImageTiling
                                            , vk::ImageUsageFlags
                                            , vk::MemoryPropertyFlags) noexcept;
+        texture_object create_texture_object(const staging_texture&
+                                           , gsl::not_null<const scener::graphics::sampler_state*>
+                                           , vk::ImageTiling
+                                           , vk::ImageUsageFlags
+                                           , vk::MemoryPropertyFlags) noexcept;
+        /// Rewrites the texture descriptors of the given swap chain image descriptor set; the image must not be in use
+        /// by a pending submission.
+        void update_texture_descriptors(std::uint32_t                             image
+                                      , const graphics_pipeline&                  pipeline
+                                      , const scener::graphics::effect_technique& technique) const noexcept;
+        texture_descriptor_table create_texture_descriptor_table(std::uint32_t capacity) const noexcept;
+        void write_texture_descriptor(const texture_descriptor_table& table
+                                    , std::uint32_t                   index
+                                    , const texture_object&           texture) const noexcept;
+        void destroy(const staging_texture& staging) const noexcept;
         void destroy(const texture_object& texture) const noexcept;
+        void destroy(const texture_descriptor_table& table) const noexcept;
+
+    public:
+        /// Gets the number of bytes currently allocated from device local memory.
+        std::uint64_t memory_usage() const noexcept;
+
+        /// Gets the number of bytes of device local memory the application can allocate, as estimated by the driver.
+        std::uint64_t memory_budget() const noexcept;
+
+        /// Blocks until the device has finished executing all the submitted work.
+        void wait_idle() const noexcept;
+
+        /// Gets a value indicating whether optimal tiling images of the given format can be sampled.
+        bool is_sampled_format_supported(scener::graphics::surface_format format) const noexcept;
+
+        /// Gets a value indicating whether vertex attributes of the given format can be fetched from vertex buffers.
+        bool is_vertex_format_supported(scener::graphics::vertex_element_format format) const noexcept;
 
     private:
         void create_viewport(const graphics::viewport& viewport);
         void create_allocator(const vk::Instance& instance, const vk::PhysicalDevice& physical_device, const vk::Device& logical_device) noexcept;
         void get_device_queues() noexcept;
-        void begin_single_time_commands() noexcept;
-        void end_single_time_commands() noexcept;
+        pending_upload begin_upload(const vk::Buffer& staging_buffer, const VmaAllocation& staging_allocation) noexcept;
+        void end_upload(pending_upload&                upload
+                      , vk::PipelineStageFlags         dst_stages
+                      , const vk::BufferMemoryBarrier* buffer_barrier
+                      , const vk::ImageMemoryBarrier*  image_barrier) noexcept;
+        void retire_uploads(bool wait) noexcept;
         void reset_fence(const vk::Fence& fence) const noexcept;
         void create_sync_primitives() noexcept;
         void create_command_pools() noexcept;
@@ -133,9 +229,13 @@ namespace scener::graphics::vulkan
         void create_depth_buffer(vk::Extent2D extent) noexcept;
         void create_frame_buffers(vk::Extent2D extent) noexcept;
         void create_pipeline_cache() noexcept;
-        vk::DescriptorPool create_descriptor_pool(std::uint32_t texture_count) const noexcept;
-        vk::DescriptorSetLayout create_descriptor_layout(std::uint32_t texture_count) const noexcept;
-        vk::PipelineLayout create_pipeline_layout(const vk::DescriptorSetLayout& descriptor_set_layout) const noexcept;
+        void create_timestamp_queries() noexcept;
+        void read_timestamp_queries(std::uint32_t current_buffer) noexcept;
+        vk::DescriptorPool create_descriptor_pool(std::uint32_t texture_count, bool skinned) const noexcept;
+        vk::DescriptorSetLayout create_descriptor_layout(std::uint32_t texture_count, bool skinned) const noexcept;
+        vk::PipelineLayout create_pipeline_layout(const vk::DescriptorSetLayout&  descriptor_set_layout
+                                                , const texture_descriptor_table* texture_table) const noexcept;
+        cached_pipeline create_pipeline(const pipeline_key& key, const texture_descriptor_table* texture_table) const noexcept;
         void create_command_buffers() noexcept;
         void destroy_sync_primitives() noexcept;
         void destroy_command_buffers() noexcept;
@@ -144,6 +244,9 @@ namespace scener::graphics::vulkan
         void destroy_swapchain_views() noexcept;
         void destroy_frame_buffers() noexcept;
         void destroy_swap_chain() noexcept;
+        void destroy_timestamp_queries() noexcept;
+        void destroy_samplers() noexcept;
+        void destroy_pipelines() noexcept;
 
     private:
         vk::PipelineColorBlendStateCreateInfo vk_color_blend_state(
@@ -153,27 +256,31 @@ namespace scener::graphics::vulkan
         vk::PipelineRasterizationStateCreateInfo vk_rasterizer_state(const graphics::rasterizer_state& state) const noexcept;
 
     private:
+        vk::PhysicalDevice               _physical_device;
         vk::Device                       _logical_device;
         vk::Viewport                     _viewport;
         std::uint32_t                    _graphics_queue_family_index;
         vk::Queue                        _graphics_queue;
         std::uint32_t                    _present_queue_family_index;
         vk::Queue                        _present_queue;
+        std::uint32_t                    _transfer_queue_family_index;
+        vk::Queue                        _transfer_queue;
         vk::SurfaceCapabilitiesKHR       _surface_capabilities;
         vk::SurfaceFormatKHR             _surface_format;
         vk::PresentModeKHR               _present_mode;
         vk::FormatProperties             _format_properties;
         vk::CommandPool                  _command_pool;
         vk::CommandPool                  _single_time_command_pool;
+        vk::CommandPool                  _transfer_command_pool;
         vk::SwapchainKHR                 _swap_chain;
         vk::RenderPass                   _render_pass;
         std::vector<vk::Image>           _swap_chain_images;
         std::vector<vk::ImageView>       _swap_chain_image_views;
         std::vector<vk::Framebuffer>     _frame_buffers;
         std::vector<vk::CommandBuffer>   _command_buffers;
-        vk::CommandBuffer                _single_time_command_buffer;
+        std::vector<pending_upload>      _pending_uploads;
         std::vector<vk::Fence>           _fences;
-        vk::Fence                        _single_time_command_fence;
+        std::vector<vk::Fence>           _image_fences;
         std::vector<vk::Semaphore>       _image_acquired_semaphores;
         std::vector<vk::Semaphore>       _draw_complete_semaphores;
         std::vector<vk::Semaphore>       _image_ownership_semaphores;
@@ -182,6 +289,17 @@ namespace scener::graphics::vulkan
         depth_buffer                    _depth_buffer;
         vk::PipelineCache                _pipeline_cache;
         VmaAllocator                     _allocator;
+        vk::QueryPool                    _timestamp_query_pool;
+        float                            _timestamp_period;
+        bool                             _timestamps_supported;
+        std::vector<std::uint64_t>       _submit_times;
+        bool                             _descriptor_indexing;
+
+        mutable std::mutex                                         _sampler_mutex;
+        mutable std::unordered_map<sampler_state, cached_sampler> _samplers;
+        mutable std::unordered_map<VkSampler, sampler_state>       _sampler_states;
+        mutable std::mutex                                         _pipeline_mutex;
+        mutable std::unordered_map<pipeline_key, cached_pipeline>  _pipelines;
         void describe_vertex_input() const;
     };
 }
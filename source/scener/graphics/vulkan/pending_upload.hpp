@@ -0,0 +1,33 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_VULKAN_PENDING_UPLOAD_HPP
+#define SCENER_GRAPHICS_VULKAN_PENDING_UPLOAD_HPP
+
+#include <vulkan/vulkan.hpp>
+
+#include "scener/graphics/vulkan/vulkan_memory_allocator.hpp"
+
+namespace scener::graphics::vulkan
+{
+    /// A staging copy submitted to the transfer queue, kept alive until the device signals its fence.
+    struct pending_upload
+    {
+    public:
+        /// Copy commands, recorded for the transfer queue family.
+        vk::CommandBuffer transfer_commands  { };
+        /// Queue family ownership acquire commands, recorded for the graphics queue family.
+        /// Null when uploads go through the graphics queue.
+        vk::CommandBuffer acquire_commands   { };
+        /// Signaled by the transfer submission, waited by the acquire submission.
+        vk::Semaphore     transfer_complete  { };
+        /// Signaled once the resource is ready to be used by the graphics queue.
+        vk::Fence         fence              { };
+        /// The staging buffer holding the source data.
+        vk::Buffer        staging_buffer     { };
+        /// The staging buffer memory.
+        VmaAllocation     staging_allocation { };
+    };
+}
+
+#endif // SCENER_GRAPHICS_VULKAN_PENDING_UPLOAD_HPP
@@ -14,14 +14,16 @@ namespace scener::graphics::vulkan
 {
     physical_device::physical_device(const vk::Instance&       instance
                                    , const vk::PhysicalDevice& physical_device) noexcept
-        : _layer_names       { }
-        , _extension_names   { }
-        , _properties        { }
-        , _memory_properties { }
-        , _features          { }
-        , _queue_families    { }
-        , _instance          { instance }
-        , _physical_device   { physical_device }
+        : _layer_names                   { }
+        , _extension_names               { }
+        , _properties                    { }
+        , _memory_properties             { }
+        , _features                      { }
+        , _indexing_features             { }
+        , _descriptor_indexing_available { false }
+        , _queue_families                { }
+        , _instance                      { instance }
+        , _physical_device               { physical_device }
     {
         identify_layers();
         identify_extensions();
@@ -49,9 +51,22 @@ namespace scener::graphics::vulkan
         return _features;
     }
 
+    bool physical_device::has_descriptor_indexing() const noexcept
+    {
+        return _descriptor_indexing_available
+            && _indexing_features.runtimeDescriptorArray
+            && _indexing_features.descriptorBindingPartiallyBound
+            && _indexing_features.descriptorBindingSampledImageUpdateAfterBind
+            && _indexing_features.descriptorBindingUpdateUnusedWhilePending
+            && _indexing_features.shaderSampledImageArrayNonUniformIndexing;
+    }
+
     bool physical_device::has_swapchain_support() const noexcept
     {
-        return _extension_names.size() > 0;
+        return std::any_of(_extension_names.begin(), _extension_names.end(), [] (const char* name) -> bool
+        {
+            return !strcmp(VK_KHR_SWAPCHAIN_EXTENSION_NAME, name);
+        });
     }
 
     bool physical_device::has_graphics_queue() const noexcept
@@ -92,16 +107,23 @@ namespace scener::graphics::vulkan
     {
         auto graphics_queue_family_index = get_graphics_queue_family_index();
         auto present_queue_family_index  = get_present_queue_family_index(surface);
+        auto transfer_queue_family_index = get_transfer_queue_family_index();
 
         Ensures(graphics_queue_family_index != UINT32_MAX);
         Ensures(present_queue_family_index != UINT32_MAX);
 
+        // Uploads go through the graphics queue when there is no dedicated transfer queue family
+        if (transfer_queue_family_index == UINT32_MAX)
+        {
+            transfer_queue_family_index = graphics_queue_family_index;
+        }
+
         const float priorities[1] = { 0.0 };
 
         std::uint32_t queue_count = 1;
 
         // graphics queue
-        vk::DeviceQueueCreateInfo queues[2];
+        vk::DeviceQueueCreateInfo queues[3];
 
         queues[0].setQueueFamilyIndex(graphics_queue_family_index);
         queues[0].setQueueCount(1);
@@ -117,12 +139,33 @@ namespace scener::graphics::vulkan
             queue_count++;
         }
 
+        if (transfer_queue_family_index != graphics_queue_family_index
+         && transfer_queue_family_index != present_queue_family_index)
+        {
+            // transfer queue
+            queues[queue_count].setQueueFamilyIndex(transfer_queue_family_index);
+            queues[queue_count].setQueueCount(1);
+            queues[queue_count].setPQueuePriorities(priorities);
+
+            queue_count++;
+        }
+
         static const std::vector<vk::Format> formats = {
             vk::Format::eD32SfloatS8Uint
           , vk::Format::eD24UnormS8Uint
         };
 
+        // Descriptor indexing, used by the bindless texture table
+        const auto descriptor_indexing = has_descriptor_indexing();
+        const auto indexing_features   = vk::PhysicalDeviceDescriptorIndexingFeatures()
+            .setRuntimeDescriptorArray(VK_TRUE)
+            .setDescriptorBindingPartiallyBound(VK_TRUE)
+            .setDescriptorBindingSampledImageUpdateAfterBind(VK_TRUE)
+            .setDescriptorBindingUpdateUnusedWhilePending(VK_TRUE)
+            .setShaderSampledImageArrayNonUniformIndexing(VK_TRUE);
+
         auto deviceInfo = vk::DeviceCreateInfo()
+            .setPNext(descriptor_indexing ? &indexing_features : nullptr)
             .setQueueCreateInfoCount(queue_count)
             .setPQueueCreateInfos(queues)
             .setEnabledLayerCount(0)
@@ -149,11 +192,13 @@ namespace scener::graphics::vulkan
           , viewport
           , graphics_queue_family_index
           , present_queue_family_index
+          , transfer_queue_family_index
           , surface_caps
           , surface_format
           , depth_format
           , present_mode
-          , format_properties);
+          , format_properties
+          , descriptor_indexing);
     }
 
     void physical_device::identify_layers() noexcept
@@ -178,7 +223,11 @@ namespace scener::graphics::vulkan
     {
         _extension_names.clear();
 
-        const auto extensions = _physical_device.enumerateDeviceExtensionProperties(nullptr);
+        // Descriptor indexing is core since Vulkan 1.2, older devices may expose it as an extension
+        const auto core_descriptor_indexing = (_physical_device.getProperties().apiVersion >= VK_MAKE_VERSION(1, 2, 0));
+        const auto extensions               = _physical_device.enumerateDeviceExtensionProperties(nullptr);
+
+        _descriptor_indexing_available = core_descriptor_indexing;
 
         for (std::uint32_t i = 0; i < extensions.size(); ++i)
         {
@@ -186,6 +235,12 @@ namespace scener::graphics::vulkan
             {
                 _extension_names.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
             }
+            else if (!core_descriptor_indexing && !strcmp(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, extensions[i].extensionName))
+            {
+                _extension_names.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+
+                _descriptor_indexing_available = true;
+            }
         }
     }
 
@@ -214,6 +269,14 @@ namespace scener::graphics::vulkan
         //  If app has specific feature requirements it should check supported
         //  features based on this query
         _features = _physical_device.getFeatures();
+
+        // Descriptor indexing features, only queried when the device supports them
+        if (_descriptor_indexing_available)
+        {
+            auto features = vk::PhysicalDeviceFeatures2().setPNext(&_indexing_features);
+
+            _physical_device.getFeatures2(&features);
+        }
     }
 
     vk::SurfaceCapabilitiesKHR physical_device::get_surface_capabilities(const render_surface& surface) const noexcept
@@ -276,6 +339,35 @@ namespace scener::graphics::vulkan
         return UINT32_MAX;
     }
 
+    std::uint32_t physical_device::get_transfer_queue_family_index() const noexcept
+    {
+        // Prefer a transfer only family (usually backed by the copy engines), then any non graphics family
+        // supporting transfers (async compute)
+        const auto graphics_compute = vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute;
+
+        for (std::uint32_t i = 0; i < _queue_families.size(); ++i)
+        {
+            const auto flags = _queue_families[i].queueFlags;
+
+            if ((flags & vk::QueueFlagBits::eTransfer) && !(flags & graphics_compute))
+            {
+                return i;
+            }
+        }
+
+        for (std::uint32_t i = 0; i < _queue_families.size(); ++i)
+        {
+            const auto flags = _queue_families[i].queueFlags;
+
+            if ((flags & vk::QueueFlagBits::eTransfer) && !(flags & vk::QueueFlagBits::eGraphics))
+            {
+                return i;
+            }
+        }
+
+        return UINT32_MAX;
+    }
+
     std::vector<vk::SurfaceFormatKHR> physical_device::get_surface_formats(const render_surface& surface) const noexcept
     {
         // Get the list of VkFormat's that are supported:
@@ -30,6 +30,7 @@ namespace scener::graphics::vulkan
         const vk::PhysicalDeviceProperties& properties() const noexcept;
         const vk::PhysicalDeviceMemoryProperties& memory_properties() const noexcept;
         const vk::PhysicalDeviceFeatures& features() const noexcept;
+        bool has_descriptor_indexing() const noexcept;
         bool has_swapchain_support() const noexcept;
         bool has_graphics_queue() const noexcept;
         bool is_integrated_gpu() const noexcept;
@@ -53,6 +54,7 @@ namespace scener::graphics::vulkan
         std::vector<vk::Bool32> get_surface_present_support(const render_surface& surface) const noexcept;
         std::uint32_t get_graphics_queue_family_index() const noexcept;
         std::uint32_t get_present_queue_family_index(const render_surface& surface) const noexcept;
+        std::uint32_t get_transfer_queue_family_index() const noexcept;
         std::vector<vk::SurfaceFormatKHR> get_surface_formats(const render_surface& surface) const noexcept;
         vk::SurfaceFormatKHR get_preferred_surface_format(const render_surface& surface) const noexcept;
         vk::PresentModeKHR get_present_mode(const render_surface& surface) const noexcept;
@@ -63,14 +65,16 @@ namespace scener::graphics::vulkan
           , const vk::FormatFeatureFlags&  features) const noexcept;
 
     private:
-        std::vector<const char*>               _layer_names;
-        std::vector<const char*>               _extension_names;
-        vk::PhysicalDeviceProperties           _properties;
-        vk::PhysicalDeviceMemoryProperties     _memory_properties;
-        vk::PhysicalDeviceFeatures             _features;
-        std::vector<vk::QueueFamilyProperties> _queue_families;
-        vk::Instance                           _instance;
-        vk::PhysicalDevice                     _physical_device;
+        std::vector<const char*>                     _layer_names;
+        std::vector<const char*>                     _extension_names;
+        vk::PhysicalDeviceProperties                 _properties;
+        vk::PhysicalDeviceMemoryProperties           _memory_properties;
+        vk::PhysicalDeviceFeatures                   _features;
+        vk::PhysicalDeviceDescriptorIndexingFeatures _indexing_features;
+        bool                                         _descriptor_indexing_available;
+        std::vector<vk::QueueFamilyProperties>       _queue_families;
+        vk::Instance                                 _instance;
+        vk::PhysicalDevice                           _physical_device;
     };
 }
 
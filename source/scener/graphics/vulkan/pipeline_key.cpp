@@ -0,0 +1,75 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/graphics/vulkan/pipeline_key.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+#include "scener/graphics/vulkan/shader.hpp"
+
+namespace scener::graphics::vulkan
+{
+    bool pipeline_key::operator==(const pipeline_key& key) const noexcept
+    {
+        const auto same_shader = [] (const std::shared_ptr<shader>& lhs, const std::shared_ptr<shader>& rhs) -> bool {
+            return lhs == rhs
+                || (lhs->stage()       == rhs->stage()
+                 && lhs->entry_point() == rhs->entry_point()
+                 && lhs->buffer()      == rhs->buffer());
+        };
+
+        return topology        == key.topology
+            && sample_shading  == key.sample_shading
+            && affine_palette  == key.affine_palette
+            && skinned         == key.skinned
+            && texture_table   == key.texture_table
+            && texture_count   == key.texture_count
+            && blend_constants == key.blend_constants
+            && color_blend     == key.color_blend
+            && depth_stencil   == key.depth_stencil
+            && rasterizer      == key.rasterizer
+            && bindings        == key.bindings
+            && attributes      == key.attributes
+            && std::equal(shaders.begin(), shaders.end(), key.shaders.begin(), key.shaders.end(), same_shader);
+    }
+
+    bool pipeline_key::operator!=(const pipeline_key& key) const noexcept
+    {
+        return !(*this == key);
+    }
+}
+
+namespace std
+{
+    std::size_t hash<scener::graphics::vulkan::pipeline_key>::operator()(const scener::graphics::vulkan::pipeline_key& key) const noexcept
+    {
+        std::size_t seed = 0;
+
+        const auto combine = [&seed] (std::size_t value) -> void {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+
+        // The remaining states rarely differ between the pipelines of a device, equality tells them apart
+        for (const auto& shader : key.shaders)
+        {
+            const auto& code = shader->buffer();
+
+            combine(std::hash<std::string_view>()({ reinterpret_cast<const char*>(code.data()), code.size() }));
+        }
+
+        for (const auto& attribute : key.attributes)
+        {
+            combine(std::hash<std::uint32_t>()(attribute.location));
+            combine(static_cast<std::size_t>(attribute.format));
+            combine(std::hash<std::uint32_t>()(attribute.offset));
+        }
+
+        combine(static_cast<std::size_t>(key.topology));
+        combine(std::hash<bool>()(key.skinned));
+        combine(std::hash<bool>()(key.texture_table));
+        combine(std::hash<std::uint32_t>()(key.texture_count));
+
+        return seed;
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_VULKAN_PIPELINE_KEY_HPP
+#define SCENER_GRAPHICS_VULKAN_PIPELINE_KEY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace scener::graphics::vulkan
+{
+    class shader;
+
+    /// The state a graphics pipeline is created from; mesh parts with equal keys share a single pipeline.
+    struct pipeline_key final
+    {
+    public:
+        /// The shaders of the effect pass, compared by stage, entry point and code.
+        std::vector<std::shared_ptr<shader>>             shaders         { };
+        /// The vertex buffer and per-instance stream bindings.
+        std::vector<vk::VertexInputBindingDescription>   bindings        { };
+        /// The vertex attributes of every binding.
+        std::vector<vk::VertexInputAttributeDescription> attributes      { };
+        /// The primitive topology.
+        vk::PrimitiveTopology                            topology        { vk::PrimitiveTopology::eTriangleList };
+        /// The color blend state of the single color attachment.
+        vk::PipelineColorBlendAttachmentState            color_blend     { };
+        /// The color blend constants.
+        std::array<float, 4>                             blend_constants { };
+        /// The depth stencil state.
+        vk::PipelineDepthStencilStateCreateInfo          depth_stencil   { };
+        /// The rasterizer state.
+        vk::PipelineRasterizationStateCreateInfo         rasterizer      { };
+        /// Indicates whether sample shading is enabled.
+        bool                                             sample_shading  { false };
+        /// Indicates whether the skinning shaders read an affine bone palette, through specialization constant 0.
+        bool                                             affine_palette  { false };
+        /// Indicates whether the pipeline reads the bone palette.
+        bool                                             skinned         { false };
+        /// Indicates whether the pipeline samples its textures from the bindless texture table.
+        bool                                             texture_table   { false };
+        /// The number of combined image samplers bound to the pipeline descriptor set.
+        std::uint32_t                                    texture_count   { 0 };
+
+    public:
+        bool operator==(const pipeline_key& key) const noexcept;
+        bool operator!=(const pipeline_key& key) const noexcept;
+    };
+}
+
+namespace std
+{
+    /// Hashes pipeline keys, so devices can share a single pipeline object between identical states.
+    template <>
+    struct hash<scener::graphics::vulkan::pipeline_key>
+    {
+        std::size_t operator()(const scener::graphics::vulkan::pipeline_key& key) const noexcept;
+    };
+}
+
+#endif // SCENER_GRAPHICS_VULKAN_PIPELINE_KEY_HPP
@@ -7,11 +7,15 @@
 
 namespace scener::graphics::vulkan
 {
-    shader::shader(const std::string& name, shader_stage stage, const std::vector<std::uint8_t>& buffer) noexcept
-        : _name        { name }
-        , _entry_point { "main" }
-        , _stage       { stage }
-        , _buffer      { buffer }
+    shader::shader(const std::string&               name
+                 , shader_stage                     stage
+                 , const std::vector<std::uint8_t>& buffer
+                 , bool                             texture_table) noexcept
+        : _name          { name }
+        , _entry_point   { "main" }
+        , _stage         { stage }
+        , _buffer        { buffer }
+        , _texture_table { texture_table }
     {
     }
 
@@ -34,4 +38,9 @@ namespace scener::graphics::vulkan
     {
         return _buffer;
     }
+
+    bool shader::uses_texture_table() const noexcept
+    {
+        return _texture_table;
+    }
 }
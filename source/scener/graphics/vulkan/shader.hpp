@@ -20,7 +20,11 @@ namespace scener::graphics::vulkan
         /// \param name the shader name.
         /// \param type the shader stage.
         /// \param buffer the compiled shader contents.
-        shader(const std::string& name, shader_stage stage, const std::vector<std::uint8_t>& buffer) noexcept;
+        /// \param texture_table a value indicating whether the shader samples from the bindless texture table.
+        shader(const std::string&               name
+             , shader_stage                     stage
+             , const std::vector<std::uint8_t>& buffer
+             , bool                             texture_table) noexcept;
 
     public:
         /// Gets the name of the shader.
@@ -39,11 +43,16 @@ namespace scener::graphics::vulkan
         /// \returns the shader contents
         const std::vector<std::uint8_t>& buffer() const noexcept;
 
+        /// Gets a value indicating whether the shader samples from the bindless texture table.
+        /// \returns true if the shader was compiled for the bindless texture table; false otherwise.
+        bool uses_texture_table() const noexcept;
+
     private:
         std::string               _name;
         std::string               _entry_point;
         shader_stage              _stage;
         std::vector<std::uint8_t> _buffer;
+        bool                      _texture_table;
     };
 }
 
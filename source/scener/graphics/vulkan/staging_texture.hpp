@@ -0,0 +1,45 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_VULKAN_STAGING_TEXTURE_HPP
+#define SCENER_GRAPHICS_VULKAN_STAGING_TEXTURE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "scener/graphics/vulkan/vulkan_memory_allocator.hpp"
+
+namespace scener::graphics::vulkan
+{
+    /// A chain of texture mipmaps copied into a host visible staging buffer, ready to be uploaded.
+    struct staging_texture
+    {
+    public:
+        /// The texture format.
+        vk::Format format { vk::Format::eUndefined };
+        /// The width, in pixels, of the first staged mipmap.
+        std::uint32_t width { 0 };
+        /// The height, in pixels, of the first staged mipmap.
+        std::uint32_t height { 0 };
+        /// The index, in the source surface, of the first staged mipmap.
+        std::uint32_t base_level { 0 };
+        /// The number of staged mipmaps per layer.
+        std::uint32_t level_count { 0 };
+        /// The number of array layers, six per cube for cube maps.
+        std::uint32_t layer_count { 1 };
+        /// Indicates whether the layers are cube map faces.
+        bool cubemap { false };
+        /// The size, in bytes, of the staged data.
+        vk::DeviceSize size { 0 };
+        /// One copy region per staged mipmap and layer.
+        std::vector<vk::BufferImageCopy> regions { };
+        /// The staging buffer.
+        vk::Buffer buffer { };
+        /// The staging buffer memory.
+        VmaAllocation allocation { };
+    };
+}
+
+#endif // SCENER_GRAPHICS_VULKAN_STAGING_TEXTURE_HPP
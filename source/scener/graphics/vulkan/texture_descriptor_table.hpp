@@ -0,0 +1,29 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_GRAPHICS_VULKAN_TEXTURE_DESCRIPTOR_TABLE_HPP
+#define SCENER_GRAPHICS_VULKAN_TEXTURE_DESCRIPTOR_TABLE_HPP
+
+#include <cstdint>
+
+#include <vulkan/vulkan.hpp>
+
+namespace scener::graphics::vulkan
+{
+    /// A single, update after bind, descriptor set holding an array of combined image samplers shared by every
+    /// pipeline; shaders index it with the texture indices pushed per draw.
+    struct texture_descriptor_table
+    {
+    public:
+        /// The number of descriptors in the array.
+        std::uint32_t capacity { 0 };
+        /// The descriptor pool the set is allocated from.
+        vk::DescriptorPool descriptor_pool { };
+        /// The layout of the set, bound as set 1 by the pipelines using the table.
+        vk::DescriptorSetLayout descriptor_set_layout { };
+        /// The descriptor set.
+        vk::DescriptorSet descriptor_set { };
+    };
+}
+
+#endif // SCENER_GRAPHICS_VULKAN_TEXTURE_DESCRIPTOR_TABLE_HPP
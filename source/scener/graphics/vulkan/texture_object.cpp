@@ -3,11 +3,15 @@
 
 #include "scener/graphics/vulkan/texture_object.hpp"
 
+#include "scener/diagnostics/profiler.hpp"
+
 namespace scener::graphics::vulkan
 {
     texture_object::texture_object() noexcept
         : width           { 0 }
         , height          { 0 }
+        , base_level      { 0 }
+        , level_count     { 0 }
         , sampler         { }
         , image           { }
         , view            { }
@@ -29,5 +33,7 @@ namespace scener::graphics::vulkan
         vmaMapMemory(*allocator, allocation, &mappedData);
         memcpy(mappedData, data.data(), data.size());
         vmaUnmapMemory(*allocator, allocation);
+
+        diagnostics::profiler::add_uploaded_bytes(data.size());
     }
 }
@@ -26,6 +26,8 @@ namespace scener::graphics::vulkan
     public:
         std::uint32_t      width;
         std::uint32_t      height;
+        std::uint32_t      base_level;
+        std::uint32_t      level_count;
         vk::Sampler        sampler;
         vk::Image          image;
         vk::ImageView      view;
@@ -0,0 +1,417 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/io/async_io.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#if defined(SCENER_HAS_IO_URING)
+#include <liburing.h>
+#endif
+
+namespace scener::io
+{
+    namespace
+    {
+        // Blocking positional read, retried until the whole region is read or the end of the file is reached.
+        std::size_t read_fully(int descriptor, std::uint8_t* data, std::size_t count, std::size_t offset) noexcept
+        {
+            std::size_t readed = 0;
+
+            while (readed < count)
+            {
+                const auto result = ::pread(descriptor, data + readed, count - readed, static_cast<off_t>(offset + readed));
+
+                if (result < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (result <= 0)
+                {
+                    break;
+                }
+
+                readed += static_cast<std::size_t>(result);
+            }
+
+            return readed;
+        }
+    }
+
+    class async_io::backend
+    {
+    public:
+        virtual ~backend() = default;
+
+    public:
+        virtual bool uses_io_uring() const noexcept = 0;
+
+        virtual std::future<std::size_t> read(int descriptor, std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept = 0;
+    };
+
+    class async_io::thread_pool_backend final : public async_io::backend
+    {
+    public:
+        thread_pool_backend() noexcept
+            : _workers  { }
+            , _mutex    { }
+            , _wake     { }
+            , _queue    { }
+            , _stopping { false }
+        {
+            const auto count = std::clamp(std::thread::hardware_concurrency(), 2u, 4u);
+
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                _workers.emplace_back([this] { run(); });
+            }
+        }
+
+        ~thread_pool_backend() override
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+
+            _wake.notify_all();
+
+            std::for_each(_workers.begin(), _workers.end(), [] (auto& worker) -> void { worker.join(); });
+        }
+
+    public:
+        bool uses_io_uring() const noexcept override
+        {
+            return false;
+        }
+
+        std::future<std::size_t> read(int descriptor, std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept override
+        {
+            auto promise = std::make_shared<std::promise<std::size_t>>();
+            auto future  = promise->get_future();
+            auto data    = buffer.data();
+            auto count   = static_cast<std::size_t>(buffer.size());
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                _queue.emplace_back([=] { promise->set_value(read_fully(descriptor, data, count, offset)); });
+            }
+
+            _wake.notify_one();
+
+            return future;
+        }
+
+    private:
+        void run() noexcept
+        {
+            while (true)
+            {
+                std::function<void()> request;
+
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+
+                    _wake.wait(lock, [this] { return _stopping || !_queue.empty(); });
+
+                    if (_queue.empty())
+                    {
+                        return;
+                    }
+
+                    request = std::move(_queue.front());
+                    _queue.pop_front();
+                }
+
+                request();
+            }
+        }
+
+    private:
+        std::vector<std::thread>          _workers;
+        std::mutex                        _mutex;
+        std::condition_variable           _wake;
+        std::deque<std::function<void()>> _queue;
+        bool                              _stopping;
+    };
+
+#if defined(SCENER_HAS_IO_URING)
+    class async_io::io_uring_backend final : public async_io::backend
+    {
+    private:
+        static constexpr std::uint32_t queue_depth = 256;
+
+        struct request
+        {
+            int                        descriptor;
+            std::uint8_t*              data;
+            std::size_t                offset;
+            std::size_t                count;
+            std::size_t                readed;
+            std::promise<std::size_t>  promise;
+        };
+
+    public:
+        io_uring_backend() noexcept
+            : _ring       { }
+            , _mutex      { }
+            , _completion { }
+            , _requests   { }
+            , _valid      { false }
+            , _failed     { false }
+        {
+            _valid = (io_uring_queue_init(queue_depth, &_ring, 0) == 0);
+
+            if (_valid)
+            {
+                _completion = std::thread([this] { run(); });
+            }
+        }
+
+        ~io_uring_backend() override
+        {
+            if (!_valid)
+            {
+                return;
+            }
+
+            // A nop without user data tells the completion thread to stop once the pending requests are done
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                if (!_failed)
+                {
+                    auto sqe = acquire_sqe();
+
+                    io_uring_prep_nop(sqe);
+                    io_uring_sqe_set_data(sqe, nullptr);
+                    io_uring_submit(&_ring);
+                }
+            }
+
+            _completion.join();
+
+            if (!_failed)
+            {
+                io_uring_queue_exit(&_ring);
+            }
+        }
+
+    public:
+        bool valid() const noexcept
+        {
+            return _valid;
+        }
+
+        bool uses_io_uring() const noexcept override
+        {
+            return true;
+        }
+
+        std::future<std::size_t> read(int descriptor, std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept override
+        {
+            auto instance = new request { descriptor, buffer.data(), offset, static_cast<std::size_t>(buffer.size()), 0, { } };
+            auto future   = instance->promise.get_future();
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                if (!_failed)
+                {
+                    _requests.push_back(instance);
+
+                    submit(instance);
+
+                    return future;
+                }
+            }
+
+            // The ring is no longer usable, serve the request on the calling thread
+            instance->promise.set_value(read_fully(descriptor, instance->data, instance->count, offset));
+
+            delete instance;
+
+            return future;
+        }
+
+    private:
+        io_uring_sqe* acquire_sqe() noexcept
+        {
+            auto sqe = io_uring_get_sqe(&_ring);
+
+            // The submission queue is full, hand the queued entries to the kernel and retry
+            while (sqe == nullptr)
+            {
+                io_uring_submit(&_ring);
+                std::this_thread::yield();
+                sqe = io_uring_get_sqe(&_ring);
+            }
+
+            return sqe;
+        }
+
+        // Must be called with the mutex held.
+        void submit(request* instance) noexcept
+        {
+            auto sqe = acquire_sqe();
+
+            io_uring_prep_read(sqe
+                             , instance->descriptor
+                             , instance->data + instance->readed
+                             , static_cast<unsigned>(instance->count - instance->readed)
+                             , instance->offset + instance->readed);
+            io_uring_sqe_set_data(sqe, instance);
+            io_uring_submit(&_ring);
+        }
+
+        // Must be called with the mutex held.
+        void complete(request* instance) noexcept
+        {
+            instance->promise.set_value(instance->readed);
+
+            _requests.erase(std::find(_requests.begin(), _requests.end(), instance));
+
+            delete instance;
+        }
+
+        void run() noexcept
+        {
+            bool stopping = false;
+
+            while (true)
+            {
+                io_uring_cqe* cqe    = nullptr;
+                const auto    status = io_uring_wait_cqe(&_ring, &cqe);
+
+                if (status == -EINTR)
+                {
+                    continue;
+                }
+                if (status < 0)
+                {
+                    fail();
+                    return;
+                }
+
+                auto       instance = static_cast<request*>(io_uring_cqe_get_data(cqe));
+                const auto result   = cqe->res;
+
+                io_uring_cqe_seen(&_ring, cqe);
+
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                if (instance == nullptr)
+                {
+                    stopping = true;
+                }
+                else if (result == -EINTR || result == -EAGAIN)
+                {
+                    submit(instance);
+                }
+                else if (result > 0 && instance->readed + static_cast<std::size_t>(result) < instance->count)
+                {
+                    // Short read before the end of the file, queue the remaining region
+                    instance->readed += static_cast<std::size_t>(result);
+
+                    submit(instance);
+                }
+                else
+                {
+                    instance->readed += static_cast<std::size_t>(std::max(result, 0));
+
+                    complete(instance);
+                }
+
+                // Completions are not ordered, the stop request may arrive before the pending reads
+                if (stopping && _requests.empty())
+                {
+                    return;
+                }
+            }
+        }
+
+        void fail() noexcept
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            _failed = true;
+
+            // Tearing down the ring cancels the pending reads and waits for the ones already running, so their
+            // buffers are no longer written once the requests complete with the bytes read so far
+            io_uring_queue_exit(&_ring);
+
+            while (!_requests.empty())
+            {
+                complete(_requests.back());
+            }
+        }
+
+    private:
+        io_uring              _ring;
+        std::mutex            _mutex;
+        std::thread           _completion;
+        std::vector<request*> _requests;
+        bool                  _valid;
+        bool                  _failed;
+    };
+#endif
+
+    async_io& async_io::instance() noexcept
+    {
+        static async_io service;
+
+        return service;
+    }
+
+    async_io::async_io() noexcept
+        : _backend { nullptr }
+    {
+#if defined(SCENER_HAS_IO_URING)
+        auto uring = std::make_unique<io_uring_backend>();
+
+        // io_uring may be unavailable at runtime (old kernels, seccomp filters, ...)
+        if (uring->valid())
+        {
+            _backend = std::move(uring);
+        }
+#endif
+
+        if (_backend == nullptr)
+        {
+            _backend = std::make_unique<thread_pool_backend>();
+        }
+    }
+
+    async_io::~async_io()
+    {
+    }
+
+    bool async_io::uses_io_uring() const noexcept
+    {
+        return _backend->uses_io_uring();
+    }
+
+    std::future<std::size_t> async_io::read(int descriptor, std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept
+    {
+        if (buffer.empty())
+        {
+            std::promise<std::size_t> promise;
+
+            promise.set_value(0);
+
+            return promise.get_future();
+        }
+
+        return _backend->read(descriptor, offset, buffer);
+    }
+}
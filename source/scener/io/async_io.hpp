@@ -0,0 +1,57 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_IO_ASYNC_IO_HPP
+#define SCENER_IO_ASYNC_IO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+
+#include <gsl/span>
+
+namespace scener::io
+{
+    /// Process wide service for asynchronous positional file reads.
+    /// Requests are queued to io_uring when available (Linux, built with liburing) and otherwise served
+    /// by a small pool of threads issuing blocking pread calls.
+    class async_io final
+    {
+    public:
+        /// Gets the async_io service instance.
+        /// \returns the async_io service instance.
+        static async_io& instance() noexcept;
+
+    public:
+        /// Releases all resources being used by this async_io, waiting for the pending requests.
+        ~async_io();
+
+    public:
+        /// Gets a value indicating whether requests are being served by io_uring.
+        /// \returns true if requests are being served by io_uring; false otherwise.
+        bool uses_io_uring() const noexcept;
+
+        /// Queues a read of the given file region.
+        /// \param descriptor the file descriptor to read from; must remain open until the request completes.
+        /// \param offset the file offset, in bytes, where the read starts.
+        /// \param buffer the destination of the data; must remain valid until the request completes.
+        /// \returns a future holding the number of bytes read, less than the buffer size if the end of the file
+        ///          is reached or an error occurs.
+        std::future<std::size_t> read(int descriptor, std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept;
+
+    private:
+        async_io() noexcept;
+        async_io(const async_io& service) = delete;
+        async_io& operator=(const async_io& service) = delete;
+
+    private:
+        class backend;
+        class thread_pool_backend;
+        class io_uring_backend;
+
+        std::unique_ptr<backend> _backend;
+    };
+}
+
+#endif // SCENER_IO_ASYNC_IO_HPP
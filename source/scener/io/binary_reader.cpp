@@ -3,31 +3,56 @@
 
 #include "scener/io/binary_reader.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 
 #include "scener/io/stream.hpp"
 
 namespace scener::io
 {
-    binary_reader::binary_reader(io::stream& stream) noexcept
-        : _stream { stream }
+    binary_reader::binary_reader(io::stream& stream, io::byte_order order, std::size_t buffer_size) noexcept
+        : _stream          { stream }
+        , _byte_order      { order }
+        , _buffer          ( std::max<std::size_t>(buffer_size, sizeof(std::uint64_t)) )
+        , _buffer_position { 0 }
+        , _buffer_length   { 0 }
     {
     }
 
     stream& binary_reader::base_stream() noexcept
     {
+        // Give back the bytes read ahead, so the stream position matches the reader position
+        const auto unread = _buffer_length - _buffer_position;
+
+        if (unread != 0 && _stream.can_seek())
+        {
+            _stream.seek(_stream.position() - unread, std::ios::beg);
+        }
+
+        _buffer_position = 0;
+        _buffer_length   = 0;
+
         return _stream;
     }
 
+    io::byte_order binary_reader::byte_order() const noexcept
+    {
+        return _byte_order;
+    }
+
     void binary_reader::close() noexcept
     {
+        _buffer_position = 0;
+        _buffer_length   = 0;
+
         _stream.close();
     }
 
     template<>
     char16_t binary_reader::read() noexcept
     {
-        std::uint32_t buffer = _stream.read_byte();
+        std::uint32_t buffer = read_scalar<std::uint8_t>();
 
         // http://xbox.create.msdn.com/en-US/sample/xnb_format
         // Decode UTF-8.
@@ -45,7 +70,7 @@ namespace scener::io
             while (--byte_count != 0)
             {
                 buffer <<= 6;
-                buffer  |= _stream.read_byte() & 0x3F;
+                buffer  |= read_scalar<std::uint8_t>() & 0x3F;
             }
         }
 
@@ -64,126 +89,77 @@ namespace scener::io
     template<>
     bool binary_reader::read() noexcept
     {
-        return static_cast<bool>(_stream.read_byte());
+        return static_cast<bool>(read_scalar<std::uint8_t>());
     }
 
     template <>
     std::int8_t binary_reader::read() noexcept
     {
-        std::int8_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::int8_t>();
     }
 
     template <>
     std::uint8_t binary_reader::read() noexcept
     {
-        std::uint8_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::uint8_t>();
     }
 
     template <>
     std::int16_t binary_reader::read() noexcept
     {
-        std::int16_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::int16_t>();
     }
 
     template <>
     std::uint16_t binary_reader::read() noexcept
     {
-        std::uint16_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::uint16_t>();
     }
 
     template <>
     std::int32_t binary_reader::read() noexcept
     {
-        std::int32_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::int32_t>();
     }
 
     template <>
     std::uint32_t binary_reader::read() noexcept
     {
-        std::uint32_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::uint32_t>();
     }
 
     template <>
     std::int64_t binary_reader::read() noexcept
     {
-        std::int64_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::int64_t>();
     }
 
     template <>
     std::uint64_t binary_reader::read() noexcept
     {
-        std::uint64_t buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<std::uint64_t>();
     }
 
     template <>
     float binary_reader::read() noexcept
     {
-        float buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<float>();
     }
 
     template <>
     double binary_reader::read() noexcept
     {
-        double buffer;
-
-        _stream.read(reinterpret_cast<char*>(&buffer), 0, sizeof buffer);
-
-        return buffer;
+        return read_scalar<double>();
     }
 
     std::int32_t binary_reader::peek_char() noexcept
     {
-        std::int32_t next_char = -1;
-
-        if (_stream.can_seek())
+        if (_buffer_position == _buffer_length && fill_buffer() == 0)
         {
-            auto position = _stream.position();
-
-            if (position != _stream.length())
-            {
-                next_char = _stream.read_byte();
-
-                _stream.seek(position, std::ios::beg);
-            }
+            return -1;
         }
 
-        return next_char;
+        return _buffer[_buffer_position];
     }
 
     std::uint32_t binary_reader::read_7_bit_encoded_int() noexcept
@@ -205,7 +181,7 @@ namespace scener::io
     std::vector<std::uint8_t> binary_reader::read_bytes(std::size_t count) noexcept
     {
         auto buffer = std::vector<std::uint8_t>(count, 0);
-        auto readed = _stream.read(reinterpret_cast<char*>(&buffer[0]), 0, count);
+        auto readed = read_raw(buffer.data(), count);
 
         if (readed < count)
         {
@@ -214,4 +190,66 @@ namespace scener::io
 
         return buffer;
     }
+
+    std::size_t binary_reader::read_raw(void* data, std::size_t count) noexcept
+    {
+        auto        target = static_cast<std::uint8_t*>(data);
+        std::size_t readed = 0;
+
+        while (readed < count)
+        {
+            const auto available = _buffer_length - _buffer_position;
+
+            if (available != 0)
+            {
+                const auto chunk = std::min(available, count - readed);
+
+                std::memcpy(target + readed, _buffer.data() + _buffer_position, chunk);
+
+                _buffer_position += chunk;
+                readed           += chunk;
+            }
+            else if (count - readed >= _buffer.size())
+            {
+                // Large requests bypass the buffer and go straight into the destination
+                auto remaining = count - readed;
+
+                if (_stream.can_seek())
+                {
+                    remaining = std::min(remaining, _stream.length() - _stream.position());
+                }
+
+                const auto chunk = (remaining == 0) ? 0 : _stream.read(reinterpret_cast<char*>(target), readed, remaining);
+
+                if (chunk == 0)
+                {
+                    break;
+                }
+
+                readed += chunk;
+            }
+            else if (fill_buffer() == 0)
+            {
+                break;
+            }
+        }
+
+        return readed;
+    }
+
+    std::size_t binary_reader::fill_buffer() noexcept
+    {
+        auto count = _buffer.size();
+
+        // Never request past the end, streams are not required to support short reads
+        if (_stream.can_seek())
+        {
+            count = std::min(count, _stream.length() - _stream.position());
+        }
+
+        _buffer_position = 0;
+        _buffer_length   = (count == 0) ? 0 : _stream.read(reinterpret_cast<char*>(_buffer.data()), 0, count);
+
+        return _buffer_length;
+    }
 }
@@ -4,29 +4,50 @@
 #ifndef SCENER_IO_BINARY_READER_HPP
 #define SCENER_IO_BINARY_READER_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 #include <vector>
 
+#include <gsl/gsl>
+
+#include "scener/io/byte_order.hpp"
+
 namespace scener::io
 {
     class stream;
 
     /// Reads primitive data types as binary values in a specific encoding.
+    /// Data is read from the underlying stream in blocks, so the stream position may be ahead of the reader
+    /// position until base_stream is called.
     class binary_reader final
     {
+    public:
+        /// Default size, in bytes, of the read buffer.
+        static constexpr std::size_t default_buffer_size = 16 * 1024;
+
     public:
         /// Initializes a new instance of the binary_reader class with the given stream.
         /// \param stream the input stream.
-        binary_reader(io::stream& stream) noexcept;
+        /// \param order the byte order of the values stored in the stream.
+        /// \param buffer_size the size, in bytes, of the read buffer.
+        binary_reader(io::stream&    stream
+                    , io::byte_order order       = io::byte_order::little_endian
+                    , std::size_t    buffer_size = default_buffer_size) noexcept;
 
         /// Releases all resources being used by this binary_reader.
         ~binary_reader() = default;
 
     public:
-        /// Gets the underliying Stream.
+        /// Gets the underliying Stream, positioned at the next byte to be read by this reader.
         /// \returns the underliying Stream.
         stream& base_stream() noexcept;
 
+        /// Gets the byte order of the values stored in the stream.
+        /// \returns the byte order of the values stored in the stream.
+        io::byte_order byte_order() const noexcept;
+
         /// Closes the current reader and the underlying stream.
         void close() noexcept;
 
@@ -47,13 +68,78 @@ namespace scener::io
         /// \returns the data read from the underlying stream.
         std::vector<std::uint8_t> read_bytes(std::size_t count) noexcept;
 
+        /// Reads an array of values with a single copy, converting them to the native byte order when needed.
+        /// Compound types (e.g. matrices) are converted per Scalar component.
+        /// \param values the destination of the values being read.
+        /// \returns the number of values read.
+        template <typename T, typename Scalar = T>
+        std::size_t read_into(const gsl::span<T>& values) noexcept
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "read_into requires trivially copyable types");
+            static_assert(std::is_arithmetic<Scalar>::value, "the component type must be arithmetic");
+            static_assert(sizeof(T) % sizeof(Scalar) == 0, "the type size must be a multiple of the component size");
+
+            const auto readed = read_raw(values.data(), values.size() * sizeof(T)) / sizeof(T);
+
+            if (_byte_order != io::byte_order::native && sizeof(Scalar) > 1)
+            {
+                reverse_byte_order<sizeof(Scalar)>(values.data(), readed * (sizeof(T) / sizeof(Scalar)));
+            }
+
+            return readed;
+        }
+
+        /// Reads an array of values with a single copy, converting them to the native byte order when needed.
+        /// \param count the number of values to read.
+        /// \returns the values read from the underlying stream.
+        template <typename T, typename Scalar = T>
+        std::vector<T> read_span(std::size_t count) noexcept
+        {
+            std::vector<T> values(count);
+
+            values.resize(read_into<T, Scalar>(gsl::span<T>(values)));
+
+            return values;
+        }
+
+    private:
+        template <typename T>
+        inline T read_scalar() noexcept
+        {
+            T value { };
+
+            if (_buffer_length - _buffer_position >= sizeof(T))
+            {
+                std::memcpy(&value, _buffer.data() + _buffer_position, sizeof(T));
+                _buffer_position += sizeof(T);
+            }
+            else
+            {
+                read_raw(&value, sizeof(T));
+            }
+
+            if (_byte_order != io::byte_order::native && sizeof(T) > 1)
+            {
+                reverse_byte_order<sizeof(T)>(&value, 1);
+            }
+
+            return value;
+        }
+
+        std::size_t read_raw(void* data, std::size_t count) noexcept;
+        std::size_t fill_buffer() noexcept;
+
     private:
         binary_reader() = delete;
         binary_reader(const binary_reader& reader) = delete;
         binary_reader& operator=(const binary_reader& reader) = delete;
 
     private:
-        stream& _stream;
+        stream&                   _stream;
+        io::byte_order            _byte_order;
+        std::vector<std::uint8_t> _buffer;
+        std::size_t               _buffer_position;
+        std::size_t               _buffer_length;
     };
 }
 
@@ -0,0 +1,197 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/io/binary_writer.hpp"
+
+#include <string>
+
+#include "scener/io/stream.hpp"
+
+namespace scener::io
+{
+    binary_writer::binary_writer(io::stream& stream, io::byte_order order, std::size_t buffer_size) noexcept
+        : _stream        { stream }
+        , _byte_order    { order }
+        , _buffer        ( std::max<std::size_t>(buffer_size, sizeof(std::uint64_t)) )
+        , _buffer_length { 0 }
+    {
+    }
+
+    binary_writer::~binary_writer()
+    {
+        flush_buffer();
+    }
+
+    stream& binary_writer::base_stream() noexcept
+    {
+        flush_buffer();
+
+        return _stream;
+    }
+
+    io::byte_order binary_writer::byte_order() const noexcept
+    {
+        return _byte_order;
+    }
+
+    void binary_writer::close() noexcept
+    {
+        flush();
+
+        _stream.close();
+    }
+
+    void binary_writer::flush() noexcept
+    {
+        flush_buffer();
+
+        _stream.flush();
+    }
+
+    template<>
+    void binary_writer::write(const char16_t& value) noexcept
+    {
+        // Encode UTF-8, mirrors binary_reader::read<char16_t>
+        const std::uint32_t code_point = value;
+
+        if (code_point < 0x80)
+        {
+            write_scalar<std::uint8_t>(code_point);
+        }
+        else if (code_point < 0x800)
+        {
+            write_scalar<std::uint8_t>(0xC0 | (code_point >> 6));
+            write_scalar<std::uint8_t>(0x80 | (code_point & 0x3F));
+        }
+        else
+        {
+            write_scalar<std::uint8_t>(0xE0 | (code_point >> 12));
+            write_scalar<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+            write_scalar<std::uint8_t>(0x80 | (code_point & 0x3F));
+        }
+    }
+
+    template<>
+    void binary_writer::write(const std::string& value) noexcept
+    {
+        write_7_bit_encoded_int(static_cast<std::uint32_t>(value.size()));
+        write_raw(reinterpret_cast<const std::uint8_t*>(value.data()), value.size());
+    }
+
+    template<>
+    void binary_writer::write(const bool& value) noexcept
+    {
+        write_scalar<std::uint8_t>(value ? 1 : 0);
+    }
+
+    template <>
+    void binary_writer::write(const std::int8_t& value) noexcept
+    {
+        write_scalar<std::int8_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const std::uint8_t& value) noexcept
+    {
+        write_scalar<std::uint8_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const std::int16_t& value) noexcept
+    {
+        write_scalar<std::int16_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const std::uint16_t& value) noexcept
+    {
+        write_scalar<std::uint16_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const std::int32_t& value) noexcept
+    {
+        write_scalar<std::int32_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const std::uint32_t& value) noexcept
+    {
+        write_scalar<std::uint32_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const std::int64_t& value) noexcept
+    {
+        write_scalar<std::int64_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const std::uint64_t& value) noexcept
+    {
+        write_scalar<std::uint64_t>(value);
+    }
+
+    template <>
+    void binary_writer::write(const float& value) noexcept
+    {
+        write_scalar<float>(value);
+    }
+
+    template <>
+    void binary_writer::write(const double& value) noexcept
+    {
+        write_scalar<double>(value);
+    }
+
+    void binary_writer::write_7_bit_encoded_int(std::uint32_t value) noexcept
+    {
+        while (value >= 0x80)
+        {
+            write_scalar<std::uint8_t>(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+
+        write_scalar<std::uint8_t>(static_cast<std::uint8_t>(value));
+    }
+
+    void binary_writer::write_bytes(const gsl::span<const std::uint8_t>& buffer) noexcept
+    {
+        write_raw(buffer.data(), buffer.size());
+    }
+
+    void binary_writer::write_raw(const std::uint8_t* data, std::size_t count) noexcept
+    {
+        // Small writes are coalesced, large ones go straight to the stream
+        if (count <= _buffer.size() - _buffer_length)
+        {
+            std::memcpy(_buffer.data() + _buffer_length, data, count);
+
+            _buffer_length += count;
+            return;
+        }
+
+        flush_buffer();
+
+        if (count >= _buffer.size())
+        {
+            _stream.write(reinterpret_cast<const char*>(data), 0, count);
+        }
+        else
+        {
+            std::memcpy(_buffer.data(), data, count);
+
+            _buffer_length = count;
+        }
+    }
+
+    void binary_writer::flush_buffer() noexcept
+    {
+        if (_buffer_length != 0)
+        {
+            _stream.write(reinterpret_cast<const char*>(_buffer.data()), 0, _buffer_length);
+
+            _buffer_length = 0;
+        }
+    }
+}
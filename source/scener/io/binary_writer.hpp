@@ -0,0 +1,149 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_IO_BINARY_WRITER_HPP
+#define SCENER_IO_BINARY_WRITER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "scener/io/byte_order.hpp"
+
+namespace scener::io
+{
+    class stream;
+
+    /// Writes primitive types in binary to a stream.
+    /// Data is accumulated in an internal buffer and written to the underlying stream in blocks, when the buffer
+    /// is full, on flush, or when the writer is destroyed.
+    class binary_writer final
+    {
+    public:
+        /// Default size, in bytes, of the write buffer.
+        static constexpr std::size_t default_buffer_size = 16 * 1024;
+
+    public:
+        /// Initializes a new instance of the binary_writer class with the given stream.
+        /// \param stream the output stream.
+        /// \param order the byte order used to store the values in the stream.
+        /// \param buffer_size the size, in bytes, of the write buffer.
+        binary_writer(io::stream&    stream
+                    , io::byte_order order       = io::byte_order::little_endian
+                    , std::size_t    buffer_size = default_buffer_size) noexcept;
+
+        /// Releases all resources being used by this binary_writer, writing any buffered data.
+        ~binary_writer();
+
+    public:
+        /// Gets the underliying stream, with all the buffered data written to it.
+        /// \returns the underliying stream.
+        stream& base_stream() noexcept;
+
+        /// Gets the byte order used to store the values in the stream.
+        /// \returns the byte order used to store the values in the stream.
+        io::byte_order byte_order() const noexcept;
+
+        /// Closes the current writer and the underlying stream.
+        void close() noexcept;
+
+        /// Clears all buffers for the current writer and causes any buffered data to be written to the underlying
+        /// device.
+        void flush() noexcept;
+
+        /// Writes the given value to the current stream.
+        /// \param value the value to write.
+        template <typename T>
+        void write(const T& value) noexcept;
+
+        /// Writes a 32-bit integer in a compressed format.
+        /// \param value the 32-bit integer to be written.
+        void write_7_bit_encoded_int(std::uint32_t value) noexcept;
+
+        /// Writes the given bytes to the current stream.
+        /// \param buffer the bytes to write.
+        void write_bytes(const gsl::span<const std::uint8_t>& buffer) noexcept;
+
+        /// Writes an array of values with a single copy, converting them to the writer byte order when needed.
+        /// Compound types (e.g. matrices) are converted per Scalar component.
+        /// \param values the values to write.
+        template <typename T, typename Scalar = T>
+        void write_span(const gsl::span<const T>& values) noexcept
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "write_span requires trivially copyable types");
+            static_assert(std::is_arithmetic<Scalar>::value, "the component type must be arithmetic");
+            static_assert(sizeof(T) % sizeof(Scalar) == 0, "the type size must be a multiple of the component size");
+
+            auto       source = reinterpret_cast<const std::uint8_t*>(values.data());
+            const auto size   = static_cast<std::size_t>(values.size()) * sizeof(T);
+
+            if (_byte_order == io::byte_order::native || sizeof(Scalar) == 1)
+            {
+                write_raw(source, size);
+                return;
+            }
+
+            // Values are converted in place, inside the write buffer, a buffer worth of components at a time
+            const auto chunk_size = (_buffer.size() / sizeof(Scalar)) * sizeof(Scalar);
+
+            for (std::size_t written = 0; written < size; )
+            {
+                if (_buffer.size() - _buffer_length < sizeof(Scalar))
+                {
+                    flush_buffer();
+                }
+
+                const auto available = ((_buffer.size() - _buffer_length) / sizeof(Scalar)) * sizeof(Scalar);
+                const auto count     = std::min({ available, chunk_size, size - written });
+                const auto target    = _buffer.data() + _buffer_length;
+
+                std::memcpy(target, source + written, count);
+
+                reverse_byte_order<sizeof(Scalar)>(target, count / sizeof(Scalar));
+
+                _buffer_length += count;
+                written        += count;
+            }
+        }
+
+    private:
+        template <typename T>
+        inline void write_scalar(T value) noexcept
+        {
+            if (_byte_order != io::byte_order::native && sizeof(T) > 1)
+            {
+                reverse_byte_order<sizeof(T)>(&value, 1);
+            }
+
+            if (_buffer.size() - _buffer_length < sizeof(T))
+            {
+                flush_buffer();
+            }
+
+            std::memcpy(_buffer.data() + _buffer_length, &value, sizeof(T));
+
+            _buffer_length += sizeof(T);
+        }
+
+        void write_raw(const std::uint8_t* data, std::size_t count) noexcept;
+        void flush_buffer() noexcept;
+
+    private:
+        binary_writer() = delete;
+        binary_writer(const binary_writer& writer) = delete;
+        binary_writer& operator=(const binary_writer& writer) = delete;
+
+    private:
+        stream&                   _stream;
+        io::byte_order            _byte_order;
+        std::vector<std::uint8_t> _buffer;
+        std::size_t               _buffer_length;
+    };
+}
+
+#endif // SCENER_IO_BINARY_WRITER_HPP
@@ -0,0 +1,65 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_IO_BYTE_ORDER_HPP
+#define SCENER_IO_BYTE_ORDER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace scener::io
+{
+    /// Defines the order in which the bytes of multi-byte values are stored.
+    enum class byte_order : std::uint32_t
+    {
+        little_endian = 0 ///< Least significant byte first.
+      , big_endian    = 1 ///< Most significant byte first.
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+      , native        = big_endian    ///< Byte order of the host.
+#else
+      , native        = little_endian ///< Byte order of the host.
+#endif
+    };
+
+    /// Reverses the byte order of each element of the given array.
+    /// \param data the elements to convert, in place.
+    /// \param count the number of elements.
+    template <std::size_t Size>
+    inline void reverse_byte_order(void* data, std::size_t count) noexcept
+    {
+        auto bytes = static_cast<std::uint8_t*>(data);
+
+        for (std::size_t i = 0; i < count; ++i, bytes += Size)
+        {
+            if constexpr (Size == sizeof(std::uint16_t))
+            {
+                std::uint16_t value;
+                std::memcpy(&value, bytes, Size);
+                value = __builtin_bswap16(value);
+                std::memcpy(bytes, &value, Size);
+            }
+            else if constexpr (Size == sizeof(std::uint32_t))
+            {
+                std::uint32_t value;
+                std::memcpy(&value, bytes, Size);
+                value = __builtin_bswap32(value);
+                std::memcpy(bytes, &value, Size);
+            }
+            else if constexpr (Size == sizeof(std::uint64_t))
+            {
+                std::uint64_t value;
+                std::memcpy(&value, bytes, Size);
+                value = __builtin_bswap64(value);
+                std::memcpy(bytes, &value, Size);
+            }
+            else
+            {
+                std::reverse(bytes, bytes + Size);
+            }
+        }
+    }
+}
+
+#endif // SCENER_IO_BYTE_ORDER_HPP
@@ -4,6 +4,12 @@
 #ifndef SCENER_IO_FILE_HPP
 #define SCENER_IO_FILE_HPP
 
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <gsl/assert>
 
 #include "scener/io/binary_reader.hpp"
@@ -54,6 +60,52 @@ namespace scener::io
             return reader.read_bytes(stream.length());
         }
 
+        /// Opens a binary file and starts reading its contents without blocking the caller.
+        /// \param path the file to open for reading.
+        /// \returns a future holding the contents of the file; destroying it without getting the contents waits for
+        ///          the read to complete.
+        static std::future<std::vector<std::uint8_t>> read_all_bytes_async(const std::string& path) noexcept
+        {
+            Expects(exists(path));
+
+            auto state = std::make_shared<pending_read>(path);
+
+            state->pending = state->stream.read_async(0, gsl::span<std::uint8_t>(state->buffer));
+
+            return std::async(std::launch::deferred, [state] () -> std::vector<std::uint8_t>
+            {
+                state->buffer.resize(state->pending.get());
+                state->stream.close();
+
+                return std::move(state->buffer);
+            });
+        }
+
+    private:
+        /// Owns the file and the destination buffer of an asynchronous read; they are only released once the
+        /// read has completed, even when the future returned to the caller is discarded.
+        struct pending_read final
+        {
+            pending_read(const std::string& path) noexcept
+                : stream  { path }
+                , buffer  ( stream.length() )
+                , pending { }
+            {
+            }
+
+            ~pending_read()
+            {
+                if (pending.valid())
+                {
+                    pending.wait();
+                }
+            }
+
+            file_stream               stream;
+            std::vector<std::uint8_t> buffer;
+            std::future<std::size_t>  pending;
+        };
+
     private:
         file() = delete;
         file(const file& file) = delete;
@@ -6,11 +6,20 @@
 #include <locale>
 #include <codecvt>
 
+#include <gsl/gsl>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "scener/io/async_io.hpp"
+
 namespace scener::io
 {
     file_stream::file_stream(const std::string& path, const std::ios::openmode& mode) noexcept
-        : _stream { path, mode }
-        , _mode   { mode }
+        : _path       { path }
+        , _stream     { path, mode }
+        , _mode       { mode }
+        , _descriptor { -1 }
     {
         if (_stream.is_open() && _stream.good())
         {
@@ -18,6 +27,11 @@ namespace scener::io
         }
     }
 
+    file_stream::~file_stream()
+    {
+        close();
+    }
+
     bool file_stream::can_read() const noexcept
     {
         return ((_mode & std::ios::in) == std::ios::in && _stream.is_open() && _stream.good());
@@ -54,6 +68,11 @@ namespace scener::io
         {
             _stream.close();
         }
+        if (_descriptor != -1)
+        {
+            ::close(_descriptor);
+            _descriptor = -1;
+        }
     }
 
     std::int32_t file_stream::read_byte() noexcept
@@ -82,10 +101,50 @@ namespace scener::io
         return _stream.gcount();
     }
 
+    void file_stream::write_byte(std::uint8_t value) noexcept
+    {
+        write(reinterpret_cast<const char*>(&value), 0, sizeof value);
+    }
+
+    void file_stream::write(const char* buffer, std::size_t offset, std::size_t count) noexcept
+    {
+        Expects(can_write());
+
+        _stream.write(buffer + offset, count);
+    }
+
+    void file_stream::flush() noexcept
+    {
+        if (_stream.is_open())
+        {
+            _stream.flush();
+        }
+    }
+
     std::size_t file_stream::seek(std::size_t offset, std::ios::seekdir origin) noexcept
     {
         _stream.seekg(offset, origin);
 
         return position();
     }
+
+    std::future<std::size_t> file_stream::read_async(std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept
+    {
+        // Positional reads use their own descriptor, so they neither move nor race with the fstream position
+        if (_descriptor == -1 && (_mode & std::ios::in) == std::ios::in && _stream.is_open())
+        {
+            _descriptor = ::open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+        }
+
+        if (_descriptor == -1)
+        {
+            std::promise<std::size_t> result;
+
+            result.set_value(0);
+
+            return result.get_future();
+        }
+
+        return async_io::instance().read(_descriptor, offset, buffer);
+    }
 }
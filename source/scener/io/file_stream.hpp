@@ -13,7 +13,7 @@
 
 namespace scener::io
 {
-    /// A Stream around a file, supporting read operations.
+    /// A Stream around a file, supporting read and write operations.
     class file_stream  final : public stream
     {
     public:
@@ -23,7 +23,7 @@ namespace scener::io
         file_stream(const std::string& path, const std::ios::openmode& mode = std::ios::in | std::ios::binary) noexcept;
 
         /// Releases all resources being used by this file_stream.
-        ~file_stream() override = default;
+        ~file_stream() override;
 
     public:
         /// Gets a value indicating whether the current stream supports reading.
@@ -62,20 +62,44 @@ namespace scener::io
         ///          if that number of bytes are not currently available, or zero if the end of the stream is reached.
         std::size_t read(char* buffer, std::size_t offset, std::size_t count) noexcept override;
 
+        /// Writes a byte to the current position in the stream and advances the position within the stream by one byte.
+        /// \param value the byte to write to the stream.
+        void write_byte(std::uint8_t value) noexcept override;
+
+        /// Writes a sequence of bytes to the current stream and advances the current position within this stream
+        /// by the number of bytes written.
+        /// \param buffer the data to be written.
+        /// \param offset the byte offset in buffer from which to begin copying bytes to the stream.
+        /// \param count the number of bytes to be written to the current stream.
+        void write(const char* buffer, std::size_t offset, std::size_t count) noexcept override;
+
+        /// Clears all buffers for this stream and causes any buffered data to be written to the underlying device.
+        void flush() noexcept override;
+
         /// Sets the position within the current stream.
         /// \param offset the point relative to origin from which to begin seeking.
         /// \param origin specifies the beginning, the end, or the current position as a reference point for offset.
         /// \returns the new position in the stream.
         std::size_t seek(std::size_t offset, std::ios::seekdir origin) noexcept override;
 
+        /// Queues a read of the given file region to the async_io service.
+        /// The current position of the stream is not modified, and pending reads must complete before the stream
+        /// is closed.
+        /// \param offset the file offset, in bytes, where the read starts.
+        /// \param buffer the destination of the data; must remain valid until the returned future is ready.
+        /// \returns a future holding the total number of bytes read into the buffer.
+        std::future<std::size_t> read_async(std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept override;
+
     private:
         file_stream() = delete;
         file_stream(const file_stream& stream) = delete;
         file_stream& operator=(const file_stream& stream) = delete;
 
     private:
+        std::string        _path;
         std::fstream       _stream;
         std::ios::openmode _mode;
+        int                _descriptor;
     };
 }
 
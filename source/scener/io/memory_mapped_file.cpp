@@ -0,0 +1,69 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/io/memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace scener::io
+{
+    memory_mapped_file::memory_mapped_file(const std::string& path) noexcept
+        : _data { nullptr }
+        , _size { 0 }
+    {
+        const auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (descriptor == -1)
+        {
+            return;
+        }
+
+        struct stat status = { };
+
+        if (::fstat(descriptor, &status) == 0 && status.st_size > 0)
+        {
+            auto address = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+            if (address != MAP_FAILED)
+            {
+                // The contents are read front to back once, when copied into the staging buffers
+                ::madvise(address, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+
+                _data = static_cast<const std::uint8_t*>(address);
+                _size = static_cast<std::size_t>(status.st_size);
+            }
+        }
+
+        // The mapping keeps its own reference to the file
+        ::close(descriptor);
+    }
+
+    memory_mapped_file::~memory_mapped_file()
+    {
+        if (_data != nullptr)
+        {
+            ::munmap(const_cast<std::uint8_t*>(_data), _size);
+        }
+
+        _data = nullptr;
+        _size = 0;
+    }
+
+    bool memory_mapped_file::is_open() const noexcept
+    {
+        return (_data != nullptr);
+    }
+
+    std::size_t memory_mapped_file::size() const noexcept
+    {
+        return _size;
+    }
+
+    gsl::span<const std::uint8_t> memory_mapped_file::data() const noexcept
+    {
+        return { _data, static_cast<std::ptrdiff_t>(_size) };
+    }
+}
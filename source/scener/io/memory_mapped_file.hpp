@@ -0,0 +1,50 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_IO_MEMORY_MAPPED_FILE_HPP
+#define SCENER_IO_MEMORY_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <gsl/span>
+
+namespace scener::io
+{
+    /// A read only view of a file contents mapped into the process address space; pages are loaded by the
+    /// operating system on first access instead of being copied into an intermediate buffer.
+    class memory_mapped_file final
+    {
+    public:
+        /// Initializes a new instance of the memory_mapped_file class mapping the given file.
+        /// \param path a relative or absolute path for the file to map.
+        explicit memory_mapped_file(const std::string& path) noexcept;
+
+        /// Releases all resources being used by this memory_mapped_file.
+        ~memory_mapped_file();
+
+    public:
+        /// Gets a value indicating whether the file has been mapped.
+        /// \returns true if the file has been mapped; false otherwise.
+        bool is_open() const noexcept;
+
+        /// Gets the size, in bytes, of the mapped file.
+        /// \returns the size, in bytes, of the mapped file.
+        std::size_t size() const noexcept;
+
+        /// Gets a view of the mapped file contents.
+        /// \returns a view of the mapped file contents, valid for the lifetime of this memory_mapped_file.
+        gsl::span<const std::uint8_t> data() const noexcept;
+
+    private:
+        memory_mapped_file(const memory_mapped_file& file) = delete;
+        memory_mapped_file& operator=(const memory_mapped_file& file) = delete;
+
+    private:
+        const std::uint8_t* _data;
+        std::size_t         _size;
+    };
+}
+
+#endif // SCENER_IO_MEMORY_MAPPED_FILE_HPP
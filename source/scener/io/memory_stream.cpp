@@ -5,11 +5,25 @@
 
 #include <algorithm>
 
+#include <gsl/gsl>
+
 namespace scener::io
 {
+    memory_stream::memory_stream(std::size_t capacity) noexcept
+        : _storage    ( capacity )
+        , _buffer     { _storage }
+        , _position   { 0 }
+        , _length     { 0 }
+        , _expandable { true }
+    {
+    }
+
     memory_stream::memory_stream(const gsl::span<std::uint8_t>& buffer) noexcept
-        : _buffer   { buffer }
-        , _position { _buffer.begin() }
+        : _storage    { }
+        , _buffer     { buffer }
+        , _position   { 0 }
+        , _length     { static_cast<std::size_t>(buffer.size()) }
+        , _expandable { false }
     {
     }
 
@@ -25,17 +39,27 @@ namespace scener::io
 
     bool memory_stream::can_write() const noexcept
     {
-        return false;
+        return true;
+    }
+
+    std::size_t memory_stream::capacity() const noexcept
+    {
+        return _buffer.size();
+    }
+
+    gsl::span<const std::uint8_t> memory_stream::data() const noexcept
+    {
+        return gsl::span<const std::uint8_t>(_buffer.data(), _length);
     }
 
     std::size_t memory_stream::position() noexcept
     {
-        return std::distance(_position, _buffer.begin());
+        return _position;
     }
 
     std::size_t memory_stream::length() noexcept
     {
-        return _buffer.size();
+        return _length;
     }
 
     void memory_stream::close() noexcept
@@ -53,28 +77,78 @@ namespace scener::io
 
     std::size_t memory_stream::read(char* buffer, std::size_t offset, std::size_t count) noexcept
     {
-        Ensures(_position + count <= _buffer.end());
+        Ensures(_position + count <= _length);
 
-        std::copy_n(_position, count, buffer + offset);
+        std::copy_n(_buffer.data() + _position, count, buffer + offset);
 
         _position += count;
 
         return count;
     }
 
+    void memory_stream::write_byte(std::uint8_t value) noexcept
+    {
+        write(reinterpret_cast<const char*>(&value), 0, sizeof value);
+    }
+
+    void memory_stream::write(const char* buffer, std::size_t offset, std::size_t count) noexcept
+    {
+        const auto end = _position + count;
+
+        ensure_capacity(end);
+
+        std::copy_n(buffer + offset, count, _buffer.data() + _position);
+
+        _position = end;
+        _length   = std::max(_length, end);
+    }
+
+    void memory_stream::flush() noexcept
+    {
+    }
+
     std::size_t memory_stream::seek(std::size_t offset, std::ios::seekdir origin) noexcept
     {
         Expects(origin == std::ios_base::beg || origin == std::ios_base::cur);
 
-        if (origin == std::ios_base::beg && offset < static_cast<std::size_t>(_buffer.size()))
+        if (origin == std::ios_base::beg && offset <= _length)
         {
-            _position = _buffer.begin() + offset;
+            _position = offset;
         }
-        else if (origin == std::ios_base::cur && ((_position + offset) <= _buffer.end()))
+        else if (origin == std::ios_base::cur && ((_position + offset) <= _length))
         {
             _position += offset;
         }
 
         return position();
     }
+
+    std::future<std::size_t> memory_stream::read_async(std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept
+    {
+        std::promise<std::size_t> result;
+
+        const auto count = (offset < _length) ? std::min(static_cast<std::size_t>(buffer.size()), _length - offset) : 0;
+
+        std::copy_n(_buffer.data() + offset, count, buffer.begin());
+
+        result.set_value(count);
+
+        return result.get_future();
+    }
+
+    void memory_stream::ensure_capacity(std::size_t required) noexcept
+    {
+        if (required <= static_cast<std::size_t>(_buffer.size()))
+        {
+            return;
+        }
+
+        Expects(_expandable);
+
+        // Geometric growth keeps the amortized cost of appending constant
+        const auto capacity = std::max({ required, _storage.size() * 2, std::size_t { 256 } });
+
+        _storage.resize(capacity);
+        _buffer = gsl::span<std::uint8_t>(_storage);
+    }
 }
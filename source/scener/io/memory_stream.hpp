@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include <gsl/span>
 
@@ -13,11 +14,16 @@
 
 namespace scener::io
 {
-    /// A Stream around a in memory buffer, supporting read operations.
+    /// A Stream around a in memory buffer, supporting read and write operations.
+    /// Streams created over an existing buffer have a fixed size; streams owning their buffer grow on demand.
     class memory_stream final : public stream
     {
     public:
-        /// Initializes a new instance of the memory_stream class.
+        /// Initializes a new instance of the memory_stream class with an expandable buffer.
+        /// \param capacity the initial capacity, in bytes, of the buffer.
+        explicit memory_stream(std::size_t capacity = 0) noexcept;
+
+        /// Initializes a new non-resizable instance of the memory_stream class over the given buffer.
         /// \param buffer a buffer view from which to create the current stream.
         memory_stream(const gsl::span<std::uint8_t>& buffer) noexcept;
 
@@ -37,6 +43,14 @@ namespace scener::io
         /// \returns true if the stream supports writing; false otherwise.
         bool can_write() const noexcept override;
 
+        /// Gets the number of bytes allocated for this stream.
+        /// \returns the number of bytes allocated for this stream.
+        std::size_t capacity() const noexcept;
+
+        /// Gets a view over the stream contents, from the beginning up to its length.
+        /// \returns a view over the stream contents.
+        gsl::span<const std::uint8_t> data() const noexcept;
+
         /// Gets the current position of this stream.
         /// \returns the current position of this stream.
         std::size_t position() noexcept override;
@@ -61,20 +75,45 @@ namespace scener::io
         ///          if that number of bytes are not currently available, or zero if the end of the stream is reached.
         std::size_t read(char* buffer, std::size_t offset, std::size_t count) noexcept override;
 
+        /// Writes a byte to the current position in the stream and advances the position within the stream by one byte.
+        /// \param value the byte to write to the stream.
+        void write_byte(std::uint8_t value) noexcept override;
+
+        /// Writes a sequence of bytes to the current stream and advances the current position within this stream
+        /// by the number of bytes written.
+        /// \param buffer the data to be written.
+        /// \param offset the byte offset in buffer from which to begin copying bytes to the stream.
+        /// \param count the number of bytes to be written to the current stream.
+        void write(const char* buffer, std::size_t offset, std::size_t count) noexcept override;
+
+        /// Clears all buffers for this stream and causes any buffered data to be written to the underlying device.
+        void flush() noexcept override;
+
         /// Sets the position within the current stream.
         /// \param offset the point relative to origin from which to begin seeking.
         /// \param origin specifies the beginning, the end, or the current position as a reference point for offset.
         /// \returns the new position in the stream.
         std::size_t seek(std::size_t offset, std::ios::seekdir origin) noexcept override;
 
+        /// Reads a sequence of bytes starting at the given stream offset. The data is copied immediately.
+        /// \param offset the stream offset, in bytes, where the read starts.
+        /// \param buffer the destination of the data.
+        /// \returns a ready future holding the total number of bytes read into the buffer.
+        std::future<std::size_t> read_async(std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept override;
+
+    private:
+        void ensure_capacity(std::size_t required) noexcept;
+
     private:
-        memory_stream() = delete;
         memory_stream(const memory_stream& stream) = delete;
         memory_stream& operator=(const memory_stream& stream) = delete;
 
     private:
-        gsl::span<std::uint8_t>           _buffer;
-        gsl::span<std::uint8_t>::iterator _position;
+        std::vector<std::uint8_t> _storage;
+        gsl::span<std::uint8_t>   _buffer;
+        std::size_t               _position;
+        std::size_t               _length;
+        bool                      _expandable;
     };
 }
 
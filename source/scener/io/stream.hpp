@@ -6,8 +6,11 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <ios>
 
+#include <gsl/span>
+
 namespace scener::io
 {
     /// Contract for stream implementations.
@@ -54,11 +57,52 @@ namespace scener::io
         ///          if that number of bytes are not currently available, or zero if the end of the stream is reached.
         virtual std::size_t read(char* buffer, std::size_t offset, std::size_t count) noexcept = 0;
 
+        /// Writes a byte to the current position in the stream and advances the position within the stream by one byte.
+        /// \param value the byte to write to the stream.
+        virtual void write_byte(std::uint8_t value) noexcept = 0;
+
+        /// Writes a sequence of bytes to the current stream and advances the current position within this stream
+        /// by the number of bytes written.
+        /// \param buffer the data to be written.
+        /// \param offset the byte offset in buffer from which to begin copying bytes to the stream.
+        /// \param count the number of bytes to be written to the current stream.
+        virtual void write(const char* buffer, std::size_t offset, std::size_t count) noexcept = 0;
+
+        /// Clears all buffers for this stream and causes any buffered data to be written to the underlying device.
+        virtual void flush() noexcept = 0;
+
         /// Sets the position within the current stream.
         /// \param offset the point relative to origin from which to begin seeking.
         /// \param origin specifies the beginning, the end, or the current position as a reference point for offset.
         /// \returns the new position in the stream.
         virtual std::size_t seek(std::size_t offset, std::ios::seekdir origin) noexcept = 0;
+
+        /// Reads a sequence of bytes starting at the given stream offset without blocking the caller.
+        /// The current position of the stream is not modified. The default implementation completes the read
+        /// synchronously before returning.
+        /// \param offset the stream offset, in bytes, where the read starts.
+        /// \param buffer the destination of the data; must remain valid until the returned future is ready.
+        /// \returns a future holding the total number of bytes read into the buffer.
+        virtual std::future<std::size_t> read_async(std::size_t offset, const gsl::span<std::uint8_t>& buffer) noexcept
+        {
+            std::promise<std::size_t> result;
+            std::size_t               readed = 0;
+
+            if (can_seek())
+            {
+                const auto current = position();
+
+                seek(offset, std::ios::beg);
+
+                readed = read(reinterpret_cast<char*>(buffer.data()), 0, buffer.size());
+
+                seek(current, std::ios::beg);
+            }
+
+            result.set_value(readed);
+
+            return result.get_future();
+        }
     };
 }
 
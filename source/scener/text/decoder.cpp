@@ -3,8 +3,6 @@
 
 #include "scener/text/decoder.hpp"
 
-#include <algorithm>
-
 namespace scener::text
 {
     decoder::decoder()
@@ -17,9 +15,7 @@ namespace scener::text
 
     std::size_t decoder::get_char_count(const std::uint8_t* bytes, std::size_t count, bool flush) const
     {
-        auto vbytes = std::vector<std::uint8_t>(bytes, bytes + count);
-
-        return get_char_count(vbytes, 0, count, flush);
+        return get_char_count(gsl::span<const std::uint8_t>(bytes, count), flush);
     }
 
     std::size_t decoder::get_char_count(const std::vector<std::uint8_t>& bytes
@@ -30,25 +26,6 @@ namespace scener::text
         return this->get_char_count(bytes, index, count);
     }
 
-    std::size_t decoder::get_chars(const std::uint8_t* bytes
-                                 , std::size_t         byte_count
-                                 , char16_t*           chars
-                                 , std::size_t         char_count
-                                 , bool                flush) const
-    {
-        auto vbytes = std::vector<std::uint8_t>(bytes, bytes + byte_count);
-        auto vchars = std::vector<char16_t>();
-
-        vchars.reserve(get_char_count(vbytes, 0, byte_count, flush));
-
-        auto count  = get_chars(vbytes, 0, byte_count, vchars, 0, flush);
-        auto result = ((count > char_count) ? char_count : count);
-
-        std::copy_n(vchars.begin(), result, chars);
-
-        return result;
-    }
-
     std::size_t decoder::get_chars(const std::vector<std::uint8_t>& bytes
                                  , std::size_t                      byte_index
                                  , std::size_t                      byte_count
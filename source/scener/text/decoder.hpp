@@ -8,6 +8,8 @@
 #include <cstdint>
 #include <vector>
 
+#include <gsl/span>
+
 namespace scener::text
 {
     /// Converts a sequence of encoded bytes into a set of characters.
@@ -40,16 +42,16 @@ namespace scener::text
                                          , std::size_t                      count
                                          , bool                             flush) const;
 
-        /// Decodes a sequence of bytes starting at the specified byte pointer and
-        /// any bytes in the internal buffer into a set of characters that are
-        /// stored starting at the specified character pointer.
+        /// When overridden in a derived class, decodes a sequence of bytes starting at
+        /// the specified byte pointer and any bytes in the internal buffer into a set
+        /// of characters that are stored starting at the specified character pointer.
         /// A parameter indicates whether to clear the internal state of the decoder
         /// after the conversion.
         virtual std::size_t get_chars(const std::uint8_t* bytes
                                     , std::size_t         byte_count
                                     , char16_t*           chars
                                     , std::size_t         char_count
-                                    , bool                flush) const;
+                                    , bool                flush) const = 0;
 
         /// When overridden in a derived class, decodes a sequence of bytes from the
         /// specified byte array and any bytes in the internal buffer into the specified
@@ -70,7 +72,21 @@ namespace scener::text
                                     , std::size_t                      char_index
                                     , bool                             flush) const;
 
-        /// Sets the encoder back to its initial state.
+        /// When overridden in a derived class, calculates the number of characters produced by decoding the given
+        /// bytes and any bytes in the internal buffer. A parameter indicates whether the trailing bytes of an
+        /// incomplete sequence are an error (true) or are expected to be completed by the next call (false).
+        virtual std::size_t get_char_count(const gsl::span<const std::uint8_t>& bytes, bool flush) const = 0;
+
+        /// When overridden in a derived class, decodes the given bytes and any bytes in the internal buffer into the given characters.
+        /// When flush is false the trailing bytes of an incomplete sequence are kept in the internal buffer and
+        /// decoded with the next call, allowing a stream to be decoded in chunks of any size.
+        /// \param bytes the bytes to decode.
+        /// \param chars the destination of the decoded characters.
+        /// \param flush true to clear the internal state of the decoder after the conversion; false otherwise.
+        /// \returns the number of characters written.
+        virtual std::size_t get_chars(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars, bool flush) = 0;
+
+        /// Sets the decoder back to its initial state.
         virtual void reset() = 0;
     };
 }
@@ -55,6 +55,30 @@ namespace scener::text
         return result;
     }
 
+    std::size_t encoder::get_byte_count(const std::u16string_view& chars, bool flush) const
+    {
+        auto vchars = std::vector<char16_t>(chars.begin(), chars.end());
+
+        return get_byte_count(vchars, 0, vchars.size(), flush);
+    }
+
+    std::size_t encoder::get_bytes(const std::u16string_view& chars, const gsl::span<std::uint8_t>& bytes, bool flush) const
+    {
+        auto vchars = std::vector<char16_t>(chars.begin(), chars.end());
+        auto vbytes = std::vector<std::uint8_t>(get_byte_count(vchars, 0, vchars.size(), flush), 0);
+
+        if (vbytes.size() > static_cast<std::size_t>(bytes.size()))
+        {
+            throw std::invalid_argument("bytes does not have enough capacity to accommodate the resulting bytes.");
+        }
+
+        auto count = get_bytes(vchars, 0, vchars.size(), vbytes, 0, flush);
+
+        std::copy_n(vbytes.begin(), count, bytes.begin());
+
+        return count;
+    }
+
     void encoder::reset()
     {
     }
@@ -6,8 +6,11 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
 #include <vector>
 
+#include <gsl/span>
+
 namespace scener::text
 {
     /// Converts a set of characters into a sequence of bytes.
@@ -57,6 +60,17 @@ namespace scener::text
                                     , std::size_t                  byte_index
                                     , bool                         flush) const = 0;
 
+        /// Calculates the number of bytes produced by encoding the given characters.
+        /// A parameter indicates whether to clear the internal state of the encoder after the calculation.
+        virtual std::size_t get_byte_count(const std::u16string_view& chars, bool flush) const;
+
+        /// Encodes the given characters into the given bytes.
+        /// \param chars the characters to encode.
+        /// \param bytes the destination of the encoded bytes.
+        /// \param flush true to clear the internal state of the encoder after the conversion; false otherwise.
+        /// \returns the number of bytes written.
+        virtual std::size_t get_bytes(const std::u16string_view& chars, const gsl::span<std::uint8_t>& bytes, bool flush) const;
+
         /// When overridden in a derived class, sets the encoder back to its initial
         /// state.
         virtual void reset();
@@ -3,9 +3,10 @@
 
 #include "scener/text/encoding.hpp"
 
-#include <locale>
+#include <stdexcept>
 
 #include "scener/text/utf8_encoding.hpp"
+#include "scener/text/utf8_transcoder.hpp"
 
 namespace scener::text
 {
@@ -35,18 +36,61 @@ namespace scener::text
         return target_encoding.get_bytes(chars, 0, chars.size());
     }
 
-    std::string encoding::convert(const std::u16string& source)
+    std::string encoding::convert(const std::u16string_view& source)
     {
-        std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> converter; // UTF-8 <-> UTF-16 converter
+        const auto  chars = gsl::span<const char16_t>(source.data(), source.size());
+        std::string result(utf8_transcoder::utf8_length(chars), '\0');
 
-        return converter.to_bytes(source);
+        utf8_transcoder::to_utf8(chars, gsl::span<std::uint8_t>(reinterpret_cast<std::uint8_t*>(&result[0]), result.size()));
+
+        return result;
     }
 
-    std::u16string encoding::convert(const std::string& source)
+    std::u16string encoding::convert(const std::string_view& source)
     {
-        std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> converter; // UTF-8 <-> UTF-16 converter
+        const auto bytes  = gsl::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(source.data()), source.size());
+        const auto length = utf8_transcoder::utf16_length(bytes);
+
+        if (length.status != transcode_status::ok)
+        {
+            throw std::range_error("invalid UTF-8 sequence");
+        }
+
+        std::u16string result(length.produced, u'\0');
+
+        utf8_transcoder::to_utf16(bytes, gsl::span<char16_t>(&result[0], result.size()));
+
+        return result;
+    }
+
+    std::size_t encoding::convert(const std::u16string_view& source, const gsl::span<char>& target)
+    {
+        const auto result = utf8_transcoder::to_utf8(gsl::span<const char16_t>(source.data(), source.size())
+                                                   , gsl::span<std::uint8_t>(reinterpret_cast<std::uint8_t*>(target.data()), target.size()));
+
+        if (result.status == transcode_status::insufficient_space)
+        {
+            throw std::invalid_argument("target does not have enough capacity to accommodate the converted string.");
+        }
 
-        return converter.from_bytes(source);
+        return result.produced;
+    }
+
+    std::size_t encoding::convert(const std::string_view& source, const gsl::span<char16_t>& target)
+    {
+        const auto result = utf8_transcoder::to_utf16(gsl::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(source.data()), source.size())
+                                                    , target);
+
+        if (result.status == transcode_status::insufficient_space)
+        {
+            throw std::invalid_argument("target does not have enough capacity to accommodate the converted string.");
+        }
+        if (result.status != transcode_status::ok)
+        {
+            throw std::range_error("invalid UTF-8 sequence");
+        }
+
+        return result.produced;
     }
 
     bool encoding::is_read_only() const
@@ -59,11 +103,9 @@ namespace scener::text
         return get_byte_count(chars, 0, chars.size());
     }
 
-    std::size_t encoding::get_byte_count(const std::u16string& s) const
+    std::size_t encoding::get_byte_count(const std::u16string_view& s) const
     {
-        auto temp = std::vector<char16_t>(s.begin(), s.end());
-
-        return get_byte_count(temp, 0, temp.size());
+        return get_encoder().get_byte_count(s, false);
     }
 
     std::size_t encoding::get_byte_count(const char16_t* chars, std::size_t count) const
@@ -73,9 +115,7 @@ namespace scener::text
             throw std::runtime_error("chars cannot be null");
         }
 
-        auto temp = std::vector<char16_t>(chars, chars + count);
-
-        return get_byte_count(temp, 0, count);
+        return get_encoder().get_byte_count(chars, count, false);
     }
 
     std::vector<std::uint8_t> encoding::get_bytes(const std::vector<char16_t>& chars) const
@@ -83,11 +123,18 @@ namespace scener::text
         return get_bytes(chars, 0, chars.size());
     }
 
-    std::vector<std::uint8_t> encoding::get_bytes(const std::u16string& s) const
+    std::vector<std::uint8_t> encoding::get_bytes(const std::u16string_view& s) const
     {
-        auto temp = std::vector<char16_t>(s.begin(), s.end());
+        auto result = std::vector<std::uint8_t>(get_byte_count(s), 0);
 
-        return get_bytes(temp, 0, temp.size());
+        get_bytes(s, result);
+
+        return result;
+    }
+
+    std::size_t encoding::get_bytes(const std::u16string_view& s, const gsl::span<std::uint8_t>& bytes) const
+    {
+        return get_encoder().get_bytes(s, bytes, false);
     }
 
     std::vector<std::uint8_t> encoding::get_bytes(const std::vector<char16_t>& chars
@@ -116,9 +163,17 @@ namespace scener::text
                                   , std::vector<std::uint8_t>& bytes
                                   , std::size_t                byte_index) const
     {
-        auto temp = std::vector<char16_t>(s.begin(), s.end());
+        if (char_index > s.size() || char_count > s.size() || (char_index + char_count) > s.size())
+        {
+            throw std::invalid_argument("charIndex and charCount do not denote a valid range in chars.");
+        }
+        if (byte_index > bytes.size())
+        {
+            throw std::invalid_argument("byteIndex do not denote a valid offset in bytes.");
+        }
 
-        return get_bytes(temp, char_index, char_count, bytes, byte_index);
+        return get_bytes(std::u16string_view(s).substr(char_index, char_count)
+                       , gsl::span<std::uint8_t>(bytes.data() + byte_index, bytes.size() - byte_index));
     }
 
     std::size_t encoding::get_char_count(const std::vector<std::uint8_t>& bytes) const
@@ -128,9 +183,17 @@ namespace scener::text
 
     std::size_t encoding::get_char_count(const std::uint8_t* bytes, const std::size_t& count) const
     {
-        auto temp = std::vector<std::uint8_t>(bytes, bytes + count);
+        return get_decoder().get_char_count(bytes, count, false);
+    }
+
+    std::size_t encoding::get_char_count(const gsl::span<const std::uint8_t>& bytes) const
+    {
+        return get_decoder().get_char_count(bytes.data(), bytes.size(), false);
+    }
 
-        return get_char_count(temp, 0, count);
+    std::size_t encoding::get_char_count(const std::string_view& s) const
+    {
+        return get_char_count(gsl::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(s.data()), s.size()));
     }
 
     std::vector<char16_t> encoding::get_chars(const std::vector<std::uint8_t>& bytes) const
@@ -158,6 +221,21 @@ namespace scener::text
         return get_decoder().get_chars(bytes, byte_count, chars, char_count, false);
     }
 
+    std::size_t encoding::get_chars(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars) const
+    {
+        if (get_char_count(bytes) > static_cast<std::size_t>(chars.size()))
+        {
+            throw std::invalid_argument("chars does not have enough capacity to accommodate the resulting chars.");
+        }
+
+        return get_decoder().get_chars(bytes.data(), bytes.size(), chars.data(), chars.size(), false);
+    }
+
+    std::size_t encoding::get_chars(const std::string_view& s, const gsl::span<char16_t>& chars) const
+    {
+        return get_chars(gsl::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(s.data()), s.size()), chars);
+    }
+
     std::u16string encoding::get_string(const std::vector<std::uint8_t>& bytes) const
     {
         return get_string(bytes, 0, bytes.size());
@@ -165,8 +243,20 @@ namespace scener::text
 
     std::u16string encoding::get_string(const std::vector<std::uint8_t>& bytes, std::size_t index, std::size_t count) const
     {
-        auto chars = get_chars(bytes, index, count);
+        if (index > bytes.size() || count > bytes.size() || (index + count) > bytes.size())
+        {
+            throw std::invalid_argument("index and count do not denote a valid range in bytes.");
+        }
+
+        return get_string(gsl::span<const std::uint8_t>(bytes.data() + index, count));
+    }
+
+    std::u16string encoding::get_string(const gsl::span<const std::uint8_t>& bytes) const
+    {
+        std::u16string result(get_char_count(bytes), u'\0');
+
+        get_chars(bytes, gsl::span<char16_t>(&result[0], result.size()));
 
-        return std::u16string(chars.begin(), chars.end());
+        return result;
     }
 }
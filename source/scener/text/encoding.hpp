@@ -7,8 +7,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include <gsl/span>
+
 namespace scener::text
 {
     class decoder;
@@ -31,10 +34,18 @@ namespace scener::text
                                                , std::size_t                      count);
 
         /// Converts a UTF-16 encoded string to a regular UTF-8 encoded string.
-        static std::string convert(const std::u16string& source);
+        static std::string convert(const std::u16string_view& source);
 
         /// Converts a UTF-8 encoded string to a regular UTF-16 encoded string.
-        static std::u16string convert(const std::string& source);
+        static std::u16string convert(const std::string_view& source);
+
+        /// Converts a UTF-16 encoded string to UTF-8, writing the result into the given storage.
+        /// \returns the number of UTF-8 bytes written.
+        static std::size_t convert(const std::u16string_view& source, const gsl::span<char>& target);
+
+        /// Converts a UTF-8 encoded string to UTF-16, writing the result into the given storage.
+        /// \returns the number of UTF-16 characters written.
+        static std::size_t convert(const std::string_view& source, const gsl::span<char16_t>& target);
 
     protected:
         /// Initializes a new instance of the System.Text.Encoding class.
@@ -61,7 +72,7 @@ namespace scener::text
         std::size_t get_byte_count(const std::vector<char16_t>& chars) const;
 
         /// Calculates the number of bytes produced by encoding the characters in the specified string.
-        std::size_t get_byte_count(const std::u16string& s) const;
+        virtual std::size_t get_byte_count(const std::u16string_view& s) const;
 
         /// Calculates the number of bytes produced by encoding a set of characters
         /// starting at the specified character pointer.
@@ -77,7 +88,11 @@ namespace scener::text
         std::vector<std::uint8_t> get_bytes(const std::vector<char16_t>& chars) const;
 
         /// Encodes all the characters in the specified string into a sequence of bytes.
-        std::vector<std::uint8_t> get_bytes(const std::u16string& s) const;
+        std::vector<std::uint8_t> get_bytes(const std::u16string_view& s) const;
+
+        /// Encodes all the characters in the specified string into the specified bytes.
+        /// \returns the number of bytes written.
+        virtual std::size_t get_bytes(const std::u16string_view& s, const gsl::span<std::uint8_t>& bytes) const;
 
         /// Encodes a set of characters from the specified character array into a sequence of bytes.
         std::vector<std::uint8_t> get_bytes(const std::vector<char16_t>& chars
@@ -115,6 +130,12 @@ namespace scener::text
         /// of bytes starting at the specified byte pointer.
         std::size_t get_char_count(const std::uint8_t* bytes, const std::size_t& count) const;
 
+        /// Calculates the number of characters produced by decoding all the specified bytes.
+        virtual std::size_t get_char_count(const gsl::span<const std::uint8_t>& bytes) const;
+
+        /// Calculates the number of characters produced by decoding all the bytes in the specified string.
+        std::size_t get_char_count(const std::string_view& s) const;
+
         /// When overridden in a derived class, calculates the number of characters produced
         /// by decoding a sequence of bytes from the specified byte array.
         virtual std::size_t get_char_count(const std::vector<std::uint8_t>& bytes
@@ -137,6 +158,14 @@ namespace scener::text
                             , char16_t*           chars
                             , std::size_t         char_count) const;
 
+        /// Decodes all the specified bytes into the specified characters.
+        /// \returns the number of characters written.
+        virtual std::size_t get_chars(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars) const;
+
+        /// Decodes all the bytes in the specified string into the specified characters.
+        /// \returns the number of characters written.
+        std::size_t get_chars(const std::string_view& s, const gsl::span<char16_t>& chars) const;
+
         /// When overridden in a derived class, decodes a sequence of bytes from the
         /// specified std::uint8_t array into the specified character array.
         virtual std::size_t get_chars(const std::vector<std::uint8_t>& bytes
@@ -170,6 +199,9 @@ namespace scener::text
 
         /// Decodes a sequence of bytes from the specified byte array into a string.
         std::u16string get_string(const std::vector<std::uint8_t>& bytes, std::size_t index, std::size_t count) const;
+
+        /// Decodes all the specified bytes into a string.
+        std::u16string get_string(const gsl::span<const std::uint8_t>& bytes) const;
     };
 }
 
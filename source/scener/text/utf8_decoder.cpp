@@ -6,8 +6,39 @@
 #include <algorithm>
 #include <stdexcept>
 
+#include "scener/text/utf8_transcoder.hpp"
+
 namespace scener::text
 {
+    namespace
+    {
+        // Length of the sequence started by a lead byte already accepted by the transcoder
+        inline std::size_t sequence_length(std::uint8_t lead) noexcept
+        {
+            return (lead < 0xE0) ? 2 : (lead < 0xF0) ? 3 : 4;
+        }
+
+        // Whether the given bytes are a complete sequence or the start of one
+        inline bool is_valid_prefix(const std::array<std::uint8_t, 4>& sequence, std::size_t length) noexcept
+        {
+            const auto result = utf8_transcoder::utf16_length(gsl::span<const std::uint8_t>(sequence.data(), length));
+
+            return (result.status != transcode_status::invalid);
+        }
+    }
+
+    std::size_t urf8_decoder::get_char_count(const std::uint8_t* bytes, std::size_t count, bool flush) const
+    {
+        const auto result = utf8_transcoder::utf16_length(gsl::span<const std::uint8_t>(bytes, count));
+
+        if (result.status != transcode_status::ok)
+        {
+            throw std::runtime_error("decoder error");
+        }
+
+        return result.produced;
+    }
+
     std::size_t urf8_decoder::get_char_count(const std::vector<std::uint8_t>& bytes
                                            , std::size_t                      index
                                            , std::size_t                      count) const
@@ -17,28 +48,66 @@ namespace scener::text
             throw std::invalid_argument("index and count do not denote a valid range in bytes.");
         }
 
-        std::size_t result = 0;
+        const auto result = utf8_transcoder::utf16_length(gsl::span<const std::uint8_t>(bytes.data() + index, count));
 
-        for (std::size_t i = index; i < (index + count);)
+        if (result.status != transcode_status::ok)
         {
-            std::uint32_t buffer    = bytes[i];
-            std::size_t   byte_count = 1;
+            throw std::runtime_error("decoder error");
+        }
+
+        return result.produced;
+    }
+
+    std::size_t urf8_decoder::get_char_count(const gsl::span<const std::uint8_t>& bytes, bool flush) const
+    {
+        std::array<std::uint8_t, 4> sequence;
+        std::size_t                 length = 0;
+        std::size_t                 count  = 0;
+        const auto                  taken  = complete_pending(bytes, sequence, length);
 
-            // http://xbox.create.msdn.com/en-US/sample/xnb_format
-            // Decode UTF-8.
-            if ((buffer & 0x80) == 0x80)
+        if (length != 0)
+        {
+            if (!is_valid_prefix(sequence, length))
+            {
+                throw std::runtime_error("decoder error");
+            }
+            if (length < sequence_length(sequence[0]))
             {
-                while ((buffer & (0x80 >> byte_count)) != 0x0)
+                if (flush)
                 {
-                    byte_count++;
+                    throw std::runtime_error("decoder error");
                 }
+                return 0;
             }
 
-            i += byte_count;
-            result++;
+            count += utf8_transcoder::utf16_length(gsl::span<const std::uint8_t>(sequence.data(), length)).produced;
         }
 
-        return result;
+        const auto result = utf8_transcoder::utf16_length(bytes.subspan(taken));
+
+        if (result.status == transcode_status::invalid || (result.status == transcode_status::incomplete && flush))
+        {
+            throw std::runtime_error("decoder error");
+        }
+
+        return count + result.produced;
+    }
+
+    std::size_t urf8_decoder::get_chars(const std::uint8_t* bytes
+                                      , std::size_t         byte_count
+                                      , char16_t*           chars
+                                      , std::size_t         char_count
+                                      , bool                flush) const
+    {
+        const auto result = utf8_transcoder::to_utf16(gsl::span<const std::uint8_t>(bytes, byte_count)
+                                                    , gsl::span<char16_t>(chars, char_count));
+
+        if (result.status == transcode_status::invalid || result.status == transcode_status::incomplete)
+        {
+            throw std::runtime_error("decoder error");
+        }
+
+        return result.produced;
     }
 
     std::size_t urf8_decoder::get_chars(const std::vector<std::uint8_t>& bytes
@@ -56,39 +125,107 @@ namespace scener::text
             throw std::invalid_argument("charIndex do not denote a valid offset in chars.");
         }
 
-        auto        from      = reinterpret_cast<const char*>(bytes.data()) + byte_index;
-        auto        from_end  = from + byte_count;
-        const char* from_next = nullptr;
-        auto        to        = std::vector<char16_t>(byte_count);
-        char16_t*   to_start  = to.data();
-        char16_t*   to_end    = to_start + byte_count;
-        char16_t*   to_next   = nullptr;
-        auto        state     = std::mbstate_t();
-        auto        status    = _facet->in(state, from, from_end, from_next, to_start, to_end, to_next);
+        const auto source = gsl::span<const std::uint8_t>(bytes.data() + byte_index, byte_count);
+        const auto target = gsl::span<char16_t>(chars.data() + char_index, chars.size() - char_index);
+        const auto result = utf8_transcoder::to_utf16(source, target);
 
-        if (status == std::codecvt_base::error)
+        if (result.status == transcode_status::insufficient_space)
         {
-            throw std::runtime_error("decoder error");
+            throw std::invalid_argument("chars does not have enough capacity from charIndex to the end of the array to accommodate the resulting chars.");
         }
-        else if (status == std::codecvt_base::partial)
+        if (result.status != transcode_status::ok)
         {
+            throw std::runtime_error("decoder error");
         }
-        else if (status == std::codecvt_base::ok)
+
+        return result.produced;
+    }
+
+    std::size_t urf8_decoder::get_chars(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars, bool flush)
+    {
+        std::array<std::uint8_t, 4> sequence;
+        std::size_t                 length   = 0;
+        std::size_t                 produced = 0;
+        const auto                  taken    = complete_pending(bytes, sequence, length);
+
+        if (length != 0)
         {
-            auto count = static_cast<std::size_t>(to_next - to_start);
+            // Reject invalid continuation bytes as soon as they are seen, dropping the pending sequence
+            if (!is_valid_prefix(sequence, length))
+            {
+                reset();
+                throw std::runtime_error("decoder error");
+            }
+            if (length < sequence_length(sequence[0]))
+            {
+                if (flush)
+                {
+                    reset();
+                    throw std::runtime_error("decoder error");
+                }
 
-            if ((char_index + count) > chars.size())
+                // Still incomplete, every byte went to the pending sequence
+                std::copy_n(sequence.begin(), length, _pending.begin());
+                _pending_count = length;
+                return 0;
+            }
+
+            const auto result = utf8_transcoder::to_utf16(gsl::span<const std::uint8_t>(sequence.data(), length), chars);
+
+            if (result.status == transcode_status::insufficient_space)
             {
-                throw std::invalid_argument("chars does not have enough capacity from charIndex to the end of the array to accommodate the resulting chars.");
+                throw std::invalid_argument("chars does not have enough capacity to accommodate the resulting chars.");
             }
 
-            std::copy_n(to.begin(), count, chars.begin() + char_index);
+            produced = result.produced;
         }
 
-        return static_cast<std::size_t>(to_next - to_start);
+        const auto remaining = bytes.subspan(taken);
+        const auto result    = utf8_transcoder::to_utf16(remaining, chars.subspan(produced));
+
+        if (result.status == transcode_status::insufficient_space)
+        {
+            throw std::invalid_argument("chars does not have enough capacity to accommodate the resulting chars.");
+        }
+        if (result.status == transcode_status::invalid || (result.status == transcode_status::incomplete && flush))
+        {
+            reset();
+            throw std::runtime_error("decoder error");
+        }
+
+        // The trailing bytes of an incomplete sequence (at most 3) wait for the next chunk
+        _pending_count = static_cast<std::size_t>(remaining.size()) - result.consumed;
+
+        std::copy_n(remaining.begin() + result.consumed, _pending_count, _pending.begin());
+
+        return produced + result.produced;
     }
 
     void urf8_decoder::reset()
     {
+        _pending_count = 0;
+    }
+
+    std::size_t urf8_decoder::complete_pending(const gsl::span<const std::uint8_t>& bytes
+                                             , std::array<std::uint8_t, 4>&         sequence
+                                             , std::size_t&                         length) const
+    {
+        length = _pending_count;
+
+        if (_pending_count == 0)
+        {
+            return 0;
+        }
+
+        std::copy_n(_pending.begin(), _pending_count, sequence.begin());
+
+        const auto needed = sequence_length(sequence[0]) - _pending_count;
+        const auto taken  = std::min<std::size_t>(needed, bytes.size());
+
+        std::copy_n(bytes.begin(), taken, sequence.begin() + _pending_count);
+
+        length += taken;
+
+        return taken;
     }
 }
@@ -4,10 +4,9 @@
 #ifndef SCENER_TEXT_UTF8_DECODER_HPP
 #define SCENER_TEXT_UTF8_DECODER_HPP
 
-#include <codecvt>
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <memory>
 #include <vector>
 
 #include "scener/text/decoder.hpp"
@@ -20,7 +19,8 @@ namespace scener::text
     public:
         /// Initializes a new instance of the UTF8Decoder class.
         urf8_decoder()
-            : _facet { std::make_shared<std::codecvt_utf8<char16_t, 0x10ffff, std::consume_header>>() }
+            : _pending       { }
+            , _pending_count { 0 }
         {
         }
 
@@ -28,18 +28,39 @@ namespace scener::text
         ~urf8_decoder() override = default;
 
     public:
+        using decoder::get_char_count;
+        using decoder::get_chars;
+
+        std::size_t get_char_count(const std::uint8_t* bytes, std::size_t count, bool flush) const override;
+
         std::size_t get_char_count(const std::vector<std::uint8_t>& bytes, std::size_t index, std::size_t count) const override;
 
+        std::size_t get_char_count(const gsl::span<const std::uint8_t>& bytes, bool flush) const override;
+
+        std::size_t get_chars(const std::uint8_t* bytes
+                            , std::size_t         byte_count
+                            , char16_t*           chars
+                            , std::size_t         char_count
+                            , bool                flush) const override;
+
         std::size_t get_chars(const std::vector<std::uint8_t>& bytes
                             , std::size_t                      byte_index
                             , std::size_t                      byte_count
                             , std::vector<char16_t>&           chars
                             , std::size_t                      char_index) const override;
 
+        std::size_t get_chars(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars, bool flush) override;
+
         void reset() override;
 
     private:
-        std::shared_ptr<std::codecvt_utf8<char16_t, 0x10ffff, std::consume_header>> _facet;
+        std::size_t complete_pending(const gsl::span<const std::uint8_t>& bytes
+                                   , std::array<std::uint8_t, 4>&         sequence
+                                   , std::size_t&                         length) const;
+
+    private:
+        std::array<std::uint8_t, 3> _pending;
+        std::size_t                 _pending_count;
     };
 }
 
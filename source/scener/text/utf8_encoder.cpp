@@ -3,13 +3,17 @@
 
 #include "scener/text/utf8_encoder.hpp"
 
-#include <algorithm>
-#include <locale>
-#include <string>
 #include <stdexcept>
 
+#include "scener/text/utf8_transcoder.hpp"
+
 namespace scener::text
 {
+    std::size_t utf8_encoder::get_byte_count(const char16_t* chars, std::size_t count, bool flush) const
+    {
+        return utf8_transcoder::utf8_length(gsl::span<const char16_t>(chars, count));
+    }
+
     std::size_t utf8_encoder::get_byte_count(const std::vector<char16_t>& chars
                                            , std::size_t                  index
                                            , std::size_t                  count
@@ -20,43 +24,38 @@ namespace scener::text
             throw std::invalid_argument("index and count do not denote a valid range in chars.");
         }
 
-        std::size_t byteCount = 0;
+        return utf8_transcoder::utf8_length(gsl::span<const char16_t>(chars.data() + index, count));
+    }
+
+    std::size_t utf8_encoder::get_byte_count(const std::u16string_view& chars, bool flush) const
+    {
+        return utf8_transcoder::utf8_length(gsl::span<const char16_t>(chars.data(), chars.size()));
+    }
 
-        /**
-        * Unicode code points
-        * 00-7F           ( 7 bits)
-        * 0080-07FF       (11 bits)
-        * 0800-FFFF       (16 bits)
-        * 010000-10FFFF   (21 bits)
-        */
-        for (std::size_t i = index; i < (index + count); i++)
+    std::size_t utf8_encoder::get_bytes(const char16_t* chars
+                                      , std::size_t     char_count
+                                      , std::uint8_t*   bytes
+                                      , std::size_t     byte_count
+                                      , bool            flush) const
+    {
+        if (chars == nullptr)
         {
-            std::uint32_t buffer = static_cast<std::uint32_t>(chars[i]);
-            std::size_t   offset = 1;
-
-            if ((((buffer >> 7) & 0xff) & 0x7F) == 0x7F)
-            {
-                if ((((buffer >> 11) & 0xff) & 0x7FF) == 0x7FF)
-                {
-                    if ((((buffer >> 21) & 0xff) & 0x10FFFF) == 0x10FFFF)
-                    {
-                        offset = 4;
-                    }
-                    else
-                    {
-                        offset = 3;
-                    }
-                }
-                else
-                {
-                    offset = 2;
-                }
-            }
-
-            byteCount += offset;
+            throw std::runtime_error("chars is null");
         }
+        if (bytes == nullptr)
+        {
+            throw std::runtime_error("bytes is null");
+        }
+
+        const auto result = utf8_transcoder::to_utf8(gsl::span<const char16_t>(chars, char_count)
+                                                   , gsl::span<std::uint8_t>(bytes, byte_count));
 
-        return byteCount;
+        if (result.status == transcode_status::insufficient_space)
+        {
+            throw std::runtime_error("byteCount is less than the resulting number of bytes.");
+        }
+
+        return result.produced;
     }
 
     std::size_t utf8_encoder::get_bytes(const std::vector<char16_t>& chars
@@ -75,36 +74,27 @@ namespace scener::text
             throw std::invalid_argument("byteIndex do not denote a valid offset in bytes.");
         }
 
-        const char16_t* from      = chars.data() + char_index;
-        const char16_t* from_end  = from + char_count;
-        const char16_t* from_next = nullptr;
-        auto            size      = char_count * _facet->max_length();
-        auto            to        = std::vector<char>(size, 0);
-        char*           to_start  = to.data();
-        char*           to_end    = to_start + size;
-        char*           to_next   = nullptr;
-        auto            state     = std::mbstate_t();
-        auto            r         = _facet->out(state, from, from_end, from_next, to_start, to_end, to_next);
-
-        if (r == std::codecvt_base::error)
-        {
-            throw std::runtime_error("encoder error");
-        }
-        else if (r == std::codecvt_base::partial)
+        const auto source = gsl::span<const char16_t>(chars.data() + char_index, char_count);
+        const auto target = gsl::span<std::uint8_t>(bytes.data() + byte_index, bytes.size() - byte_index);
+        const auto result = utf8_transcoder::to_utf8(source, target);
+
+        if (result.status == transcode_status::insufficient_space)
         {
+            throw std::invalid_argument("bytes does not have enough capacity from byteIndex to the end of the array to accommodate the resulting bytes.");
         }
-        else if (r == std::codecvt_base::ok)
-        {
-            auto count = static_cast<std::size_t>(to_next - to_start);
 
-            if ((byte_index + count) > bytes.size())
-            {
-                throw std::invalid_argument("bytes does not have enough capacity from byteIndex to the end of the array to accommodate the resulting bytes.");
-            }
+        return result.produced;
+    }
 
-            std::copy_n(to.begin(), count, bytes.begin() + byte_index);
+    std::size_t utf8_encoder::get_bytes(const std::u16string_view& chars, const gsl::span<std::uint8_t>& bytes, bool flush) const
+    {
+        const auto result = utf8_transcoder::to_utf8(gsl::span<const char16_t>(chars.data(), chars.size()), bytes);
+
+        if (result.status == transcode_status::insufficient_space)
+        {
+            throw std::invalid_argument("bytes does not have enough capacity to accommodate the resulting bytes.");
         }
 
-        return static_cast<std::size_t>(to_next - to_start);
+        return result.produced;
     }
 }
@@ -4,11 +4,8 @@
 #ifndef SCENER_TEXT_UTF8_ENCODER_HPP
 #define SCENER_TEXT_UTF8_ENCODER_HPP
 
-#include <codecvt>
 #include <cstddef>
 #include <cstdint>
-#include <locale>
-#include <memory>
 
 #include "scener/text/encoder.hpp"
 
@@ -20,20 +17,28 @@ namespace scener::text
     public:
         /// Initializes a new instance of the UTF8Encoder class.
         utf8_encoder()
-            : _facet { std::make_shared<std::codecvt_utf8<char16_t, 0x10ffff, std::consume_header>>() }
         {
-
         }
 
         /// Releases all resources being used by this UTF8Encoder.
         ~utf8_encoder() override = default;
 
     public:
+        std::size_t get_byte_count(const char16_t* chars, std::size_t count, bool flush) const override;
+
         std::size_t get_byte_count(const std::vector<char16_t>& chars
                                  , std::size_t                  index
                                  , std::size_t                  count
                                  , bool                         flush) const override;
- 
+
+        std::size_t get_byte_count(const std::u16string_view& chars, bool flush) const override;
+
+        std::size_t get_bytes(const char16_t* chars
+                            , std::size_t     char_count
+                            , std::uint8_t*   bytes
+                            , std::size_t     byte_count
+                            , bool            flush) const override;
+
         std::size_t get_bytes(const std::vector<char16_t>& chars
                             , std::size_t                  char_index
                             , std::size_t                  char_count
@@ -41,8 +46,7 @@ namespace scener::text
                             , std::size_t                  byte_index
                             , bool                         flush) const override;
 
-    private:
-        std::shared_ptr<std::codecvt_utf8<char16_t, 0x10ffff, std::consume_header>> _facet;
+        std::size_t get_bytes(const std::u16string_view& chars, const gsl::span<std::uint8_t>& bytes, bool flush) const override;
     };
 }
 
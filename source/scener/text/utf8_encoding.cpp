@@ -3,6 +3,10 @@
 
 #include "scener/text/utf8_encoding.hpp"
 
+#include <stdexcept>
+
+#include "scener/text/utf8_transcoder.hpp"
+
 namespace scener::text
 {
     std::u16string utf8_encoding::encoding_name() const
@@ -45,6 +49,56 @@ namespace scener::text
         return _decoder.get_chars(bytes, byte_index, byte_count, chars, char_index);
     }
 
+    bool utf8_encoding::is_valid(const gsl::span<const std::uint8_t>& bytes) const noexcept
+    {
+        return utf8_transcoder::validate(bytes);
+    }
+
+    std::size_t utf8_encoding::get_byte_count(const std::u16string_view& s) const
+    {
+        return utf8_transcoder::utf8_length(gsl::span<const char16_t>(s.data(), s.size()));
+    }
+
+    std::size_t utf8_encoding::get_bytes(const std::u16string_view& s, const gsl::span<std::uint8_t>& bytes) const
+    {
+        const auto result = utf8_transcoder::to_utf8(gsl::span<const char16_t>(s.data(), s.size()), bytes);
+
+        if (result.status == transcode_status::insufficient_space)
+        {
+            throw std::invalid_argument("bytes does not have enough capacity to accommodate the resulting bytes.");
+        }
+
+        return result.produced;
+    }
+
+    std::size_t utf8_encoding::get_char_count(const gsl::span<const std::uint8_t>& bytes) const
+    {
+        const auto result = utf8_transcoder::utf16_length(bytes);
+
+        if (result.status != transcode_status::ok)
+        {
+            throw std::runtime_error("decoder error");
+        }
+
+        return result.produced;
+    }
+
+    std::size_t utf8_encoding::get_chars(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars) const
+    {
+        const auto result = utf8_transcoder::to_utf16(bytes, chars);
+
+        if (result.status == transcode_status::insufficient_space)
+        {
+            throw std::invalid_argument("chars does not have enough capacity to accommodate the resulting chars.");
+        }
+        if (result.status != transcode_status::ok)
+        {
+            throw std::runtime_error("decoder error");
+        }
+
+        return result.produced;
+    }
+
     std::size_t utf8_encoding::get_max_byte_count(std::size_t char_count)
     {
         return (char_count * 4);
@@ -8,6 +8,8 @@
 #include <cstdint>
 #include <vector>
 
+#include <gsl/span>
+
 #include "scener/text/encoding.hpp"
 #include "scener/text/utf8_decoder.hpp"
 #include "scener/text/utf8_encoder.hpp"
@@ -51,6 +53,19 @@ namespace scener::text
                             , std::vector<char16_t>&           chars
                             , std::size_t                      char_index) const override;
 
+        /// Checks whether the given bytes are well-formed UTF-8.
+        /// \param bytes the bytes to validate.
+        /// \returns true if the bytes are well-formed UTF-8; false otherwise.
+        bool is_valid(const gsl::span<const std::uint8_t>& bytes) const noexcept;
+
+        std::size_t get_byte_count(const std::u16string_view& s) const override;
+
+        std::size_t get_bytes(const std::u16string_view& s, const gsl::span<std::uint8_t>& bytes) const override;
+
+        std::size_t get_char_count(const gsl::span<const std::uint8_t>& bytes) const override;
+
+        std::size_t get_chars(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars) const override;
+
         std::size_t get_max_byte_count(std::size_t char_count) override;
 
         std::size_t get_max_char_count(std::size_t byte_count) override;
@@ -0,0 +1,485 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/text/utf8_transcoder.hpp"
+
+#include <algorithm>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SCENER_TEXT_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace scener::text
+{
+    namespace
+    {
+        constexpr char16_t replacement_character = 0xFFFD;
+
+        // Decodes a single multi-byte sequence.
+        // Returns the sequence length, 0 when the input ends in the middle of a valid sequence, or -1 if invalid.
+        inline int decode_sequence(const std::uint8_t* bytes, std::size_t remaining, std::uint32_t& code_point) noexcept
+        {
+            const std::uint32_t lead  = bytes[0];
+            int                 count = 0;
+            std::uint8_t        lower = 0x80;
+            std::uint8_t        upper = 0xBF;
+
+            if (lead < 0x80)
+            {
+                code_point = lead;
+                return 1;
+            }
+            else if (lead >= 0xC2 && lead <= 0xDF)
+            {
+                count      = 2;
+                code_point = lead & 0x1F;
+            }
+            else if (lead >= 0xE0 && lead <= 0xEF)
+            {
+                count      = 3;
+                code_point = lead & 0x0F;
+                lower      = (lead == 0xE0) ? 0xA0 : 0x80;  // overlong
+                upper      = (lead == 0xED) ? 0x9F : 0xBF;  // surrogates
+            }
+            else if (lead >= 0xF0 && lead <= 0xF4)
+            {
+                count      = 4;
+                code_point = lead & 0x07;
+                lower      = (lead == 0xF0) ? 0x90 : 0x80;  // overlong
+                upper      = (lead == 0xF4) ? 0x8F : 0xBF;  // above U+10FFFF
+            }
+            else
+            {
+                return -1;
+            }
+
+            for (int i = 1; i < count; ++i)
+            {
+                if (static_cast<std::size_t>(i) >= remaining)
+                {
+                    return 0;
+                }
+
+                const auto next = bytes[i];
+
+                if (next < lower || next > upper)
+                {
+                    return -1;
+                }
+
+                code_point = (code_point << 6) | (next & 0x3F);
+                lower      = 0x80;
+                upper      = 0xBF;
+            }
+
+            return count;
+        }
+
+        // Number of leading ASCII bytes
+        inline std::size_t ascii_prefix_scalar(const std::uint8_t* bytes, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+
+            while (i < count && bytes[i] < 0x80)
+            {
+                ++i;
+            }
+
+            return i;
+        }
+
+        // Widens the leading ASCII bytes into UTF-16, returns how many were converted
+        inline std::size_t widen_ascii_scalar(const std::uint8_t* bytes, std::size_t count, char16_t* chars) noexcept
+        {
+            std::size_t i = 0;
+
+            for (; i < count && bytes[i] < 0x80; ++i)
+            {
+                chars[i] = bytes[i];
+            }
+
+            return i;
+        }
+
+        // Narrows the leading ASCII code units into UTF-8, returns how many were converted
+        inline std::size_t narrow_ascii_scalar(const char16_t* chars, std::size_t count, std::uint8_t* bytes) noexcept
+        {
+            std::size_t i = 0;
+
+            for (; i < count && chars[i] < 0x80; ++i)
+            {
+                bytes[i] = static_cast<std::uint8_t>(chars[i]);
+            }
+
+            return i;
+        }
+
+#if defined(SCENER_TEXT_X86_SIMD)
+        std::size_t ascii_prefix_sse2(const std::uint8_t* bytes, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+
+            for (; i + 16 <= count; i += 16)
+            {
+                const auto mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i)));
+
+                if (mask != 0)
+                {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+
+            return i + ascii_prefix_scalar(bytes + i, count - i);
+        }
+
+        std::size_t widen_ascii_sse2(const std::uint8_t* bytes, std::size_t count, char16_t* chars) noexcept
+        {
+            const auto  zero = _mm_setzero_si128();
+            std::size_t i    = 0;
+
+            for (; i + 16 <= count; i += 16)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+
+                if (_mm_movemask_epi8(block) != 0)
+                {
+                    break;
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(chars + i)    , _mm_unpacklo_epi8(block, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(chars + i + 8), _mm_unpackhi_epi8(block, zero));
+            }
+
+            return i + widen_ascii_scalar(bytes + i, count - i, chars + i);
+        }
+
+        std::size_t narrow_ascii_sse2(const char16_t* chars, std::size_t count, std::uint8_t* bytes) noexcept
+        {
+            const auto  mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+            const auto  zero = _mm_setzero_si128();
+            std::size_t i    = 0;
+
+            for (; i + 8 <= count; i += 8)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, mask), zero)) != 0xFFFF)
+                {
+                    break;
+                }
+
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(bytes + i), _mm_packus_epi16(block, block));
+            }
+
+            return i + narrow_ascii_scalar(chars + i, count - i, bytes + i);
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t ascii_prefix_avx2(const std::uint8_t* bytes, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+
+            for (; i + 32 <= count; i += 32)
+            {
+                const auto mask = _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i)));
+
+                if (mask != 0)
+                {
+                    return i + __builtin_ctz(static_cast<unsigned>(mask));
+                }
+            }
+
+            // Tails stay in VEX encoded code, mixing in the legacy SSE kernels stalls on AVX <-> SSE transitions
+            _mm256_zeroupper();
+
+            return i + ascii_prefix_scalar(bytes + i, count - i);
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t widen_ascii_avx2(const std::uint8_t* bytes, std::size_t count, char16_t* chars) noexcept
+        {
+            std::size_t i = 0;
+
+            for (; i + 32 <= count; i += 32)
+            {
+                const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+
+                if (_mm256_movemask_epi8(block) != 0)
+                {
+                    break;
+                }
+
+                const auto low  = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block));
+                const auto high = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(chars + i)     , low);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(chars + i + 16), high);
+            }
+
+            _mm256_zeroupper();
+
+            return i + widen_ascii_scalar(bytes + i, count - i, chars + i);
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t narrow_ascii_avx2(const char16_t* chars, std::size_t count, std::uint8_t* bytes) noexcept
+        {
+            const auto  mask = _mm256_set1_epi16(static_cast<short>(0xFF80));
+            std::size_t i    = 0;
+
+            for (; i + 16 <= count; i += 16)
+            {
+                const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + i));
+
+                if (!_mm256_testz_si256(block, mask))
+                {
+                    break;
+                }
+
+                // packus works per 128-bit lane, gather the two low quadwords back together
+                const auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(block, block), 0x08);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + i), _mm256_castsi256_si128(packed));
+            }
+
+            _mm256_zeroupper();
+
+            return i + narrow_ascii_scalar(chars + i, count - i, bytes + i);
+        }
+#endif
+
+        struct ascii_kernels
+        {
+            std::size_t (*prefix)(const std::uint8_t*, std::size_t) noexcept;
+            std::size_t (*widen)(const std::uint8_t*, std::size_t, char16_t*) noexcept;
+            std::size_t (*narrow)(const char16_t*, std::size_t, std::uint8_t*) noexcept;
+        };
+
+        const ascii_kernels& kernels() noexcept
+        {
+            static const ascii_kernels instance = [] () -> ascii_kernels
+            {
+#if defined(SCENER_TEXT_X86_SIMD)
+                if (__builtin_cpu_supports("avx2"))
+                {
+                    return { ascii_prefix_avx2, widen_ascii_avx2, narrow_ascii_avx2 };
+                }
+
+                return { ascii_prefix_sse2, widen_ascii_sse2, narrow_ascii_sse2 };
+#else
+                return { ascii_prefix_scalar, widen_ascii_scalar, narrow_ascii_scalar };
+#endif
+            }();
+
+            return instance;
+        }
+    }
+
+    bool utf8_transcoder::validate(const gsl::span<const std::uint8_t>& bytes) noexcept
+    {
+        return utf16_length(bytes).status == transcode_status::ok;
+    }
+
+    transcode_result utf8_transcoder::utf16_length(const gsl::span<const std::uint8_t>& bytes) noexcept
+    {
+        const auto& simd   = kernels();
+        const auto  data   = bytes.data();
+        const auto  count  = static_cast<std::size_t>(bytes.size());
+        std::size_t i      = 0;
+        std::size_t length = 0;
+
+        while (i < count)
+        {
+            const auto ascii = simd.prefix(data + i, count - i);
+
+            i      += ascii;
+            length += ascii;
+
+            if (i == count)
+            {
+                break;
+            }
+
+            std::uint32_t code_point = 0;
+
+            const auto size = decode_sequence(data + i, count - i, code_point);
+
+            if (size <= 0)
+            {
+                return { i, length, (size == 0) ? transcode_status::incomplete : transcode_status::invalid };
+            }
+
+            i      += static_cast<std::size_t>(size);
+            length += (code_point >= 0x10000) ? 2 : 1;
+        }
+
+        return { i, length, transcode_status::ok };
+    }
+
+    std::size_t utf8_transcoder::utf8_length(const gsl::span<const char16_t>& chars) noexcept
+    {
+        const auto  data   = chars.data();
+        const auto  count  = static_cast<std::size_t>(chars.size());
+        std::size_t length = 0;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::uint32_t unit = data[i];
+
+            if (unit < 0x80)
+            {
+                length += 1;
+            }
+            else if (unit < 0x800)
+            {
+                length += 2;
+            }
+            else if (unit >= 0xD800 && unit <= 0xDBFF && (i + 1) < count && data[i + 1] >= 0xDC00 && data[i + 1] <= 0xDFFF)
+            {
+                length += 4;
+                ++i;
+            }
+            else
+            {
+                length += 3;
+            }
+        }
+
+        return length;
+    }
+
+    transcode_result utf8_transcoder::to_utf16(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars) noexcept
+    {
+        const auto& simd     = kernels();
+        const auto  source   = bytes.data();
+        const auto  count    = static_cast<std::size_t>(bytes.size());
+        const auto  target   = chars.data();
+        const auto  capacity = static_cast<std::size_t>(chars.size());
+        std::size_t i        = 0;
+        std::size_t j        = 0;
+
+        while (i < count)
+        {
+            const auto ascii = simd.widen(source + i, std::min(count - i, capacity - j), target + j);
+
+            i += ascii;
+            j += ascii;
+
+            if (i == count)
+            {
+                break;
+            }
+            if (j == capacity)
+            {
+                return { i, j, transcode_status::insufficient_space };
+            }
+
+            std::uint32_t code_point = 0;
+
+            const auto size = decode_sequence(source + i, count - i, code_point);
+
+            if (size <= 0)
+            {
+                return { i, j, (size == 0) ? transcode_status::incomplete : transcode_status::invalid };
+            }
+
+            if (code_point >= 0x10000)
+            {
+                if (capacity - j < 2)
+                {
+                    return { i, j, transcode_status::insufficient_space };
+                }
+
+                code_point -= 0x10000;
+
+                target[j++] = static_cast<char16_t>(0xD800 + (code_point >> 10));
+                target[j++] = static_cast<char16_t>(0xDC00 + (code_point & 0x3FF));
+            }
+            else
+            {
+                target[j++] = static_cast<char16_t>(code_point);
+            }
+
+            i += static_cast<std::size_t>(size);
+        }
+
+        return { i, j, transcode_status::ok };
+    }
+
+    transcode_result utf8_transcoder::to_utf8(const gsl::span<const char16_t>& chars, const gsl::span<std::uint8_t>& bytes) noexcept
+    {
+        const auto& simd     = kernels();
+        const auto  source   = chars.data();
+        const auto  count    = static_cast<std::size_t>(chars.size());
+        const auto  target   = bytes.data();
+        const auto  capacity = static_cast<std::size_t>(bytes.size());
+        std::size_t i        = 0;
+        std::size_t j        = 0;
+
+        while (i < count)
+        {
+            const auto ascii = simd.narrow(source + i, std::min(count - i, capacity - j), target + j);
+
+            i += ascii;
+            j += ascii;
+
+            if (i == count)
+            {
+                break;
+            }
+
+            std::uint32_t code_point = source[i];
+            std::size_t   consumed   = 1;
+
+            if (code_point >= 0xD800 && code_point <= 0xDFFF)
+            {
+                if (code_point <= 0xDBFF && (i + 1) < count && source[i + 1] >= 0xDC00 && source[i + 1] <= 0xDFFF)
+                {
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (source[i + 1] - 0xDC00);
+                    consumed   = 2;
+                }
+                else
+                {
+                    code_point = replacement_character;
+                }
+            }
+
+            const std::size_t size = (code_point < 0x80) ? 1 : (code_point < 0x800) ? 2 : (code_point < 0x10000) ? 3 : 4;
+
+            if (capacity - j < size)
+            {
+                return { i, j, transcode_status::insufficient_space };
+            }
+
+            switch (size)
+            {
+            case 1:
+                target[j++] = static_cast<std::uint8_t>(code_point);
+                break;
+
+            case 2:
+                target[j++] = static_cast<std::uint8_t>(0xC0 | (code_point >> 6));
+                target[j++] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+                break;
+
+            case 3:
+                target[j++] = static_cast<std::uint8_t>(0xE0 | (code_point >> 12));
+                target[j++] = static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+                target[j++] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+                break;
+
+            default:
+                target[j++] = static_cast<std::uint8_t>(0xF0 | (code_point >> 18));
+                target[j++] = static_cast<std::uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+                target[j++] = static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+                target[j++] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+                break;
+            }
+
+            i += consumed;
+        }
+
+        return { i, j, transcode_status::ok };
+    }
+}
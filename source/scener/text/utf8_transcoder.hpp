@@ -0,0 +1,73 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_TEXT_UTF8_TRANSCODER_HPP
+#define SCENER_TEXT_UTF8_TRANSCODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gsl/span>
+
+namespace scener::text
+{
+    /// Outcome of a UTF-8 <-> UTF-16 conversion.
+    enum class transcode_status : std::uint32_t
+    {
+        ok                 = 0 ///< The whole input has been converted.
+      , invalid            = 1 ///< The input contains an invalid sequence at the consumed offset.
+      , incomplete         = 2 ///< The input ends in the middle of a multi-byte sequence.
+      , insufficient_space = 3 ///< The output is too small to hold the converted input.
+    };
+
+    /// Result of a UTF-8 <-> UTF-16 conversion.
+    struct transcode_result
+    {
+        std::size_t      consumed; ///< The number of input units converted.
+        std::size_t      produced; ///< The number of output units written.
+        transcode_status status;   ///< The conversion outcome.
+    };
+
+    /// Vectorized UTF-8 <-> UTF-16 conversion routines.
+    /// Runs of ASCII are processed 32 (AVX2) or 16 (SSE2) bytes at a time; multi-byte sequences go through a
+    /// scalar, strictly validating path (no overlong forms, surrogates or code points above U+10FFFF).
+    class utf8_transcoder final
+    {
+    public:
+        /// Checks whether the given bytes are well-formed UTF-8.
+        /// \param bytes the bytes to validate.
+        /// \returns true if the bytes are well-formed UTF-8; false otherwise.
+        static bool validate(const gsl::span<const std::uint8_t>& bytes) noexcept;
+
+        /// Calculates the number of UTF-16 code units produced by decoding the given UTF-8 bytes.
+        /// \param bytes the bytes to decode.
+        /// \returns the conversion result; produced holds the number of UTF-16 code units.
+        static transcode_result utf16_length(const gsl::span<const std::uint8_t>& bytes) noexcept;
+
+        /// Calculates the number of UTF-8 bytes produced by encoding the given UTF-16 code units.
+        /// Unpaired surrogates are counted as the replacement character (U+FFFD).
+        /// \param chars the code units to encode.
+        /// \returns the number of UTF-8 bytes.
+        static std::size_t utf8_length(const gsl::span<const char16_t>& chars) noexcept;
+
+        /// Decodes UTF-8 bytes into UTF-16 code units.
+        /// \param bytes the bytes to decode.
+        /// \param chars the destination of the decoded code units.
+        /// \returns the conversion result.
+        static transcode_result to_utf16(const gsl::span<const std::uint8_t>& bytes, const gsl::span<char16_t>& chars) noexcept;
+
+        /// Encodes UTF-16 code units into UTF-8 bytes. Unpaired surrogates are encoded as the replacement
+        /// character (U+FFFD).
+        /// \param chars the code units to encode.
+        /// \param bytes the destination of the encoded bytes.
+        /// \returns the conversion result.
+        static transcode_result to_utf8(const gsl::span<const char16_t>& chars, const gsl::span<std::uint8_t>& bytes) noexcept;
+
+    private:
+        utf8_transcoder() = delete;
+        utf8_transcoder(const utf8_transcoder& transcoder) = delete;
+        utf8_transcoder& operator=(const utf8_transcoder& transcoder) = delete;
+    };
+}
+
+#endif // SCENER_TEXT_UTF8_TRANSCODER_HPP
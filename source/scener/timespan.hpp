@@ -15,7 +15,7 @@ namespace scener
     class timespan final
     {
     public:
-        using clock                 = std::chrono::high_resolution_clock;
+        using clock                 = std::chrono::steady_clock;
         using days_duration         = std::chrono::duration<double      , std::ratio<86400>>;
         using hours_duration        = std::chrono::duration<double      , std::ratio<3600>>;
         using minutes_duration      = std::chrono::duration<double      , std::ratio<60>>;
@@ -261,6 +261,62 @@ namespace scener
             return std::chrono::duration_cast<_Duration>(_ticks);
         }
 
+    public:
+        /// Returns a new TimeSpan object whose value is this instance multiplied by numerator / denominator,
+        /// using integer tick arithmetic (truncated towards zero).
+        /// \param numerator the scale numerator.
+        /// \param denominator the scale denominator, must not be zero.
+        /// \returns the scaled time interval.
+        constexpr timespan scale(std::int64_t numerator, std::int64_t denominator) const noexcept
+        {
+            return { _ticks.count() * numerator / denominator };
+        }
+
+        /// Returns the ratio between this instance and the given time interval, as a fixed point value.
+        /// \param divisor the time interval to divide by, must not be zero.
+        /// \param one the fixed point value that represents a ratio of 1.
+        /// \returns the ratio between this instance and the given time interval, multiplied by one.
+        constexpr std::int64_t ratio(const timespan& divisor, std::int64_t one) const noexcept
+        {
+            return _ticks.count() * one / divisor._ticks.count();
+        }
+
+        /// Wraps this instance into the [0, period) range, for looping time lines.
+        /// \param period the loop period, must be greater than zero.
+        /// \returns the wrapped time interval.
+        constexpr timespan wrap(const timespan& period) const noexcept
+        {
+            const auto value = _ticks.count() % period._ticks.count();
+
+            // Negative remainders are moved into range without branching
+            return { value + ((value >> 63) & period._ticks.count()) };
+        }
+
+        /// Clamps this instance to the given range.
+        /// \param min the minimum value.
+        /// \param max the maximum value.
+        /// \returns the clamped time interval.
+        constexpr timespan clamp(const timespan& min, const timespan& max) const noexcept
+        {
+            const auto value = _ticks.count() < min._ticks.count() ? min._ticks.count() : _ticks.count();
+
+            return { value > max._ticks.count() ? max._ticks.count() : value };
+        }
+
+        /// Linearly interpolates between two time intervals, using integer tick arithmetic.
+        /// \param from the start value.
+        /// \param to the end value.
+        /// \param numerator the interpolation amount numerator.
+        /// \param denominator the interpolation amount denominator, must not be zero.
+        /// \returns from + (to - from) * numerator / denominator.
+        constexpr static timespan lerp(const timespan& from
+                                     , const timespan& to
+                                     , std::int64_t    numerator
+                                     , std::int64_t    denominator) noexcept
+        {
+            return { from._ticks.count() + (to._ticks.count() - from._ticks.count()) * numerator / denominator };
+        }
+
     public:
         /// Equality operator for comparing TimeSpan instances.
         constexpr bool operator==(const timespan& t2) const noexcept
@@ -0,0 +1,56 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "accessor_test.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include <scener/content/gltf/accessor.hpp>
+
+using namespace scener::content::gltf;
+
+TEST_F(accessor_test, given_bounds_are_kept)
+{
+    const auto data = view(std::vector<float> { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f });
+
+    // Bounds wider than the data, so they can not be mistaken for computed ones
+    const accessor instance(attribute_type::vector3, component_type::single, data, 0, 2, 0
+                          , { -1.0f, -2.0f, -3.0f }
+                          , { 10.0f, 20.0f, 30.0f });
+
+    EXPECT_EQ((std::vector<float> { -1.0f, -2.0f, -3.0f }), instance.min());
+    EXPECT_EQ((std::vector<float> { 10.0f, 20.0f, 30.0f }), instance.max());
+}
+
+TEST_F(accessor_test, missing_bounds_are_computed)
+{
+    const auto data = view(std::vector<float> { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, 0.5f, 2.0f, 0.0f, -6.0f });
+
+    const accessor instance(attribute_type::vector3, component_type::single, data, 0, 3, 0, { }, { });
+
+    EXPECT_EQ((std::vector<float> { -4.0f, -2.0f, -6.0f }), instance.min());
+    EXPECT_EQ((std::vector<float> {  2.0f,  5.0f,  3.0f }), instance.max());
+}
+
+TEST_F(accessor_test, malformed_bounds_are_computed)
+{
+    const auto data = view(std::vector<float> { 1.0f, 2.0f, 3.0f, 4.0f });
+
+    // A single value for a two component attribute
+    const accessor instance(attribute_type::vector2, component_type::single, data, 0, 2, 0, { 0.0f }, { 9.0f, 9.0f });
+
+    EXPECT_EQ((std::vector<float> { 1.0f, 2.0f }), instance.min());
+    EXPECT_EQ((std::vector<float> { 3.0f, 4.0f }), instance.max());
+}
+
+TEST_F(accessor_test, computed_bounds_follow_the_stride)
+{
+    // Two signed short components every three shorts, the third one is padding
+    const auto data = view(std::vector<std::int16_t> { 7, -3, 1000, -8, 12, -1000 });
+
+    const accessor instance(attribute_type::vector2, component_type::int16, data, 0, 2, 6);
+
+    EXPECT_EQ((std::vector<float> { -8.0f, -3.0f }), instance.min());
+    EXPECT_EQ((std::vector<float> {  7.0f, 12.0f }), instance.max());
+}
@@ -0,0 +1,34 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_ACCESSORTEST_HPP
+#define TESTS_ACCESSORTEST_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <scener/content/gltf/buffer.hpp>
+#include <scener/content/gltf/buffer_view.hpp>
+
+class accessor_test : public testing::Test
+{
+protected:
+    /// Creates a buffer view over the given values.
+    template <typename T>
+    static std::shared_ptr<scener::content::gltf::buffer_view> view(const std::vector<T>& values)
+    {
+        std::vector<std::uint8_t> data(values.size() * sizeof(T));
+
+        std::memcpy(data.data(), values.data(), data.size());
+
+        auto source = std::make_shared<scener::content::gltf::buffer>("buffer", data);
+
+        return std::make_shared<scener::content::gltf::buffer_view>(source, 0, source->byte_length());
+    }
+};
+
+#endif // TESTS_ACCESSORTEST_HPP
@@ -0,0 +1,132 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "block_compression_test.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <scener/content/dds/block_compression.hpp>
+#include <scener/content/dds/surface.hpp>
+
+using namespace scener;
+using namespace scener::content::dds;
+using scener::graphics::surface_format;
+
+TEST_F(block_compression_test, bc1_roundtrip)
+{
+    const auto texels = gradient(13, 9);
+
+    std::vector<std::uint8_t> blocks(4 * 3 * 8);
+    std::vector<std::uint8_t> decoded(texels.size());
+
+    block_compression::encode(surface_format::dxt1, 13, 9, texels, blocks);
+    block_compression::decode(surface_format::dxt1, 13, 9, blocks, decoded);
+
+    EXPECT_GE(12, max_error(texels, decoded, 3));
+}
+
+TEST_F(block_compression_test, bc3_roundtrip)
+{
+    const auto texels = gradient(16, 16);
+
+    std::vector<std::uint8_t> blocks(4 * 4 * 16);
+    std::vector<std::uint8_t> decoded(texels.size());
+
+    block_compression::encode(surface_format::dxt5, 16, 16, texels, blocks);
+    block_compression::decode(surface_format::dxt5, 16, 16, blocks, decoded);
+
+    EXPECT_GE(12, max_error(texels, decoded, 4));
+}
+
+TEST_F(block_compression_test, bc1_transparent_texels)
+{
+    // c0 <= c1 selects the three color mode, index 3 is transparent black
+    const std::uint8_t block[8] = { 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    std::uint8_t       texels[64];
+
+    block_compression::decode_block(surface_format::dxt1, block, texels);
+
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        EXPECT_EQ(0, texels[i]);
+    }
+}
+
+TEST_F(block_compression_test, bc7_mode6_block)
+{
+    // Mode 6, endpoints 0 and 127 with p-bits 0 and 1 on every channel, texel i uses index i
+    std::uint8_t  block[16] = { };
+    std::uint32_t position  = 0;
+
+    const auto write = [&] (std::uint32_t value, std::uint32_t count) -> void
+    {
+        for (std::uint32_t bit = 0; bit < count; ++bit, ++position)
+        {
+            block[position / 8] |= static_cast<std::uint8_t>(((value >> bit) & 1) << (position % 8));
+        }
+    };
+
+    write(1 << 6, 7);
+
+    for (std::uint32_t channel = 0; channel < 4; ++channel)
+    {
+        write(0, 7);
+        write(127, 7);
+    }
+
+    write(0, 1);
+    write(1, 1);
+
+    for (std::uint32_t i = 0; i < 16; ++i)
+    {
+        write(i, (i == 0) ? 3 : 4);
+    }
+
+    EXPECT_EQ(128u, position);
+
+    const std::uint8_t expected[16] = { 0, 16, 36, 52, 68, 84, 104, 120, 135, 151, 171, 187, 203, 219, 239, 255 };
+    std::uint8_t       texels[64];
+
+    block_compression::decode_block(surface_format::bc7, block, texels);
+
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(expected[i], texels[i * 4]);
+        EXPECT_EQ(expected[i], texels[i * 4 + 1]);
+        EXPECT_EQ(expected[i], texels[i * 4 + 2]);
+        EXPECT_EQ(expected[i], texels[i * 4 + 3]);
+    }
+}
+
+TEST_F(block_compression_test, surface_transform)
+{
+    // 8x8 and 4x4 mipmaps, two layers
+    auto texels = gradient(8, 8);
+    auto level1 = gradient(4, 4);
+
+    texels.insert(texels.end(), level1.begin(), level1.end());
+
+    const auto layer = texels;
+
+    texels.insert(texels.end(), layer.begin(), layer.end());
+
+    const surface source(surface_format::color, 8, 8, 2, 2, false, std::move(texels));
+    const auto    encoded = source.transform(surface_format::dxt5);
+    const auto    decoded = encoded.transform(surface_format::color);
+
+    EXPECT_EQ(surface_format::dxt5, encoded.format());
+    EXPECT_EQ(2u, encoded.level_count());
+    EXPECT_EQ(2u, encoded.layer_count());
+    EXPECT_EQ(64, encoded.mipmaps(1)[0].view().size());
+    EXPECT_EQ(16, encoded.mipmaps(1)[1].view().size());
+
+    EXPECT_EQ(surface_format::color, decoded.format());
+    EXPECT_EQ(4u, decoded.mipmaps(1)[1].width());
+    EXPECT_EQ(64, decoded.mipmaps(1)[1].view().size());
+
+    EXPECT_TRUE(surface::can_transform(surface_format::bc7, surface_format::color));
+    EXPECT_FALSE(surface::can_transform(surface_format::bc6h, surface_format::color));
+    EXPECT_FALSE(surface::can_transform(surface_format::color, surface_format::bc7));
+}
@@ -0,0 +1,54 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_BLOCKCOMPRESSIONTEST_HPP
+#define TESTS_BLOCKCOMPRESSIONTEST_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+class block_compression_test : public testing::Test
+{
+protected:
+    static std::vector<std::uint8_t> gradient(std::uint32_t width, std::uint32_t height)
+    {
+        std::vector<std::uint8_t> texels(width * height * 4);
+
+        for (std::uint32_t y = 0; y < height; ++y)
+        {
+            for (std::uint32_t x = 0; x < width; ++x)
+            {
+                const auto value = static_cast<std::uint8_t>((x + y) * 255 / (width + height - 2));
+                auto       texel = texels.data() + (y * width + x) * 4;
+
+                texel[0] = value;
+                texel[1] = value;
+                texel[2] = static_cast<std::uint8_t>(255 - value);
+                texel[3] = value;
+            }
+        }
+
+        return texels;
+    }
+
+    static int max_error(const std::vector<std::uint8_t>& lhs, const std::vector<std::uint8_t>& rhs, std::uint32_t channels)
+    {
+        int error = 0;
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            if ((i % 4) < channels)
+            {
+                error = std::max(error, std::abs(static_cast<int>(lhs[i]) - static_cast<int>(rhs[i])));
+            }
+        }
+
+        return error;
+    }
+};
+
+#endif // TESTS_BLOCKCOMPRESSIONTEST_HPP
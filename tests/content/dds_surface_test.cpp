@@ -0,0 +1,126 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "dds_surface_test.hpp"
+
+#include <utility>
+
+#include <scener/content/dds/surface.hpp>
+
+using namespace scener;
+using namespace scener::content::dds;
+using scener::graphics::surface_format;
+
+TEST_F(dds_surface_test, dx10_header_keeps_the_color_space)
+{
+    const std::pair<dxgi_format, surface_format> formats[] =
+    {
+        { dxgi_format::r8g8b8a8_unorm     , surface_format::color       }
+      , { dxgi_format::r8g8b8a8_unorm_srgb, surface_format::color_srgb  }
+      , { dxgi_format::b8g8r8a8_unorm     , surface_format::bgra32      }
+      , { dxgi_format::b8g8r8a8_unorm_srgb, surface_format::bgra32_srgb }
+      , { dxgi_format::bc1_unorm          , surface_format::dxt1        }
+      , { dxgi_format::bc1_unorm_srgb     , surface_format::dxt1_srgb   }
+      , { dxgi_format::bc2_unorm_srgb     , surface_format::dxt3_srgb   }
+      , { dxgi_format::bc3_unorm_srgb     , surface_format::dxt5_srgb   }
+      , { dxgi_format::bc6h_uf16          , surface_format::bc6h        }
+      , { dxgi_format::bc6h_sf16          , surface_format::bc6h_signed }
+      , { dxgi_format::bc7_unorm          , surface_format::bc7         }
+      , { dxgi_format::bc7_unorm_srgb     , surface_format::bc7_srgb    }
+    };
+
+    for (const auto& format : formats)
+    {
+        const auto dxt10    = dxt10_header(format.first, 1, false);
+        const auto size     = surface::mipmap_size(format.second, 4, 4);
+        const auto filename = write("dx10_format.dds", dx10_file_header(4, 4, 1), &dxt10, layers(1, size));
+
+        surface dds;
+
+        dds.load(filename);
+
+        EXPECT_EQ(format.second, dds.format());
+        EXPECT_EQ(1u, dds.layer_count());
+        EXPECT_EQ(1u, dds.level_count());
+        EXPECT_FALSE(dds.is_cubemap());
+    }
+}
+
+TEST_F(dds_surface_test, dx10_array_size_loads_every_layer)
+{
+    const auto dxt10      = dxt10_header(dxgi_format::r8g8b8a8_unorm, 3, false);
+    const auto layer_size = surface::mipmap_size(surface_format::color, 8, 8) + surface::mipmap_size(surface_format::color, 4, 4);
+    const auto filename   = write("dx10_array.dds", dx10_file_header(8, 8, 2), &dxt10, layers(3, layer_size));
+
+    surface dds;
+
+    dds.load(filename);
+
+    ASSERT_EQ(3u, dds.layer_count());
+    ASSERT_EQ(2u, dds.level_count());
+    EXPECT_FALSE(dds.is_cubemap());
+
+    for (std::uint32_t layer = 0; layer < dds.layer_count(); ++layer)
+    {
+        const auto& mipmaps = dds.mipmaps(layer);
+
+        EXPECT_EQ(8u, mipmaps[0].width());
+        EXPECT_EQ(4u, mipmaps[1].width());
+        EXPECT_EQ(layer, mipmaps[0].view()[0]);
+        EXPECT_EQ(layer, mipmaps[1].view()[mipmaps[1].view().size() - 1]);
+    }
+}
+
+TEST_F(dds_surface_test, dx10_cube_maps_have_six_faces_per_cube)
+{
+    const auto dxt10      = dxt10_header(dxgi_format::bc1_unorm_srgb, 2, true);
+    const auto layer_size = surface::mipmap_size(surface_format::dxt1_srgb, 4, 4);
+    const auto filename   = write("dx10_cube.dds", dx10_file_header(4, 4, 1), &dxt10, layers(12, layer_size));
+
+    surface dds;
+
+    dds.load(filename);
+
+    EXPECT_TRUE(dds.is_cubemap());
+    EXPECT_EQ(surface_format::dxt1_srgb, dds.format());
+    ASSERT_EQ(12u, dds.layer_count());
+    EXPECT_EQ(11u, dds.mipmaps(11)[0].view()[0]);
+}
+
+TEST_F(dds_surface_test, legacy_cube_maps_have_six_faces)
+{
+    auto dds_header = file_header(4, 4, 1);
+
+    dds_header.pixel_format.flags  = pixel_format_flags::fourcc;
+    dds_header.pixel_format.fourcc = fourcc::dxt5;
+    dds_header.caps2               = static_cast<std::uint32_t>(caps2::cubemap
+                                                              | caps2::cubemap_positivex | caps2::cubemap_negativex
+                                                              | caps2::cubemap_positivey | caps2::cubemap_negativey
+                                                              | caps2::cubemap_positivez | caps2::cubemap_negativez);
+
+    const auto layer_size = surface::mipmap_size(surface_format::dxt5, 4, 4);
+    const auto filename   = write("legacy_cube.dds", dds_header, nullptr, layers(6, layer_size));
+
+    surface dds;
+
+    dds.load(filename);
+
+    // Legacy pixel formats carry no color space, color data is loaded as sRGB
+    EXPECT_EQ(surface_format::dxt5_srgb, dds.format());
+    EXPECT_TRUE(dds.is_cubemap());
+    ASSERT_EQ(6u, dds.layer_count());
+    EXPECT_EQ(5u, dds.mipmaps(5)[0].view()[0]);
+}
+
+TEST_F(dds_surface_test, transforms_keep_the_color_space)
+{
+    EXPECT_TRUE(surface::is_srgb(surface_format::bc7_srgb));
+    EXPECT_FALSE(surface::is_srgb(surface_format::bc7));
+    EXPECT_TRUE(surface::is_compressed(surface_format::bc6h_signed));
+
+    EXPECT_TRUE(surface::can_transform(surface_format::dxt1_srgb, surface_format::color_srgb));
+    EXPECT_TRUE(surface::can_transform(surface_format::color_srgb, surface_format::dxt5_srgb));
+    EXPECT_FALSE(surface::can_transform(surface_format::dxt1_srgb, surface_format::color));
+    EXPECT_FALSE(surface::can_transform(surface_format::color, surface_format::dxt5_srgb));
+    EXPECT_FALSE(surface::can_transform(surface_format::bc6h_signed, surface_format::color));
+}
@@ -0,0 +1,128 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_DDSSURFACETEST_HPP
+#define TESTS_DDSSURFACETEST_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <scener/content/dds/header.hpp>
+#include <scener/content/dds/header_dxt10.hpp>
+
+class dds_surface_test : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        for (const auto& filename : _files)
+        {
+            std::remove(filename.c_str());
+        }
+    }
+
+    /// Creates a file header with the required flags set; the pixel format is left for the caller.
+    static scener::content::dds::header file_header(std::uint32_t width, std::uint32_t height, std::uint32_t levels)
+    {
+        using namespace scener::content::dds;
+
+        header result = { };
+
+        result.magic             = 0x20534444;
+        result.size              = 124;
+        result.flags             = header_flags::caps | header_flags::height | header_flags::width
+                                 | header_flags::pixelformat | header_flags::mipmapcount;
+        result.height            = height;
+        result.width             = width;
+        result.mipmap_count      = levels;
+        result.pixel_format.size = 32;
+        result.caps              = caps::texture;
+
+        return result;
+    }
+
+    /// Creates a DX10 extended header for a 2D texture, a texture array or a cube map array.
+    static scener::content::dds::header_dxt10 dxt10_header(scener::content::dds::dxgi_format format
+                                                         , std::uint32_t                     array_size
+                                                         , bool                              cubemap)
+    {
+        using namespace scener::content::dds;
+
+        header_dxt10 result = { };
+
+        result.dxgi_format        = format;
+        result.resource_dimension = resource_dimension::texture2d;
+        result.misc_flag          = cubemap ? header_dxt10::misc_texturecube : 0;
+        result.array_size         = array_size;
+
+        return result;
+    }
+
+    static scener::content::dds::header dx10_file_header(std::uint32_t width, std::uint32_t height, std::uint32_t levels)
+    {
+        using namespace scener::content::dds;
+
+        auto result = file_header(width, height, levels);
+
+        result.pixel_format.flags  = pixel_format_flags::fourcc;
+        result.pixel_format.fourcc = fourcc::dx10;
+
+        return result;
+    }
+
+    /// Writes a DDS file to the temporary directory; the file is removed when the test ends.
+    std::string write(const std::string&                         name
+                    , const scener::content::dds::header&        dds_header
+                    , const scener::content::dds::header_dxt10*  dxt10
+                    , const std::vector<std::uint8_t>&           data)
+    {
+        const auto filename = testing::TempDir() + name;
+
+        std::vector<std::uint8_t> contents(sizeof dds_header);
+
+        std::memcpy(contents.data(), &dds_header, sizeof dds_header);
+
+        if (dxt10 != nullptr)
+        {
+            contents.resize(contents.size() + sizeof *dxt10);
+
+            std::memcpy(contents.data() + sizeof dds_header, dxt10, sizeof *dxt10);
+        }
+
+        contents.insert(contents.end(), data.begin(), data.end());
+
+        auto file = std::fopen(filename.c_str(), "wb");
+
+        EXPECT_NE(nullptr, file);
+
+        std::fwrite(contents.data(), 1, contents.size(), file);
+        std::fclose(file);
+
+        _files.push_back(filename);
+
+        return filename;
+    }
+
+    /// Creates the data of a layered surface where every byte of a layer holds the layer index.
+    static std::vector<std::uint8_t> layers(std::uint32_t count, std::size_t layer_size)
+    {
+        std::vector<std::uint8_t> data(count * layer_size);
+
+        for (std::uint32_t layer = 0; layer < count; ++layer)
+        {
+            std::memset(data.data() + layer * layer_size, static_cast<int>(layer), layer_size);
+        }
+
+        return data;
+    }
+
+private:
+    std::vector<std::string> _files;
+};
+
+#endif // TESTS_DDSSURFACETEST_HPP
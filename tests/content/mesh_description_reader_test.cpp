@@ -0,0 +1,39 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "mesh_description_reader_test.hpp"
+
+#include <scener/content/readers/mesh_description_reader.hpp>
+#include <scener/content/vertex_packer.hpp>
+#include <scener/content/gltf/attribute_type.hpp>
+#include <scener/content/gltf/component_type.hpp>
+#include <scener/graphics/vertex_element_format.hpp>
+
+using namespace scener::content;
+using scener::content::gltf::attribute_type;
+using scener::content::gltf::component_type;
+using scener::graphics::vertex_element_format;
+
+using reader = scener::content::readers::content_type_reader<mesh_description>;
+
+TEST_F(mesh_description_reader_test, float_attributes)
+{
+    EXPECT_EQ(vertex_element_format::single , reader::get_vertex_element_format(attribute_type::scalar , component_type::single));
+    EXPECT_EQ(vertex_element_format::vector2, reader::get_vertex_element_format(attribute_type::vector2, component_type::single));
+    EXPECT_EQ(vertex_element_format::vector3, reader::get_vertex_element_format(attribute_type::vector3, component_type::single));
+    EXPECT_EQ(vertex_element_format::vector4, reader::get_vertex_element_format(attribute_type::vector4, component_type::single));
+}
+
+TEST_F(mesh_description_reader_test, integer_joint_attributes)
+{
+    EXPECT_EQ(vertex_element_format::byte4  , reader::get_vertex_element_format(attribute_type::vector4, component_type::ubyte));
+    EXPECT_EQ(vertex_element_format::ushort4, reader::get_vertex_element_format(attribute_type::vector4, component_type::uint16));
+    EXPECT_EQ(vertex_element_format::short4 , reader::get_vertex_element_format(attribute_type::vector4, component_type::int16));
+    EXPECT_EQ(vertex_element_format::short2 , reader::get_vertex_element_format(attribute_type::vector2, component_type::int16));
+
+    // Same size as the accessor elements, so the interleaved strides match
+    EXPECT_EQ(4u, vertex_packer::element_size(vertex_element_format::byte4));
+    EXPECT_EQ(8u, vertex_packer::element_size(vertex_element_format::ushort4));
+    EXPECT_EQ(8u, vertex_packer::element_size(vertex_element_format::short4));
+    EXPECT_EQ(4u, vertex_packer::element_size(vertex_element_format::short2));
+}
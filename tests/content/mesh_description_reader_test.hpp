@@ -0,0 +1,13 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_MESHDESCRIPTIONREADERTEST_HPP
+#define TESTS_MESHDESCRIPTIONREADERTEST_HPP
+
+#include <gtest/gtest.h>
+
+class mesh_description_reader_test : public testing::Test
+{
+};
+
+#endif // TESTS_MESHDESCRIPTIONREADERTEST_HPP
@@ -0,0 +1,56 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "mesh_optimizer_test.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include <scener/content/mesh_optimizer.hpp>
+
+using namespace scener::content;
+
+TEST_F(mesh_optimizer_test, vertex_cache_reduces_cache_misses)
+{
+    const std::uint32_t size         = 32;
+    const std::uint32_t vertex_count = (size + 1) * (size + 1);
+    const auto          source       = shuffled_grid(size);
+
+    auto indices = source;
+
+    const auto clusters = mesh_optimizer::optimize_vertex_cache(indices, vertex_count);
+
+    EXPECT_FALSE(clusters.empty());
+    EXPECT_EQ(0u, clusters[0]);
+    EXPECT_EQ(triangle_set(source), triangle_set(indices));
+    EXPECT_LT(mesh_optimizer::average_cache_miss_ratio(indices, vertex_count), 0.5f * mesh_optimizer::average_cache_miss_ratio(source, vertex_count));
+    EXPECT_GT(0.9f, mesh_optimizer::average_cache_miss_ratio(indices, vertex_count));
+}
+
+TEST_F(mesh_optimizer_test, overdraw_keeps_triangles)
+{
+    const std::uint32_t size         = 16;
+    const std::uint32_t vertex_count = (size + 1) * (size + 1);
+    const auto          source       = shuffled_grid(size);
+
+    auto indices = source;
+
+    const auto clusters = mesh_optimizer::optimize_vertex_cache(indices, vertex_count);
+    const auto acmr     = mesh_optimizer::average_cache_miss_ratio(indices, vertex_count);
+
+    mesh_optimizer::optimize_overdraw(indices, clusters, grid_positions(size));
+
+    EXPECT_EQ(triangle_set(source), triangle_set(indices));
+    EXPECT_GE(acmr * 1.25f, mesh_optimizer::average_cache_miss_ratio(indices, vertex_count));
+}
+
+TEST_F(mesh_optimizer_test, vertex_fetch_orders_vertices_by_first_use)
+{
+    std::vector<std::uint32_t> indices     = { 3, 1, 2, 2, 1, 0 };
+    std::vector<std::uint8_t>  vertex_data = { 10, 11, 12, 13, 14 };
+
+    mesh_optimizer::optimize_vertex_fetch(indices, vertex_data, 1);
+
+    EXPECT_EQ((std::vector<std::uint32_t> { 0, 1, 2, 2, 1, 3 }), indices);
+    EXPECT_EQ((std::vector<std::uint8_t> { 13, 11, 12, 10, 14 }), vertex_data);
+}
@@ -0,0 +1,85 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_MESHOPTIMIZERTEST_HPP
+#define TESTS_MESHOPTIMIZERTEST_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+class mesh_optimizer_test : public testing::Test
+{
+protected:
+    /// Builds a grid of size x size quads, two triangles each, with the triangles in random order.
+    static std::vector<std::uint32_t> shuffled_grid(std::uint32_t size)
+    {
+        std::vector<std::array<std::uint32_t, 3>> triangles;
+
+        for (std::uint32_t y = 0; y < size; ++y)
+        {
+            for (std::uint32_t x = 0; x < size; ++x)
+            {
+                const auto v0 = y * (size + 1) + x;
+                const auto v1 = v0 + 1;
+                const auto v2 = v0 + size + 1;
+                const auto v3 = v2 + 1;
+
+                triangles.push_back({ v0, v2, v1 });
+                triangles.push_back({ v1, v2, v3 });
+            }
+        }
+
+        std::shuffle(triangles.begin(), triangles.end(), std::mt19937 { 42 });
+
+        std::vector<std::uint32_t> indices;
+
+        for (const auto& triangle : triangles)
+        {
+            indices.insert(indices.end(), triangle.begin(), triangle.end());
+        }
+
+        return indices;
+    }
+
+    /// Gets the triangles of an index list, rotated so the smallest index comes first, sorted.
+    static std::vector<std::array<std::uint32_t, 3>> triangle_set(const std::vector<std::uint32_t>& indices)
+    {
+        std::vector<std::array<std::uint32_t, 3>> triangles;
+
+        for (std::size_t i = 0; i < indices.size(); i += 3)
+        {
+            std::array<std::uint32_t, 3> triangle = { indices[i], indices[i + 1], indices[i + 2] };
+
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+
+            triangles.push_back(triangle);
+        }
+
+        std::sort(triangles.begin(), triangles.end());
+
+        return triangles;
+    }
+
+    /// Gets the positions of the grid vertices, on the z = 0 plane.
+    static std::vector<float> grid_positions(std::uint32_t size)
+    {
+        std::vector<float> positions;
+
+        for (std::uint32_t y = 0; y <= size; ++y)
+        {
+            for (std::uint32_t x = 0; x <= size; ++x)
+            {
+                positions.insert(positions.end(), { static_cast<float>(x), static_cast<float>(y), 0.0f });
+            }
+        }
+
+        return positions;
+    }
+};
+
+#endif // TESTS_MESHOPTIMIZERTEST_HPP
@@ -0,0 +1,154 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "texture_atlas_test.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <scener/content/dds/texture_atlas.hpp>
+
+using namespace scener;
+using namespace scener::content::dds;
+using scener::graphics::surface_format;
+
+TEST_F(texture_atlas_test, pack_color_surfaces)
+{
+    const auto a = solid(16, 16, 0x10);
+    const auto b = solid(8, 4, 0x20);
+    const auto c = solid(32, 8, 0x30);
+
+    texture_atlas atlas(surface_format::color, 256);
+
+    EXPECT_TRUE(atlas.pack({ &a, &b, &c }));
+
+    const auto& result  = atlas.atlas();
+    const auto& regions = atlas.regions();
+    const auto& mipmap  = result.mipmap(0);
+
+    EXPECT_EQ(1u, result.level_count());
+    EXPECT_EQ(3u, regions.size());
+
+    const std::uint8_t values[3] = { 0x10, 0x20, 0x30 };
+
+    for (std::size_t i = 0; i < regions.size(); ++i)
+    {
+        const auto& region = regions[i];
+
+        EXPECT_LE(region.x + region.width , result.width());
+        EXPECT_LE(region.y + region.height, result.height());
+        EXPECT_FLOAT_EQ(static_cast<float>(region.x) / result.width(), region.u_offset);
+        EXPECT_FLOAT_EQ(static_cast<float>(region.width) / result.width(), region.u_scale);
+
+        for (std::uint32_t y = region.y; y < region.y + region.height; ++y)
+        {
+            for (std::uint32_t x = region.x; x < region.x + region.width; ++x)
+            {
+                EXPECT_EQ(values[i], mipmap.view()[(y * result.width() + x) * 4]);
+            }
+        }
+    }
+
+    // Regions, gutters included, never overlap
+    const auto padding = atlas.padding();
+
+    EXPECT_EQ(1u, padding);
+
+    for (std::size_t i = 0; i < regions.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < regions.size(); ++j)
+        {
+            const auto& l = regions[i];
+            const auto& r = regions[j];
+
+            EXPECT_TRUE(l.x + l.width + padding * 2 <= r.x || r.x + r.width + padding * 2 <= l.x
+                     || l.y + l.height + padding * 2 <= r.y || r.y + r.height + padding * 2 <= l.y);
+        }
+    }
+}
+
+TEST_F(texture_atlas_test, gutters_replicate_the_region_edges)
+{
+    const auto a = gradient(4, 3);
+    const auto b = solid(4, 4, 0xFF);
+
+    texture_atlas atlas(surface_format::color, 64, 2);
+
+    EXPECT_TRUE(atlas.pack({ &a, &b }));
+
+    const auto& result = atlas.atlas();
+    const auto& region = atlas.regions()[0];
+    const auto  view   = result.mipmap(0).view();
+    const auto  texel  = [&] (std::uint32_t x, std::uint32_t y) -> std::uint8_t {
+        return view[(y * result.width() + x) * 4];
+    };
+
+    ASSERT_LE(2u, region.x);
+    ASSERT_LE(2u, region.y);
+
+    const auto right  = region.x + region.width  - 1;
+    const auto bottom = region.y + region.height - 1;
+
+    for (std::uint32_t y = region.y; y <= bottom; ++y)
+    {
+        EXPECT_EQ(texel(region.x, y), texel(region.x - 1, y));
+        EXPECT_EQ(texel(region.x, y), texel(region.x - 2, y));
+        EXPECT_EQ(texel(right, y)   , texel(right + 1, y));
+        EXPECT_EQ(texel(right, y)   , texel(right + 2, y));
+    }
+
+    for (std::uint32_t x = region.x; x <= right; ++x)
+    {
+        EXPECT_EQ(texel(x, region.y), texel(x, region.y - 2));
+        EXPECT_EQ(texel(x, bottom)  , texel(x, bottom + 2));
+    }
+
+    // Corners repeat the corner texels
+    EXPECT_EQ(texel(region.x, region.y), texel(region.x - 2, region.y - 2));
+    EXPECT_EQ(texel(right, bottom)     , texel(right + 2, bottom + 2));
+    EXPECT_NE(texel(region.x, region.y), texel(right, bottom));
+}
+
+TEST_F(texture_atlas_test, pack_block_compressed_surfaces)
+{
+    std::vector<std::uint8_t> blocks_a(2 * 2 * 8, 0xAA);
+    std::vector<std::uint8_t> blocks_b(1 * 1 * 8, 0xBB);
+
+    const surface a(surface_format::dxt1, 8, 8, 1, 1, false, std::move(blocks_a));
+    const surface b(surface_format::dxt1, 2, 2, 1, 1, false, std::move(blocks_b));
+
+    texture_atlas atlas(surface_format::dxt1, 64);
+
+    EXPECT_TRUE(atlas.pack({ &a, &b }));
+
+    const auto& result  = atlas.atlas();
+    const auto& regions = atlas.regions();
+
+    EXPECT_EQ(surface_format::dxt1, result.format());
+    EXPECT_EQ(0u, regions[1].x % 4);
+    EXPECT_EQ(0u, regions[1].y % 4);
+    EXPECT_EQ(2u, regions[1].width);
+
+    // The small surface block is copied untouched, and repeated in the one block gutter around it
+    const auto pitch  = (result.width() / 4) * 8;
+    const auto offset = (regions[1].y / 4) * pitch + (regions[1].x / 4) * 8;
+
+    EXPECT_EQ(4u, atlas.padding());
+    EXPECT_EQ(0xBB, result.mipmap(0).view()[offset]);
+    EXPECT_EQ(0xBB, result.mipmap(0).view()[offset - 8]);
+    EXPECT_EQ(0xBB, result.mipmap(0).view()[offset + 8]);
+    EXPECT_EQ(0xBB, result.mipmap(0).view()[offset - pitch - 8]);
+    EXPECT_EQ(0xBB, result.mipmap(0).view()[offset + pitch + 8]);
+}
+
+TEST_F(texture_atlas_test, pack_exceeding_max_size)
+{
+    const auto a = solid(32, 32, 0);
+    const auto b = solid(32, 32, 0);
+
+    texture_atlas atlas(surface_format::color, 32);
+
+    EXPECT_FALSE(atlas.pack({ &a, &b }));
+    EXPECT_TRUE(atlas.regions().empty());
+}
@@ -0,0 +1,39 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_TEXTUREATLASTEST_HPP
+#define TESTS_TEXTUREATLASTEST_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <scener/content/dds/surface.hpp>
+
+class texture_atlas_test : public testing::Test
+{
+protected:
+    /// Creates a single level color surface filled with the given value.
+    static scener::content::dds::surface solid(std::uint32_t width, std::uint32_t height, std::uint8_t value)
+    {
+        std::vector<std::uint8_t> data(width * height * 4, value);
+
+        return { scener::graphics::surface_format::color, width, height, 1, 1, false, std::move(data) };
+    }
+
+    /// Creates a single level color surface where every texel holds a distinct value.
+    static scener::content::dds::surface gradient(std::uint32_t width, std::uint32_t height)
+    {
+        std::vector<std::uint8_t> data(width * height * 4);
+
+        for (std::uint32_t i = 0; i < width * height; ++i)
+        {
+            data[i * 4] = static_cast<std::uint8_t>(i + 1);
+        }
+
+        return { scener::graphics::surface_format::color, width, height, 1, 1, false, std::move(data) };
+    }
+};
+
+#endif // TESTS_TEXTUREATLASTEST_HPP
@@ -0,0 +1,135 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "vertex_packer_test.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <scener/content/model_description.hpp>
+#include <scener/content/vertex_packer.hpp>
+
+using namespace scener::content;
+using scener::graphics::vertex_element_format;
+using scener::graphics::vertex_element_usage;
+
+TEST_F(vertex_packer_test, half_roundtrip)
+{
+    const float values[] = { 0.0f, 1.0f, -2.5f, 0.333333f, 65504.0f, 6.1035156e-05f, 5.9604645e-08f };
+
+    for (const auto value : values)
+    {
+        EXPECT_NEAR(value, vertex_packer::from_half(vertex_packer::to_half(value)), std::abs(value) * 0.001f);
+    }
+
+    EXPECT_EQ(0x3C00, vertex_packer::to_half(1.0f));
+    EXPECT_EQ(0x7C00, vertex_packer::to_half(1.0e6f));
+    EXPECT_EQ(0x8000, vertex_packer::to_half(-0.0f));
+}
+
+TEST_F(vertex_packer_test, snorm_1010102)
+{
+    const auto packed = vertex_packer::pack_snorm_1010102(1.0f, -1.0f, 0.0f, -1.0f);
+
+    EXPECT_EQ(511u, packed & 0x3FF);
+    EXPECT_EQ(0x201u, (packed >> 10) & 0x3FF);
+    EXPECT_EQ(0u, (packed >> 20) & 0x3FF);
+    EXPECT_EQ(3u, packed >> 30);
+}
+
+TEST_F(vertex_packer_test, pack_skinned_vertex)
+{
+    mesh_part_description part;
+
+    part.vertex_count    = 2;
+    part.vertex_stride   = 64;
+    part.vertex_elements = { { 0 , vertex_element_format::vector3, vertex_element_usage::position          , 0 }
+                           , { 12, vertex_element_format::vector2, vertex_element_usage::texture_coordinate, 2 }
+                           , { 20, vertex_element_format::vector3, vertex_element_usage::normal            , 3 }
+                           , { 32, vertex_element_format::vector4, vertex_element_usage::blend_indices     , 6 }
+                           , { 48, vertex_element_format::vector4, vertex_element_usage::blend_weight      , 7 } };
+
+    for (std::uint32_t v = 0; v < part.vertex_count; ++v)
+    {
+        append(part.vertex_data, { 1.0f, 2.0f, 3.0f });
+        append(part.vertex_data, { 0.25f, 0.75f });
+        append(part.vertex_data, { 0.0f, 1.0f, 0.0f });
+        append(part.vertex_data, { 3.0f, 7.0f, 0.0f, 0.0f });
+        append(part.vertex_data, { 0.333f, 0.333f, 0.334f, 0.0f });
+    }
+
+    vertex_packer::pack(part, [] (vertex_element_format) -> bool { return true; });
+
+    EXPECT_EQ(28u, part.vertex_stride);
+    EXPECT_EQ(56u, part.vertex_data.size());
+    EXPECT_EQ(vertex_element_format::vector3          , part.vertex_elements[0].format());
+    EXPECT_EQ(vertex_element_format::half_vector2     , part.vertex_elements[1].format());
+    EXPECT_EQ(vertex_element_format::normalized_packed, part.vertex_elements[2].format());
+    EXPECT_EQ(vertex_element_format::byte4            , part.vertex_elements[3].format());
+    EXPECT_EQ(vertex_element_format::color            , part.vertex_elements[4].format());
+    EXPECT_EQ(24u, part.vertex_elements[4].offset());
+
+    const auto vertex = part.vertex_data.data() + 28;
+
+    float position[3];
+    std::uint16_t uv[2];
+
+    std::memcpy(position, vertex, sizeof(position));
+    std::memcpy(uv, vertex + 12, sizeof(uv));
+
+    EXPECT_EQ(2.0f, position[1]);
+    EXPECT_EQ(0.75f, vertex_packer::from_half(uv[1]));
+    EXPECT_EQ(3, vertex[20]);
+    EXPECT_EQ(7, vertex[21]);
+    EXPECT_EQ(255, vertex[24] + vertex[25] + vertex[26] + vertex[27]);
+}
+
+TEST_F(vertex_packer_test, keep_unsupported_formats)
+{
+    mesh_part_description part;
+
+    part.vertex_count    = 1;
+    part.vertex_stride   = 20;
+    part.vertex_elements = { { 0 , vertex_element_format::vector3, vertex_element_usage::position          , 0 }
+                           , { 12, vertex_element_format::vector2, vertex_element_usage::texture_coordinate, 2 } };
+
+    append(part.vertex_data, { 1.0f, 2.0f, 3.0f, 0.5f, 0.5f });
+
+    const auto source = part.vertex_data;
+
+    vertex_packer::pack(part, [] (vertex_element_format) -> bool { return false; });
+
+    EXPECT_EQ(20u, part.vertex_stride);
+    EXPECT_EQ(source, part.vertex_data);
+}
+
+TEST_F(vertex_packer_test, keep_integer_sources)
+{
+    mesh_part_description part;
+
+    part.vertex_count    = 1;
+    part.vertex_stride   = 24;
+    part.vertex_elements = { { 0 , vertex_element_format::vector3, vertex_element_usage::position     , 0 }
+                           , { 12, vertex_element_format::short4 , vertex_element_usage::blend_indices, 6 }
+                           , { 20, vertex_element_format::color  , vertex_element_usage::blend_weight , 7 } };
+
+    append(part.vertex_data, { 1.0f, 2.0f, 3.0f });
+
+    // Joints 300 and 2, weights 0.5 and 0.5
+    const std::uint8_t joints[]  = { 0x2C, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    const std::uint8_t weights[] = { 128, 127, 0, 0 };
+
+    part.vertex_data.insert(part.vertex_data.end(), std::begin(joints) , std::end(joints));
+    part.vertex_data.insert(part.vertex_data.end(), std::begin(weights), std::end(weights));
+
+    const auto source = part.vertex_data;
+
+    vertex_packer::pack(part, [] (vertex_element_format) -> bool { return true; });
+
+    EXPECT_EQ(24u, part.vertex_stride);
+    EXPECT_EQ(vertex_element_format::short4, part.vertex_elements[1].format());
+    EXPECT_EQ(vertex_element_format::color , part.vertex_elements[2].format());
+    EXPECT_EQ(source, part.vertex_data);
+}
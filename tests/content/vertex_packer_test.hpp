@@ -0,0 +1,27 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_VERTEXPACKERTEST_HPP
+#define TESTS_VERTEXPACKERTEST_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+class vertex_packer_test : public testing::Test
+{
+protected:
+    /// Appends the given floats to the vertex data.
+    static void append(std::vector<std::uint8_t>& data, const std::vector<float>& values)
+    {
+        const auto position = data.size();
+
+        data.resize(position + values.size() * sizeof(float));
+
+        std::memcpy(data.data() + position, values.data(), values.size() * sizeof(float));
+    }
+};
+
+#endif // TESTS_VERTEXPACKERTEST_HPP
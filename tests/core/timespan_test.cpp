@@ -185,3 +185,56 @@ TEST_F(timespan_test, total_seconds)
 
     EXPECT_TRUE(interval.total_seconds() == 142965.75);
 }
+
+TEST_F(timespan_test, scale)
+{
+    constexpr auto interval = timespan::from_ticks(1000).scale(3, 4);
+
+    static_assert(interval.ticks() == 750);
+
+    EXPECT_TRUE(timespan::from_ticks(-1000).scale(1, 3).ticks() == -333);
+}
+
+TEST_F(timespan_test, ratio)
+{
+    constexpr auto ratio = timespan::from_ticks(250).ratio(timespan::from_ticks(1000), 1 << 16);
+
+    static_assert(ratio == (1 << 14));
+
+    EXPECT_TRUE(timespan::from_ticks(1000).ratio(timespan::from_ticks(1000), 100) == 100);
+}
+
+TEST_F(timespan_test, wrap)
+{
+    constexpr auto period = timespan::from_ticks(100);
+
+    static_assert(timespan::from_ticks(250).wrap(period).ticks() == 50);
+
+    EXPECT_TRUE(timespan::from_ticks(0).wrap(period).ticks()    == 0);
+    EXPECT_TRUE(timespan::from_ticks(100).wrap(period).ticks()  == 0);
+    EXPECT_TRUE(timespan::from_ticks(-30).wrap(period).ticks()  == 70);
+    EXPECT_TRUE(timespan::from_ticks(-200).wrap(period).ticks() == 0);
+}
+
+TEST_F(timespan_test, clamp)
+{
+    constexpr auto min = timespan::from_ticks(10);
+    constexpr auto max = timespan::from_ticks(20);
+
+    static_assert(timespan::from_ticks(5).clamp(min, max).ticks() == 10);
+
+    EXPECT_TRUE(timespan::from_ticks(15).clamp(min, max).ticks() == 15);
+    EXPECT_TRUE(timespan::from_ticks(25).clamp(min, max).ticks() == 20);
+}
+
+TEST_F(timespan_test, lerp)
+{
+    constexpr auto from = timespan::from_ticks(1000);
+    constexpr auto to   = timespan::from_ticks(2000);
+
+    static_assert(timespan::lerp(from, to, 1, 4).ticks() == 1250);
+
+    EXPECT_TRUE(timespan::lerp(to, from, 1, 2).ticks() == 1500);
+    EXPECT_TRUE(timespan::lerp(from, to, 0, 1).ticks() == 1000);
+    EXPECT_TRUE(timespan::lerp(from, to, 1, 1).ticks() == 2000);
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "profiler_test.hpp"
+
+#include <sstream>
+#include <string>
+
+using namespace scener::diagnostics;
+
+TEST_F(profiler_test, zone)
+{
+    {
+        profile_zone zone { "update", "renderer" };
+    }
+
+    const auto events = profiler::events();
+
+    EXPECT_EQ(1u, events.size());
+    EXPECT_EQ(std::string("update"), events[0].name);
+    EXPECT_EQ(std::string("renderer"), events[0].category);
+    EXPECT_NE(profiler::gpu_thread, events[0].thread);
+}
+
+TEST_F(profiler_test, disabled)
+{
+    profiler::enabled(false);
+
+    {
+        profile_zone zone { "update" };
+    }
+
+    profiler::mark("running_slowly", "renderer");
+    profiler::record_gpu("render_pass", 0, 100);
+
+    EXPECT_TRUE(profiler::events().empty());
+}
+
+TEST_F(profiler_test, gpu_timing)
+{
+    profiler::record_gpu("render_pass", 1000, 2500);
+
+    const auto events = profiler::events();
+
+    EXPECT_EQ(1u, events.size());
+    EXPECT_EQ(profiler::gpu_thread, events[0].thread);
+    EXPECT_EQ(1000u, events[0].start);
+    EXPECT_EQ(2500u, events[0].duration);
+}
+
+TEST_F(profiler_test, frame_counters)
+{
+    frame_counters counters;
+
+    counters.draws          = 3;
+    counters.pipeline_binds = 1;
+    counters.buffer_binds   = 2;
+
+    profiler::begin_frame();
+    profiler::add(counters);
+    profiler::add(counters);
+    profiler::add_uploaded_bytes(256);
+    profiler::end_frame();
+
+    profiler::begin_frame();
+    profiler::end_frame();
+
+    const auto frames = profiler::frames();
+
+    EXPECT_EQ(2u, frames.size());
+    EXPECT_EQ(6u, frames[0].counters.draws);
+    EXPECT_EQ(2u, frames[0].counters.pipeline_binds);
+    EXPECT_EQ(0u, frames[0].counters.descriptor_binds);
+    EXPECT_EQ(4u, frames[0].counters.buffer_binds);
+    EXPECT_EQ(256u, frames[0].counters.uploaded_bytes);
+    EXPECT_EQ(frames[0].frame + 1, frames[1].frame);
+    EXPECT_EQ(0u, frames[1].counters.draws);
+}
+
+TEST_F(profiler_test, capacity)
+{
+    profiler::capacity(2);
+
+    profiler::mark("a", "test");
+    profiler::mark("b", "test");
+    profiler::mark("c", "test");
+
+    EXPECT_EQ(2u, profiler::events().size());
+    EXPECT_EQ(1u, profiler::dropped());
+}
+
+TEST_F(profiler_test, chrome_trace)
+{
+    std::ostringstream stream;
+
+    profiler::record("draw", "renderer", 1000, 3500);
+    profiler::record_gpu("render_pass", 2000, 1250);
+    profiler::begin_frame();
+    profiler::end_frame();
+    profiler::write_chrome_trace(stream);
+
+    const auto trace = stream.str();
+
+    EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"draw\",\"cat\":\"renderer\",\"ph\":\"X\",\"ts\":1.000,\"dur\":2.500"));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"render_pass\",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":2.000,\"dur\":1.250"));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"frame_counters\",\"ph\":\"C\""));
+    EXPECT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+}
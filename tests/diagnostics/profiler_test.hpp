@@ -0,0 +1,28 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_DIAGNOSTICS_PROFILER_TEST_HPP
+#define TESTS_DIAGNOSTICS_PROFILER_TEST_HPP
+
+#include <gtest/gtest.h>
+
+#include <scener/diagnostics/profiler.hpp>
+
+class profiler_test : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        scener::diagnostics::profiler::clear();
+        scener::diagnostics::profiler::capacity(scener::diagnostics::profiler::default_capacity);
+        scener::diagnostics::profiler::enabled(true);
+    }
+
+    void TearDown() override
+    {
+        scener::diagnostics::profiler::enabled(false);
+        scener::diagnostics::profiler::clear();
+    }
+};
+
+#endif // TESTS_DIAGNOSTICS_PROFILER_TEST_HPP
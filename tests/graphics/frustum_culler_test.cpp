@@ -0,0 +1,105 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "frustum_culler_test.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace scener;
+using namespace scener::graphics;
+
+TEST_F(frustum_culler_test, spheres_inside_or_crossing_a_plane_are_visible)
+{
+    const auto culler = clip_space();
+
+    EXPECT_TRUE(culler.is_visible(sphere(0.0f, 0.0f, 0.5f, 0.1f)));
+    EXPECT_TRUE(culler.is_visible(sphere(1.2f, 0.0f, 0.5f, 0.5f)));
+    EXPECT_TRUE(culler.is_visible(sphere(0.0f, -1.2f, 0.5f, 0.5f)));
+    EXPECT_TRUE(culler.is_visible(sphere(0.0f, 0.0f, 0.5f, 10.0f)));
+}
+
+TEST_F(frustum_culler_test, spheres_outside_a_plane_are_culled)
+{
+    const auto culler = clip_space();
+
+    EXPECT_FALSE(culler.is_visible(sphere(-2.0f, 0.0f, 0.5f, 0.5f)));   // left
+    EXPECT_FALSE(culler.is_visible(sphere( 2.0f, 0.0f, 0.5f, 0.5f)));   // right
+    EXPECT_FALSE(culler.is_visible(sphere( 0.0f,-2.0f, 0.5f, 0.5f)));   // bottom
+    EXPECT_FALSE(culler.is_visible(sphere( 0.0f, 2.0f, 0.5f, 0.5f)));   // top
+    EXPECT_FALSE(culler.is_visible(sphere( 0.0f, 0.0f,-1.0f, 0.5f)));   // near
+    EXPECT_FALSE(culler.is_visible(sphere( 0.0f, 0.0f, 2.0f, 0.5f)));   // far
+}
+
+TEST_F(frustum_culler_test, batch_cull_matches_single_tests)
+{
+    const auto culler = clip_space();
+
+    // Not a multiple of four, so both the vectorized loop and the scalar tail are used
+    const std::vector<math::bounding_sphere> spheres =
+    {
+        sphere( 0.0f, 0.0f, 0.5f, 0.1f)
+      , sphere(-2.0f, 0.0f, 0.5f, 0.5f)
+      , sphere( 1.2f, 0.0f, 0.5f, 0.5f)
+      , sphere( 0.0f, 2.0f, 0.5f, 0.5f)
+      , sphere( 0.0f, 0.0f,-1.0f, 0.5f)
+      , sphere( 0.5f, 0.5f, 0.9f, 0.2f)
+      , sphere( 0.0f, 0.0f, 2.0f, 0.5f)
+    };
+
+    std::vector<std::uint8_t> visibility(spheres.size(), 2);
+
+    const auto visible = culler.cull(spheres, visibility);
+
+    std::size_t expected = 0;
+
+    for (std::size_t i = 0; i < spheres.size(); ++i)
+    {
+        const auto is_visible = culler.is_visible(spheres[i]);
+
+        EXPECT_EQ(is_visible ? 1u : 0u, visibility[i]);
+
+        expected += is_visible ? 1 : 0;
+    }
+
+    EXPECT_EQ(3u, expected);
+    EXPECT_EQ(expected, visible);
+}
+
+TEST_F(frustum_culler_test, transform_moves_the_center_and_scales_the_radius)
+{
+    const auto world = math::matrix::create_scale(math::vector3 { 2.0f, 3.0f, 1.0f })
+                     * math::matrix::create_translation(math::vector3 { 1.0f, 2.0f, 3.0f });
+
+    const auto result = frustum_culler::transform(sphere(1.0f, 0.0f, 0.0f, 1.0f), world);
+
+    EXPECT_FLOAT_EQ(3.0f, result.center.x);
+    EXPECT_FLOAT_EQ(2.0f, result.center.y);
+    EXPECT_FLOAT_EQ(3.0f, result.center.z);
+    EXPECT_FLOAT_EQ(3.0f, result.radius);
+}
+
+TEST_F(frustum_culler_test, merge_keeps_a_containing_sphere)
+{
+    const auto outer = sphere(0.0f, 0.0f, 0.0f, 5.0f);
+    const auto inner = sphere(1.0f, 1.0f, 0.0f, 1.0f);
+
+    const auto a = frustum_culler::merge(outer, inner);
+    const auto b = frustum_culler::merge(inner, outer);
+
+    EXPECT_FLOAT_EQ(5.0f, a.radius);
+    EXPECT_FLOAT_EQ(5.0f, b.radius);
+    EXPECT_FLOAT_EQ(0.0f, b.center.x);
+    EXPECT_FLOAT_EQ(0.0f, b.center.y);
+}
+
+TEST_F(frustum_culler_test, merge_encloses_disjoint_spheres)
+{
+    const auto result = frustum_culler::merge(sphere(-4.0f, 0.0f, 0.0f, 1.0f), sphere(4.0f, 0.0f, 0.0f, 2.0f));
+
+    // Spans from x = -5 to x = 6
+    EXPECT_FLOAT_EQ(5.5f, result.radius);
+    EXPECT_FLOAT_EQ(0.5f, result.center.x);
+    EXPECT_FLOAT_EQ(0.0f, result.center.y);
+    EXPECT_FLOAT_EQ(0.0f, result.center.z);
+}
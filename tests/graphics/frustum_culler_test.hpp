@@ -0,0 +1,27 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_FRUSTUMCULLERTEST_HPP
+#define TESTS_FRUSTUMCULLERTEST_HPP
+
+#include <gtest/gtest.h>
+
+#include <scener/graphics/frustum_culler.hpp>
+
+class frustum_culler_test : public testing::Test
+{
+protected:
+    /// Creates a culler for the identity view projection, whose frustum is the clip space box
+    /// x in [-1, 1], y in [-1, 1] and z in [0, 1].
+    static scener::graphics::frustum_culler clip_space()
+    {
+        return { scener::math::matrix4::identity() };
+    }
+
+    static scener::math::bounding_sphere sphere(float x, float y, float z, float radius)
+    {
+        return { { x, y, z }, radius };
+    }
+};
+
+#endif // TESTS_FRUSTUMCULLERTEST_HPP
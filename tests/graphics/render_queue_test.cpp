@@ -0,0 +1,191 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "render_queue_test.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <scener/graphics/frustum_culler.hpp>
+
+using namespace scener;
+using namespace scener::graphics;
+
+TEST_F(render_queue_test, opaque_draws_are_grouped_by_pipeline)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 1.0f);
+    queue.submit(packet(1, 1, 0), 2.0f);
+    queue.submit(packet(2, 0, 0), 3.0f);
+    queue.submit(packet(3, 1, 0), 4.0f);
+
+    EXPECT_TRUE(queue.sort());
+    EXPECT_EQ((std::vector<std::uint32_t> { 0, 2, 1, 3 }), order(queue));
+}
+
+TEST_F(render_queue_test, opaque_draws_are_grouped_by_pipeline_object)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 1.0f);
+    queue.submit(packet(1, 1, 0), 2.0f);
+    queue.submit(packet(2, 4, 0), 3.0f);
+
+    // Pipelines 0 and 4 share the pipeline object
+    queue.sort();
+
+    EXPECT_EQ((std::vector<std::uint32_t> { 0, 2, 1 }), order(queue));
+}
+
+TEST_F(render_queue_test, opaque_draws_sharing_a_pipeline_are_grouped_by_descriptor_sets)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 1.0f);
+    queue.submit(packet(1, 5, 0), 1.0f);
+    queue.submit(packet(2, 0, 0), 1.0f);
+    queue.submit(packet(3, 5, 0), 1.0f);
+
+    // Pipelines 0 and 5 share the pipeline object, but not the descriptor sets
+    EXPECT_TRUE(queue.sort());
+    EXPECT_EQ((std::vector<std::uint32_t> { 0, 2, 1, 3 }), order(queue));
+}
+
+TEST_F(render_queue_test, opaque_draws_sharing_state_go_front_to_back)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 100.0f);
+    queue.submit(packet(1, 0, 0), 1.0f);
+    queue.submit(packet(2, 0, 0), 10.0f);
+
+    queue.sort();
+
+    EXPECT_EQ((std::vector<std::uint32_t> { 1, 2, 0 }), order(queue));
+}
+
+TEST_F(render_queue_test, equal_keys_keep_submission_order)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 5.0f);
+    queue.submit(packet(1, 0, 0), 5.0f);
+    queue.submit(packet(2, 0, 0), 5.0f);
+
+    EXPECT_FALSE(queue.sort());
+    EXPECT_EQ((std::vector<std::uint32_t> { 0, 1, 2 }), order(queue));
+}
+
+TEST_F(render_queue_test, translucent_draws_go_after_opaque_draws)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0, true), 1.0f);
+    queue.submit(packet(1, 1, 1), 50.0f);
+    queue.submit(packet(2, 0, 0, true), 2.0f);
+    queue.submit(packet(3, 2, 2), 5.0f);
+
+    queue.sort();
+
+    ASSERT_EQ(4u, queue.size());
+    EXPECT_FALSE(queue.packets()[0].translucent);
+    EXPECT_FALSE(queue.packets()[1].translucent);
+    EXPECT_TRUE(queue.packets()[2].translucent);
+    EXPECT_TRUE(queue.packets()[3].translucent);
+}
+
+TEST_F(render_queue_test, translucent_draws_go_back_to_front_across_pipelines)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0, true), 1.0f);
+    queue.submit(packet(1, 1, 1, true), 100.0f);
+    queue.submit(packet(2, 0, 2, true), 10.0f);
+
+    queue.sort();
+
+    EXPECT_EQ((std::vector<std::uint32_t> { 1, 2, 0 }), order(queue));
+}
+
+TEST_F(render_queue_test, draw_order_takes_precedence_over_state_and_translucency)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0, false, 1), 1.0f);
+    queue.submit(packet(1, 1, 1, true , 0), 1.0f);
+    queue.submit(packet(2, 0, 0, false, 0), 1.0f);
+    queue.submit(packet(3, 1, 1, true , 1), 1.0f);
+
+    queue.sort();
+
+    EXPECT_EQ((std::vector<std::uint32_t> { 2, 1, 0, 3 }), order(queue));
+}
+
+TEST_F(render_queue_test, depth_updates_reorder_the_draws)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 1.0f);
+    queue.submit(packet(1, 0, 0), 10.0f);
+    queue.submit(packet(2, 0, 0, true), 1.0f);
+    queue.submit(packet(3, 0, 0, true), 10.0f);
+
+    queue.sort();
+
+    EXPECT_EQ((std::vector<std::uint32_t> { 0, 1, 3, 2 }), order(queue));
+
+    // Same depths, same order
+    queue.depth(0, 1.0f);
+    queue.depth(1, 10.0f);
+
+    EXPECT_FALSE(queue.sort());
+
+    // Depths are updated by queue position; the first opaque draw and the nearest translucent draw move back
+    queue.depth(0, 100.0f);
+    queue.depth(2, 1.0f);
+    queue.depth(3, 100.0f);
+
+    EXPECT_TRUE(queue.sort());
+    EXPECT_EQ((std::vector<std::uint32_t> { 1, 0, 2, 3 }), order(queue));
+}
+
+TEST_F(render_queue_test, cull_updates_the_visibility)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 1.0f);
+    queue.submit(packet(1, 0, 0), 1.0f);
+
+    // The identity view projection frustum is the clip space box
+    const frustum_culler                     culler  { math::matrix4::identity() };
+    const std::vector<std::size_t>           indices = { 0, 1 };
+    const std::vector<math::bounding_sphere> bounds  = { { { 0.0f, 0.0f, 0.5f }, 0.1f }
+                                                       , { { 5.0f, 0.0f, 0.5f }, 0.1f } };
+
+    EXPECT_TRUE(queue.cull(culler, indices, bounds));
+    EXPECT_TRUE(queue.packets()[0].visible);
+    EXPECT_FALSE(queue.packets()[1].visible);
+
+    // Nothing moved
+    EXPECT_FALSE(queue.cull(culler, indices, bounds));
+
+    EXPECT_TRUE(queue.visible(1, true));
+    EXPECT_FALSE(queue.visible(1, true));
+}
+
+TEST_F(render_queue_test, clear_removes_the_draws)
+{
+    render_queue queue;
+
+    queue.submit(packet(0, 0, 0), 1.0f);
+    queue.submit(packet(1, 1, 1), 1.0f);
+
+    EXPECT_EQ(2u, queue.size());
+
+    queue.clear();
+
+    EXPECT_EQ(0u, queue.size());
+    EXPECT_TRUE(queue.packets().empty());
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_RENDERQUEUETEST_HPP
+#define TESTS_RENDERQUEUETEST_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <scener/graphics/render_queue.hpp>
+
+class render_queue_test : public testing::Test
+{
+protected:
+    /// Pipelines 0 to 3 have distinct pipeline objects, pipelines 4 and 5 share the pipeline object of pipeline 0;
+    /// pipeline 5 binds its own descriptor sets.
+    render_queue_test()
+        : _pipelines { { pipeline(1), pipeline(2), pipeline(3), pipeline(4), pipeline(1), pipeline(1, 1) } }
+        , _buffers   { }
+    {
+    }
+
+    /// Creates a draw packet; the queue only compares the pipeline handles and the buffer addresses, neither of
+    /// them is ever dereferenced.
+    /// The start index identifies the packet.
+    scener::graphics::draw_packet packet(std::uint32_t id
+                                       , std::size_t   pipeline
+                                       , std::size_t   buffers
+                                       , bool          translucent = false
+                                       , std::uint32_t draw_order  = 0) const
+    {
+        scener::graphics::draw_packet result;
+
+        result.start_index   = id;
+        result.pipeline      = &_pipelines[pipeline];
+        result.vertex_buffer = reinterpret_cast<const scener::graphics::vertex_buffer*>(&_buffers[buffers]);
+        result.index_buffer  = reinterpret_cast<const scener::graphics::index_buffer*>(&_buffers[buffers]);
+        result.translucent   = translucent;
+        result.draw_order    = draw_order;
+
+        return result;
+    }
+
+    /// Gets the ids of the queued packets, in queue order.
+    static std::vector<std::uint32_t> order(const scener::graphics::render_queue& queue)
+    {
+        std::vector<std::uint32_t> ids;
+
+        for (const auto& packet : queue.packets())
+        {
+            ids.push_back(packet.start_index);
+        }
+
+        return ids;
+    }
+
+private:
+    static scener::graphics::vulkan::graphics_pipeline pipeline(std::uintptr_t handle, std::size_t descriptor_count = 0)
+    {
+        return { vk::Pipeline(reinterpret_cast<VkPipeline>(handle))
+               , { }
+               , { }
+               , { }
+               , std::vector<vk::DescriptorSet>(descriptor_count)
+               , { }
+               , false };
+    }
+
+private:
+    std::array<scener::graphics::vulkan::graphics_pipeline, 6> _pipelines;
+    std::array<std::uint64_t, 4>                               _buffers;
+};
+
+#endif // TESTS_RENDERQUEUETEST_HPP
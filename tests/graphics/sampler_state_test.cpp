@@ -0,0 +1,74 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "sampler_state_test.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+using namespace scener;
+using namespace scener::graphics;
+
+TEST_F(sampler_state_test, equal_states_compare_and_hash_equal)
+{
+    sampler_state lhs;
+    sampler_state rhs;
+
+    EXPECT_TRUE(lhs == rhs);
+    EXPECT_FALSE(lhs != rhs);
+    EXPECT_EQ(hash(lhs), hash(rhs));
+
+    lhs.address_u     = texture_address_mode::clamp;
+    rhs.address_u     = texture_address_mode::clamp;
+    lhs.max_mip_level = 5;
+    rhs.max_mip_level = 5;
+
+    EXPECT_TRUE(lhs == rhs);
+    EXPECT_EQ(hash(lhs), hash(rhs));
+    EXPECT_TRUE(sampler_state::linear_clamp == sampler_state::linear_clamp);
+}
+
+TEST_F(sampler_state_test, any_member_change_makes_states_different)
+{
+    const sampler_state reference;
+
+    std::vector<sampler_state> states(8, reference);
+
+    states[0].address_u                    = texture_address_mode::clamp;
+    states[1].address_v                    = texture_address_mode::clamp;
+    states[2].address_w                    = texture_address_mode::clamp;
+    states[3].mag_filter                   = texture_filter::point;
+    states[4].min_filter                   = texture_filter::point;
+    states[5].max_anisotropy               = 4;
+    states[6].max_mip_level                = 3;
+    states[7].mip_map_level_of_detail_bias = 0.5f;
+
+    for (const auto& state : states)
+    {
+        EXPECT_FALSE(state == reference);
+        EXPECT_TRUE(state != reference);
+    }
+
+    EXPECT_FALSE(sampler_state::linear_clamp == sampler_state::linear_wrap);
+    EXPECT_FALSE(sampler_state::linear_wrap  == sampler_state::point_wrap);
+}
+
+TEST_F(sampler_state_test, states_key_a_single_cache_entry)
+{
+    std::unordered_map<sampler_state, int> cache;
+
+    auto clamp = sampler_state::linear_clamp;
+
+    cache[sampler_state::linear_clamp]++;
+    cache[sampler_state::linear_wrap]++;
+    cache[clamp]++;
+
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ(2, cache[sampler_state::linear_clamp]);
+    EXPECT_EQ(1, cache[sampler_state::linear_wrap]);
+
+    // The mipmap range is part of the sampler
+    clamp.max_mip_level = 4;
+
+    EXPECT_EQ(0u, cache.count(clamp));
+}
@@ -0,0 +1,23 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_SAMPLERSTATETEST_HPP
+#define TESTS_SAMPLERSTATETEST_HPP
+
+#include <cstddef>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include <scener/graphics/sampler_state.hpp>
+
+class sampler_state_test : public testing::Test
+{
+protected:
+    static std::size_t hash(const scener::graphics::sampler_state& state)
+    {
+        return std::hash<scener::graphics::sampler_state>()(state);
+    }
+};
+
+#endif // TESTS_SAMPLERSTATETEST_HPP
@@ -0,0 +1,120 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scene_graph_test.hpp"
+
+using namespace scener;
+using namespace scener::graphics;
+
+TEST_F(scene_graph_test, add_nodes_in_depth_first_order)
+{
+    scene_graph graph;
+
+    const auto root  = graph.add_node("root" , scene_graph::no_parent, translation(1.0f, 0.0f, 0.0f));
+    const auto child = graph.add_node("child", root                  , translation(0.0f, 1.0f, 0.0f));
+    const auto leaf  = graph.add_node("leaf" , child                 , translation(0.0f, 0.0f, 1.0f));
+    const auto other = graph.add_node("other", root                  , translation(0.0f, 2.0f, 0.0f));
+
+    EXPECT_EQ(4u, graph.size());
+    EXPECT_EQ(scene_graph::no_parent, graph.parent(root));
+    EXPECT_EQ(root , graph.parent(child));
+    EXPECT_EQ(child, graph.parent(leaf));
+    EXPECT_EQ(root , graph.parent(other));
+    EXPECT_EQ(leaf , graph.find("leaf"));
+    EXPECT_EQ("other", graph.name(other));
+    EXPECT_EQ(scene_graph::no_parent, graph.find("missing"));
+}
+
+TEST_F(scene_graph_test, world_transforms_concatenate_parent_transforms)
+{
+    scene_graph graph;
+
+    const auto root  = graph.add_node("root" , scene_graph::no_parent, translation(1.0f, 0.0f, 0.0f));
+    const auto child = graph.add_node("child", root                  , scale(2.0f));
+    const auto leaf  = graph.add_node("leaf" , child                 , translation(0.0f, 3.0f, 0.0f));
+
+    EXPECT_EQ(3u, graph.update());
+
+    expect_translation(graph.world_transform(root) , 1.0f, 0.0f, 0.0f);
+    expect_translation(graph.world_transform(child), 1.0f, 0.0f, 0.0f);
+
+    // Row vectors: the leaf translation is scaled by its parent, then moved by the root
+    expect_translation(graph.world_transform(leaf), 1.0f, 6.0f, 0.0f);
+    EXPECT_FLOAT_EQ(2.0f, graph.world_transform(leaf)[0][0]);
+    EXPECT_FLOAT_EQ(2.0f, graph.world_transform(leaf)[1][1]);
+    EXPECT_FLOAT_EQ(2.0f, graph.world_transform(leaf)[2][2]);
+}
+
+TEST_F(scene_graph_test, update_without_changes_recomputes_nothing)
+{
+    scene_graph graph;
+
+    const auto root = graph.add_node("root", scene_graph::no_parent, translation(1.0f, 0.0f, 0.0f));
+
+    graph.add_node("child", root, translation(0.0f, 1.0f, 0.0f));
+
+    EXPECT_EQ(2u, graph.update());
+    EXPECT_EQ(0u, graph.update());
+}
+
+TEST_F(scene_graph_test, local_change_only_updates_its_subtree)
+{
+    scene_graph graph;
+
+    const auto root   = graph.add_node("root"  , scene_graph::no_parent, translation(1.0f, 0.0f, 0.0f));
+    const auto arm    = graph.add_node("arm"   , root                  , translation(0.0f, 1.0f, 0.0f));
+    const auto hand   = graph.add_node("hand"  , arm                   , translation(0.0f, 1.0f, 0.0f));
+    const auto finger = graph.add_node("finger", hand                  , translation(0.0f, 1.0f, 0.0f));
+    const auto leg    = graph.add_node("leg"   , root                  , translation(0.0f, -1.0f, 0.0f));
+
+    graph.update();
+
+    graph.local_transform(arm, translation(0.0f, 0.0f, 5.0f));
+
+    // arm, hand and finger
+    EXPECT_EQ(3u, graph.update());
+
+    expect_translation(graph.world_transform(arm)   , 1.0f, 0.0f, 5.0f);
+    expect_translation(graph.world_transform(hand)  , 1.0f, 1.0f, 5.0f);
+    expect_translation(graph.world_transform(finger), 1.0f, 2.0f, 5.0f);
+    expect_translation(graph.world_transform(leg)   , 1.0f, -1.0f, 0.0f);
+}
+
+TEST_F(scene_graph_test, nested_dirty_nodes_are_updated_once)
+{
+    scene_graph graph;
+
+    const auto root  = graph.add_node("root" , scene_graph::no_parent, translation(0.0f, 0.0f, 0.0f));
+    const auto child = graph.add_node("child", root                  , translation(0.0f, 1.0f, 0.0f));
+    const auto leaf  = graph.add_node("leaf" , child                 , translation(0.0f, 1.0f, 0.0f));
+
+    graph.update();
+
+    // Marked deepest first, the leaf lies inside the child subtree
+    graph.local_transform(leaf , translation(2.0f, 0.0f, 0.0f));
+    graph.local_transform(child, translation(0.0f, 3.0f, 0.0f));
+    graph.local_transform(leaf , translation(4.0f, 0.0f, 0.0f));
+
+    EXPECT_EQ(2u, graph.update());
+
+    expect_translation(graph.world_transform(leaf), 4.0f, 3.0f, 0.0f);
+}
+
+TEST_F(scene_graph_test, root_change_propagates_to_every_descendant)
+{
+    scene_graph graph;
+
+    const auto root  = graph.add_node("root" , scene_graph::no_parent, translation(0.0f, 0.0f, 0.0f));
+    const auto child = graph.add_node("child", root                  , translation(0.0f, 1.0f, 0.0f));
+    const auto leaf  = graph.add_node("leaf" , child                 , translation(0.0f, 1.0f, 0.0f));
+
+    graph.update();
+
+    graph.local_transform(root, translation(10.0f, 0.0f, 0.0f));
+
+    EXPECT_EQ(3u, graph.update());
+
+    expect_translation(graph.world_transform(child), 10.0f, 1.0f, 0.0f);
+    expect_translation(graph.world_transform(leaf) , 10.0f, 2.0f, 0.0f);
+    EXPECT_EQ(3u, graph.world_transforms().size());
+}
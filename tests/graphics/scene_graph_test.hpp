@@ -0,0 +1,34 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_SCENEGRAPHTEST_HPP
+#define TESTS_SCENEGRAPHTEST_HPP
+
+#include <gtest/gtest.h>
+
+#include <scener/graphics/scene_graph.hpp>
+#include <scener/math/matrix.hpp>
+
+class scene_graph_test : public testing::Test
+{
+protected:
+    static scener::math::matrix4 translation(float x, float y, float z)
+    {
+        return scener::math::matrix::create_translation(scener::math::vector3 { x, y, z });
+    }
+
+    static scener::math::matrix4 scale(float value)
+    {
+        return scener::math::matrix::create_scale(scener::math::vector3 { value, value, value });
+    }
+
+    /// Checks the translation row of the given world transform.
+    static void expect_translation(const scener::math::matrix4& world, float x, float y, float z)
+    {
+        EXPECT_FLOAT_EQ(x, world[3][0]);
+        EXPECT_FLOAT_EQ(y, world[3][1]);
+        EXPECT_FLOAT_EQ(z, world[3][2]);
+    }
+};
+
+#endif // TESTS_SCENEGRAPHTEST_HPP
@@ -0,0 +1,64 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "step_accumulator_test.hpp"
+
+using namespace scener;
+using namespace scener::graphics;
+
+// Tests that a frame shorter than a step takes no update step.
+TEST_F(step_accumulator_test, short_frames_take_no_steps)
+{
+    step_accumulator accumulator;
+
+    EXPECT_FALSE(accumulator.accumulate(timespan::from_ticks(60), timespan::from_ticks(step_ticks), 5));
+    EXPECT_EQ(0u, take_steps(accumulator));
+
+    // The remainder carries over to the next frame
+    EXPECT_FALSE(accumulator.accumulate(timespan::from_ticks(60), timespan::from_ticks(step_ticks), 5));
+    EXPECT_EQ(1u, take_steps(accumulator));
+    EXPECT_EQ(20, accumulator.accumulated_time().ticks());
+}
+
+// Tests the catch-up cap of max_update_steps update steps.
+TEST_F(step_accumulator_test, catch_up_is_capped_to_max_steps)
+{
+    step_accumulator accumulator;
+
+    EXPECT_TRUE(accumulator.accumulate(timespan::from_ticks(10 * step_ticks + 50), timespan::from_ticks(step_ticks), 5));
+    EXPECT_EQ(5u, take_steps(accumulator));
+}
+
+// Tests that the accumulator is clamped when it is over the cap.
+TEST_F(step_accumulator_test, accumulated_time_is_clamped)
+{
+    step_accumulator accumulator;
+
+    accumulator.accumulate(timespan::from_ticks(3 * step_ticks), timespan::from_ticks(step_ticks), 2);
+
+    EXPECT_EQ(2 * step_ticks, accumulator.accumulated_time().ticks());
+
+    // Right at the cap nothing is dropped
+    step_accumulator exact;
+
+    EXPECT_FALSE(exact.accumulate(timespan::from_ticks(2 * step_ticks), timespan::from_ticks(step_ticks), 2));
+    EXPECT_EQ(2 * step_ticks, exact.accumulated_time().ticks());
+}
+
+// Tests the interpolation alpha of the remaining time.
+TEST_F(step_accumulator_test, interpolation_alpha_is_the_remaining_fraction)
+{
+    step_accumulator accumulator;
+
+    EXPECT_FLOAT_EQ(0.0f, accumulator.interpolation_alpha(timespan::from_ticks(step_ticks)));
+
+    accumulator.accumulate(timespan::from_ticks(step_ticks + 25), timespan::from_ticks(step_ticks), 5);
+
+    EXPECT_EQ(1u, take_steps(accumulator));
+    EXPECT_FLOAT_EQ(0.25f, accumulator.interpolation_alpha(timespan::from_ticks(step_ticks)));
+
+    accumulator.accumulate(timespan::from_ticks(50), timespan::from_ticks(step_ticks), 5);
+
+    EXPECT_EQ(0u, take_steps(accumulator));
+    EXPECT_FLOAT_EQ(0.75f, accumulator.interpolation_alpha(timespan::from_ticks(step_ticks)));
+}
@@ -0,0 +1,34 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_STEPACCUMULATORTEST_HPP
+#define TESTS_STEPACCUMULATORTEST_HPP
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include <scener/graphics/step_accumulator.hpp>
+
+class step_accumulator_test : public testing::Test
+{
+protected:
+    /// The fixed update step, in ticks.
+    static constexpr std::int64_t step_ticks = 100;
+
+    /// Takes every due update step.
+    /// \returns the number of update steps taken.
+    static std::uint32_t take_steps(scener::graphics::step_accumulator& accumulator)
+    {
+        std::uint32_t steps = 0;
+
+        while (accumulator.take_step(scener::timespan::from_ticks(step_ticks)))
+        {
+            ++steps;
+        }
+
+        return steps;
+    }
+};
+
+#endif // TESTS_STEPACCUMULATORTEST_HPP
@@ -0,0 +1,60 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "texture_streamer_test.hpp"
+
+using namespace scener;
+using namespace scener::graphics;
+
+TEST_F(texture_streamer_test, initial_level_is_the_largest_mipmap_within_the_initial_size)
+{
+    const auto data = surface(256, 128);
+
+    EXPECT_EQ(9u, data.mipmaps().size());
+    EXPECT_EQ(0u, texture_streamer::initial_level(data, 256));
+    EXPECT_EQ(1u, texture_streamer::initial_level(data, 255));
+    EXPECT_EQ(1u, texture_streamer::initial_level(data, 128));
+    EXPECT_EQ(2u, texture_streamer::initial_level(data, 64));
+    EXPECT_EQ(8u, texture_streamer::initial_level(data, 1));
+}
+
+TEST_F(texture_streamer_test, initial_level_falls_back_to_the_smallest_mipmap)
+{
+    const auto data = surface(64, 64);
+
+    EXPECT_EQ(6u, texture_streamer::initial_level(data, 0));
+}
+
+TEST_F(texture_streamer_test, required_level_matches_the_projected_size)
+{
+    // Diameter on screen: 1 * 1 * 1024 / distance pixels
+    EXPECT_EQ(0u, level_at(1.5f));
+    EXPECT_EQ(1u, level_at(2.0f));
+    EXPECT_EQ(3u, level_at(8.0f));
+    EXPECT_EQ(4u, level_at(20.0f));
+}
+
+TEST_F(texture_streamer_test, required_level_is_clamped_to_the_smallest_mipmap)
+{
+    EXPECT_EQ(10u, level_at(100000.0f));
+}
+
+TEST_F(texture_streamer_test, bounds_containing_or_behind_the_camera_require_the_full_resolution)
+{
+    EXPECT_EQ(0u, level_at(0.5f));
+    EXPECT_EQ(0u, level_at(-10.0f));
+    EXPECT_EQ(0u, level_at(10.0f, 0.0f));
+}
+
+TEST_F(texture_streamer_test, single_level_textures_require_their_only_level)
+{
+    const auto level = texture_streamer::required_level(1024
+                                                      , 1
+                                                      , { math::vector3::zero(), 1.0f }
+                                                      , math::matrix::create_translation(math::vector3 { 0.0f, 0.0f, -100.0f })
+                                                      , math::matrix4::identity()
+                                                      , math::matrix4::identity()
+                                                      , 1024.0f);
+
+    EXPECT_EQ(0u, level);
+}
@@ -0,0 +1,60 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_TEXTURESTREAMERTEST_HPP
+#define TESTS_TEXTURESTREAMERTEST_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <scener/content/dds/surface.hpp>
+#include <scener/graphics/texture_streamer.hpp>
+
+class texture_streamer_test : public testing::Test
+{
+protected:
+    /// Creates a RGBA8 surface with a full mipmap chain.
+    static scener::content::dds::surface surface(std::uint32_t width, std::uint32_t height)
+    {
+        using scener::content::dds::surface;
+
+        const auto    format = scener::graphics::surface_format::color;
+        std::uint32_t levels = 0;
+        std::size_t   size   = 0;
+
+        for (auto w = width, h = height; ; w = std::max(w / 2, 1u), h = std::max(h / 2, 1u))
+        {
+            size += surface::mipmap_size(format, w, h);
+            levels++;
+
+            if (w == 1 && h == 1)
+            {
+                break;
+            }
+        }
+
+        return { format, width, height, levels, 1, false, std::vector<std::uint8_t>(size) };
+    }
+
+    /// Gets the level required by a unit sphere at the given distance in front of the camera, for a 1024 pixels
+    /// texture with 11 mipmaps and a 1024 pixels high viewport.
+    static std::uint32_t level_at(float distance, float radius = 1.0f)
+    {
+        using namespace scener::math;
+
+        const auto world = matrix::create_translation(vector3 { 0.0f, 0.0f, -distance });
+
+        return scener::graphics::texture_streamer::required_level(1024
+                                                                , 11
+                                                                , { vector3::zero(), radius }
+                                                                , world
+                                                                , matrix4::identity()
+                                                                , matrix4::identity()
+                                                                , 1024.0f);
+    }
+};
+
+#endif // TESTS_TEXTURESTREAMERTEST_HPP
@@ -4,9 +4,12 @@
 #include "binary_reader_test.hpp"
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 #include <scener/io/binary_reader.hpp>
 #include <scener/io/file_stream.hpp>
+#include <scener/io/memory_stream.hpp>
 
 using namespace scener;
 using namespace scener::io;
@@ -150,3 +153,65 @@ TEST_F(binary_reader_test, read_double)
 
     EXPECT_NE(value, 0);
 }
+
+// Tests read_span() of native floats.
+TEST_F(binary_reader_test, read_span)
+{
+    std::vector<std::uint8_t> vec = { 0x00, 0x00, 0x00, 0x00
+                                    , 0x00, 0x00, 0x80, 0x3F
+                                    , 0x00, 0x00, 0x70, 0x41 };
+
+    memory_stream stream(vec);
+    binary_reader reader(stream);
+
+    auto values = reader.read_span<float>(3);
+
+    EXPECT_EQ(3u  , values.size());
+    EXPECT_EQ(0.0f, values[0]);
+    EXPECT_EQ(1.0f, values[1]);
+    EXPECT_EQ(15.0f, values[2]);
+}
+
+// Tests read_into() with byte order conversion.
+TEST_F(binary_reader_test, read_into_big_endian)
+{
+    std::vector<std::uint8_t> vec = { 0x00, 0x00, 0x01, 0x02
+                                    , 0x12, 0x34, 0x56, 0x78 };
+
+    memory_stream              stream(vec);
+    binary_reader              reader(stream, byte_order::big_endian);
+    std::vector<std::uint32_t> values(2, 0);
+
+    auto readed = reader.read_into(gsl::span<std::uint32_t>(values));
+
+    EXPECT_EQ(2u         , readed);
+    EXPECT_EQ(0x00000102u, values[0]);
+    EXPECT_EQ(0x12345678u, values[1]);
+}
+
+// Tests reads larger than the internal buffer, mixed with buffered reads.
+TEST_F(binary_reader_test, read_bypasses_buffer)
+{
+    std::vector<std::uint8_t> vec(64);
+
+    for (std::size_t i = 0; i < vec.size(); ++i)
+    {
+        vec[i] = static_cast<std::uint8_t>(i);
+    }
+
+    memory_stream stream(vec);
+    binary_reader reader(stream, byte_order::little_endian, 8);
+
+    EXPECT_EQ(0, reader.read<std::uint8_t>());
+
+    auto bytes = reader.read_bytes(40);
+
+    EXPECT_EQ(40u, bytes.size());
+    EXPECT_EQ(1  , bytes.front());
+    EXPECT_EQ(40 , bytes.back());
+    EXPECT_EQ(41 , reader.peek_char());
+    EXPECT_EQ(41 , reader.read<std::uint8_t>());
+    EXPECT_EQ(42u, reader.base_stream().position());
+    EXPECT_EQ(22u, reader.read_bytes(100).size());
+    EXPECT_EQ(-1 , reader.peek_char());
+}
@@ -0,0 +1,92 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "binary_writer_test.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <scener/io/binary_reader.hpp>
+#include <scener/io/binary_writer.hpp>
+#include <scener/io/memory_stream.hpp>
+
+using namespace scener;
+using namespace scener::io;
+
+// Tests writing primitive values and reading them back.
+TEST_F(binary_writer_test, write_read_roundtrip)
+{
+    memory_stream stream;
+
+    {
+        binary_writer writer(stream);
+
+        writer.write<std::uint8_t>(0xAB);
+        writer.write<std::int16_t>(-2);
+        writer.write<std::uint32_t>(0xDEADBEEF);
+        writer.write<std::int64_t>(-1234567890123);
+        writer.write<float>(1.5f);
+        writer.write<double>(2.25);
+        writer.write<bool>(true);
+        writer.write<char16_t>(u'é');
+        writer.write<std::string>("scener");
+    }
+
+    stream.seek(0, std::ios::beg);
+
+    binary_reader reader(stream);
+
+    EXPECT_EQ(0xAB               , reader.read<std::uint8_t>());
+    EXPECT_EQ(-2                 , reader.read<std::int16_t>());
+    EXPECT_EQ(0xDEADBEEF         , reader.read<std::uint32_t>());
+    EXPECT_EQ(-1234567890123     , reader.read<std::int64_t>());
+    EXPECT_EQ(1.5f               , reader.read<float>());
+    EXPECT_EQ(2.25               , reader.read<double>());
+    EXPECT_EQ(true               , reader.read<bool>());
+    EXPECT_EQ(u'é'               , reader.read<char16_t>());
+    EXPECT_EQ(std::string("scener"), reader.read<std::string>());
+}
+
+// Tests write_span() with byte order conversion.
+TEST_F(binary_writer_test, write_span_big_endian)
+{
+    memory_stream              stream;
+    std::vector<std::uint32_t> values = { 0x00000102, 0x12345678 };
+
+    binary_writer writer(stream, byte_order::big_endian);
+
+    writer.write_span<std::uint32_t>(values);
+    writer.flush();
+
+    std::vector<std::uint8_t> expected = { 0x00, 0x00, 0x01, 0x02, 0x12, 0x34, 0x56, 0x78 };
+    std::vector<std::uint8_t> actual(stream.data().begin(), stream.data().end());
+
+    EXPECT_EQ(expected, actual);
+}
+
+// Tests writes larger than the internal buffer.
+TEST_F(binary_writer_test, write_bytes_bypasses_buffer)
+{
+    memory_stream             stream;
+    std::vector<std::uint8_t> bytes(100);
+
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+    {
+        bytes[i] = static_cast<std::uint8_t>(i);
+    }
+
+    binary_writer writer(stream, byte_order::little_endian, 16);
+
+    writer.write<std::uint8_t>(0xFF);
+    writer.write_bytes(bytes);
+    writer.write<std::uint8_t>(0xFE);
+    writer.flush();
+
+    EXPECT_EQ(102u, stream.length());
+    EXPECT_EQ(0xFF, stream.data()[0]);
+    EXPECT_EQ(0   , stream.data()[1]);
+    EXPECT_EQ(99  , stream.data()[100]);
+    EXPECT_EQ(0xFE, stream.data()[101]);
+}
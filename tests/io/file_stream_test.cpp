@@ -4,7 +4,10 @@
 #include "file_stream_test.hpp"
 
 #include <cstddef>
+#include <cstdio>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include <scener/io/file_stream.hpp>
 
@@ -183,3 +186,51 @@ TEST_F(file_stream_test, read_double)
 
     stream.close();
 }
+
+TEST_F(file_stream_test, read_async)
+{
+    file_stream stream(file_stream_test::TEST_FILE, std::ios::in | std::ios::binary);
+
+    std::vector<std::uint8_t> expected(16);
+    std::vector<std::uint8_t> buffer(16);
+
+    stream.seek(8, std::ios::beg);
+    stream.read(reinterpret_cast<char*>(expected.data()), 0, expected.size());
+    stream.seek(0, std::ios::beg);
+
+    auto readed = stream.read_async(8, gsl::span<std::uint8_t>(buffer)).get();
+
+    EXPECT_EQ(buffer.size(), readed);
+    EXPECT_EQ(expected, buffer);
+    EXPECT_EQ(static_cast<std::size_t>(0), stream.position());
+
+    stream.close();
+}
+
+TEST_F(file_stream_test, write)
+{
+    const std::string         path = "./file_stream_write_test.bin";
+    std::vector<std::uint8_t> data = { 1, 2, 3, 4 };
+
+    {
+        file_stream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        EXPECT_TRUE(stream.can_write());
+
+        stream.write(reinterpret_cast<const char*>(data.data()), 0, data.size());
+        stream.write_byte(5);
+        stream.flush();
+        stream.close();
+    }
+
+    file_stream               stream(path);
+    std::vector<std::uint8_t> buffer(5);
+
+    EXPECT_EQ(static_cast<std::size_t>(5), stream.length());
+    EXPECT_EQ(static_cast<std::size_t>(5), stream.read(reinterpret_cast<char*>(buffer.data()), 0, buffer.size()));
+    EXPECT_EQ(5, buffer[4]);
+
+    stream.close();
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,43 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "memory_mapped_file_test.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <scener/io/file.hpp>
+#include <scener/io/memory_mapped_file.hpp>
+
+using namespace scener;
+using namespace scener::io;
+
+TEST_F(memory_mapped_file_test, map_file)
+{
+    memory_mapped_file mapping(memory_mapped_file_test::TEST_FILE);
+
+    EXPECT_TRUE(mapping.is_open());
+    EXPECT_NE(static_cast<std::size_t>(0), mapping.size());
+}
+
+TEST_F(memory_mapped_file_test, map_missing_file)
+{
+    memory_mapped_file mapping("./content/missing.dds");
+
+    EXPECT_FALSE(mapping.is_open());
+    EXPECT_EQ(static_cast<std::size_t>(0), mapping.size());
+}
+
+TEST_F(memory_mapped_file_test, contents_match_file)
+{
+    memory_mapped_file mapping(memory_mapped_file_test::TEST_FILE);
+
+    const auto expected = file::read_all_bytes(memory_mapped_file_test::TEST_FILE);
+    const auto data     = mapping.data();
+
+    ASSERT_EQ(expected.size(), mapping.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), data.begin()));
+}
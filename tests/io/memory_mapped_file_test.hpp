@@ -0,0 +1,15 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_MEMORYMAPPEDFILETEST_HPP
+#define TESTS_MEMORYMAPPEDFILETEST_HPP
+
+#include <gtest/gtest.h>
+
+class memory_mapped_file_test : public testing::Test
+{
+protected:
+    const std::string TEST_FILE = "./content/earthshaker/earthshaker0VS.glsl";
+};
+
+#endif // TESTS_MEMORYMAPPEDFILETEST_HPP
@@ -52,3 +52,40 @@ TEST_F(memory_stream_test, read_float)
     EXPECT_EQ(1.5000000E+001, reader.read<float>());
     EXPECT_EQ(6.5535000E+004, reader.read<float>());
 }
+
+TEST_F(memory_stream_test, read_async)
+{
+    std::vector<std::uint8_t> vec = { 1, 2, 3, 4 };
+    memory_stream stream(vec);
+    std::vector<std::uint8_t> out(4, 0);
+
+    auto readed = stream.read_async(2, span<std::uint8_t>(out)).get();
+
+    EXPECT_EQ(static_cast<std::size_t>(2), readed);
+    EXPECT_EQ(3, out[0]);
+    EXPECT_EQ(4, out[1]);
+    EXPECT_EQ(static_cast<std::size_t>(0), stream.position());
+}
+
+TEST_F(memory_stream_test, write_grows_buffer)
+{
+    memory_stream stream(2);
+    std::vector<std::uint8_t> data = { 1, 2, 3, 4, 5 };
+
+    EXPECT_TRUE(stream.can_write());
+
+    stream.write(reinterpret_cast<const char*>(data.data()), 0, data.size());
+    stream.write_byte(6);
+
+    EXPECT_EQ(static_cast<std::size_t>(6), stream.length());
+    EXPECT_EQ(static_cast<std::size_t>(6), stream.position());
+    EXPECT_LE(static_cast<std::size_t>(6), stream.capacity());
+
+    stream.seek(1, std::ios::beg);
+    stream.write_byte(9);
+
+    EXPECT_EQ(static_cast<std::size_t>(6), stream.length());
+    EXPECT_EQ(1, stream.data()[0]);
+    EXPECT_EQ(9, stream.data()[1]);
+    EXPECT_EQ(6, stream.data()[5]);
+}
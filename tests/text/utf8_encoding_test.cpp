@@ -720,3 +720,135 @@ TEST_F(utf8_encoding_test, get_string_when_byte_range_is_invalid)
 
     EXPECT_ANY_THROW({  utf8.get_string(bytes, 1, bytes.size()); });
 }
+
+TEST_F(utf8_encoding_test, is_valid)
+{
+    utf8_encoding             utf8;
+    std::vector<std::uint8_t> valid     = { 0x41, 0xC3, 0xB1, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80 };
+    std::vector<std::uint8_t> overlong  = { 0x41, 0xC0, 0xAF };
+    std::vector<std::uint8_t> surrogate = { 0xED, 0xA0, 0x80 };
+    std::vector<std::uint8_t> truncated = { 0x41, 0xE2, 0x82 };
+
+    EXPECT_TRUE(utf8.is_valid(valid));
+    EXPECT_FALSE(utf8.is_valid(overlong));
+    EXPECT_FALSE(utf8.is_valid(surrogate));
+    EXPECT_FALSE(utf8.is_valid(truncated));
+}
+
+TEST_F(utf8_encoding_test, get_chars_into_span)
+{
+    utf8_encoding             utf8;
+    std::vector<std::uint8_t> bytes = { 0x41, 0xC3, 0xB1, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80 };
+    std::vector<char16_t>     chars(5);
+
+    EXPECT_EQ(5u, utf8.get_char_count(gsl::span<const std::uint8_t>(bytes)));
+    EXPECT_EQ(5u, utf8.get_chars(bytes, chars));
+    EXPECT_TRUE(chars == std::vector<char16_t>({ u'A', u'ñ', u'€', 0xD83D, 0xDE00 }));
+}
+
+TEST_F(utf8_encoding_test, get_bytes_into_span)
+{
+    utf8_encoding             utf8;
+    std::vector<char16_t>     chars = { u'A', u'ñ', u'€', 0xD83D, 0xDE00 };
+    std::vector<std::uint8_t> bytes(10);
+
+    EXPECT_EQ(10u, utf8.get_byte_count(std::u16string_view(chars.data(), chars.size())));
+    EXPECT_EQ(10u, utf8.get_bytes(std::u16string_view(chars.data(), chars.size()), bytes));
+    EXPECT_TRUE(bytes == std::vector<std::uint8_t>({ 0x41, 0xC3, 0xB1, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80 }));
+}
+
+TEST_F(utf8_encoding_test, round_trip_long_ascii_run)
+{
+    utf8_encoding  utf8;
+    std::u16string text;
+
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+        text.push_back(static_cast<char16_t>(u'a' + (i % 26)));
+    }
+    text.push_back(u'é');
+    text.append(u"tail after the multi-byte sequence");
+
+    auto bytes = utf8.get_bytes(text);
+
+    EXPECT_EQ(text.size() + 1, bytes.size());
+    EXPECT_TRUE(utf8.get_string(bytes, 0, bytes.size()) == text);
+}
+
+TEST_F(utf8_encoding_test, get_chars_with_invalid_sequence)
+{
+    utf8_encoding             utf8;
+    std::vector<std::uint8_t> bytes(100, 0x41);
+    std::vector<char16_t>     chars(100);
+
+    bytes[70] = 0xFF;
+
+    EXPECT_ANY_THROW({ utf8.get_chars(bytes, chars); });
+}
+
+TEST_F(utf8_encoding_test, get_chars_with_not_enough_space_in_span)
+{
+    utf8_encoding             utf8;
+    std::vector<std::uint8_t> bytes(40, 0x41);
+    std::vector<char16_t>     chars(39);
+
+    EXPECT_ANY_THROW({ utf8.get_chars(bytes, chars); });
+}
+
+TEST_F(utf8_encoding_test, get_string_from_string_view)
+{
+    utf8_encoding    utf8;
+    std::string_view text = "UTF8 Encoding \xE2\x82\xAC";
+    std::u16string   chars(utf8.get_char_count(text), u'\0');
+
+    EXPECT_EQ(15u, utf8.get_chars(text, chars));
+    EXPECT_TRUE(chars == u"UTF8 Encoding €");
+    EXPECT_TRUE(encoding::convert(text) == u"UTF8 Encoding €");
+}
+
+TEST_F(utf8_encoding_test, decoder_keeps_incomplete_sequences_across_chunks)
+{
+    urf8_decoder              decoder;
+    std::vector<std::uint8_t> bytes = { 0x41, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80, 0x42 };
+    std::vector<char16_t>     chars(8);
+    std::size_t               count = 0;
+
+    // Split every multi-byte sequence across chunk boundaries
+    count += decoder.get_chars(gsl::span<const std::uint8_t>(bytes.data(), 2), gsl::span<char16_t>(chars).subspan(count), false);
+    count += decoder.get_chars(gsl::span<const std::uint8_t>(bytes.data() + 2, 1), gsl::span<char16_t>(chars).subspan(count), false);
+    count += decoder.get_chars(gsl::span<const std::uint8_t>(bytes.data() + 3, 3), gsl::span<char16_t>(chars).subspan(count), false);
+    count += decoder.get_chars(gsl::span<const std::uint8_t>(bytes.data() + 6, 3), gsl::span<char16_t>(chars).subspan(count), true);
+
+    EXPECT_EQ(5u, count);
+    EXPECT_TRUE(std::u16string(chars.data(), count) == std::u16string({ u'A', u'€', 0xD83D, 0xDE00, u'B' }));
+}
+
+TEST_F(utf8_encoding_test, decoder_flush_with_incomplete_sequence)
+{
+    urf8_decoder              decoder;
+    std::vector<std::uint8_t> bytes = { 0x41, 0xE2, 0x82 };
+    std::vector<char16_t>     chars(4);
+
+    EXPECT_EQ(1u, decoder.get_char_count(bytes, false));
+    EXPECT_EQ(1u, decoder.get_chars(bytes, chars, false));
+    EXPECT_ANY_THROW({ decoder.get_chars(gsl::span<const std::uint8_t>(), chars, true); });
+
+    decoder.reset();
+
+    EXPECT_EQ(0u, decoder.get_chars(gsl::span<const std::uint8_t>(), chars, true));
+}
+
+TEST_F(utf8_encoding_test, decoder_invalid_continuation_drops_the_pending_sequence)
+{
+    urf8_decoder              decoder;
+    std::vector<std::uint8_t> lead  = { 0x41, 0xE2 };
+    std::vector<std::uint8_t> bad   = { 0x41, 0x42 };
+    std::vector<char16_t>     chars(4);
+
+    EXPECT_EQ(1u, decoder.get_chars(lead, chars, false));
+    EXPECT_ANY_THROW({ decoder.get_chars(bad, chars, false); });
+
+    // The failed sequence is not carried over to the next call
+    EXPECT_EQ(2u, decoder.get_chars(bad, chars, true));
+    EXPECT_TRUE(std::u16string(chars.data(), 2) == u"AB");
+}